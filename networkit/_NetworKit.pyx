@@ -241,6 +241,9 @@ cdef extern from "cpp/graph/Graph.h":
 		void indexEdges(bool) except +
 		bool hasEdgeIds() except +
 		edgeid edgeId(node, node) except +
+		void indexEdgeLookup(count) except +
+		bool hasEdgeLookup() except +
+		void removeEdgeLookup() except +
 		count numberOfNodes() except +
 		count numberOfEdges() except +
 		pair[count, count] size() except +
@@ -452,6 +455,34 @@ cdef class Graph:
 		"""
 		return self._this.edgeId(u, v)
 
+	def indexEdgeLookup(self, count minSlots = 32):
+		"""
+		Builds hash tables that make hasEdge, edgeId, weight and removeEdge take expected constant time
+		for nodes with at least minSlots slots in an adjacency array. The tables are kept up to date
+		when the graph is modified.
+
+		Parameters
+		----------
+		minSlots : count
+			Smaller adjacency arrays are scanned.
+		"""
+		self._this.indexEdgeLookup(minSlots)
+
+	def hasEdgeLookup(self):
+		"""
+		Returns
+		-------
+		bool
+			if the edge lookup has been built
+		"""
+		return self._this.hasEdgeLookup()
+
+	def removeEdgeLookup(self):
+		"""
+		Removes the edge lookup and frees its memory.
+		"""
+		self._this.removeEdgeLookup()
+
 	def numberOfNodes(self):
 		"""
 		Get the number of nodes in the graph.
@@ -6396,7 +6427,7 @@ cdef class CoreDecomposition(Centrality):
 	enforceBucketQueueAlgorithm : boolean
 		enforce switch to sequential algorithm
 	storeNodeOrder : boolean
-		If set to True, the order of the nodes in ascending order of the cores is stored and can later be returned using getNodeOrder(). Enforces the sequential bucket priority queue algorithm.
+		If set to True, the order in which the nodes are peeled (in ascending order of the cores) is stored and can later be returned using getNodeOrder().
 
 	"""
 
@@ -8425,6 +8456,74 @@ cdef class MissingLinksFinder:
 		"""
 		return move(self._this.findFromNode(u, k))
 
+cdef extern from "cpp/linkprediction/TopKLinkFinder.h":
+	cdef cppclass _TopKLinkFinder "NetworKit::TopKLinkFinder":
+		_TopKLinkFinder(const _Graph& G, _LinkPredictor& predictor, count batchSize) except +
+		vector[pair[pair[node, node], double]] findTopK(count k) nogil except +
+		vector[pair[pair[node, node], double]] findTopKPerNode(count k) nogil except +
+
+cdef class TopKLinkFinder:
+	""" Finds the best scored missing links of a graph without scoring all node-pairs.
+
+	Candidates are the node-pairs at distance 2, which are generated and scored in batches
+	of bounded size by the given link predictor. Only the best k predictions are kept,
+	either in total or per source node.
+
+	Parameters
+	----------
+	G : Graph
+		The graph to find missing links in, it has to be undirected.
+	predictor : LinkPredictor
+		The link predictor to score the candidates with, it is set to work on G.
+	batchSize : count, optional
+		Approximate maximum number of candidates generated and scored at once.
+	"""
+	cdef _TopKLinkFinder* _this
+	cdef Graph _G
+	cdef LinkPredictor _predictor
+
+	def __cinit__(self, Graph G, LinkPredictor predictor, count batchSize = 1 << 22):
+		self._G = G
+		self._predictor = predictor
+		self._this = new _TopKLinkFinder(G._this, dereference(predictor._this), batchSize)
+
+	def __dealloc__(self):
+		del self._this
+
+	def findTopK(self, count k):
+		""" Returns the k best scored node-pairs (u, v) with u < v at distance 2.
+
+		Parameters
+		----------
+		k : count
+			Number of predictions to return.
+
+		Returns
+		-------
+		At most k predictions, sorted descendingly by score.
+		"""
+		cdef vector[pair[pair[node, node], double]] result
+		with nogil:
+			result = self._this.findTopK(k)
+		return result
+
+	def findTopKPerNode(self, count k):
+		""" Returns for every node u the k best scored node-pairs (u, v) at distance 2.
+
+		Parameters
+		----------
+		k : count
+			Number of predictions to return per node.
+
+		Returns
+		-------
+		At most k predictions per node, ascendingly by u and for each u descendingly by score.
+		"""
+		cdef vector[pair[pair[node, node], double]] result
+		with nogil:
+			result = self._this.findTopKPerNode(k)
+		return result
+
 cdef extern from "cpp/linkprediction/NeighborhoodUtility.h" namespace "NetworKit::NeighborhoodUtility":
 	vector[node] getNeighborsUnion(const _Graph& G, node u, node v) except +
 	vector[node] getCommonNeighbors(const _Graph& G, node u, node v) except +
@@ -9493,6 +9592,52 @@ def sort2(sample):
 	return result
 
 
+cdef extern from "cpp/algebraic/CSRMatrix.h":
+	pass
+
+cdef extern from "cpp/numerics/LAMG/LevelHierarchyCache.h":
+	void _setLamgCacheDirectory "NetworKit::LevelHierarchyCache<NetworKit::CSRMatrix>::setDirectory" (string) except +
+	string _getLamgCacheDirectory "NetworKit::LevelHierarchyCache<NetworKit::CSRMatrix>::getDirectory" () except +
+	void _setLamgCacheRetain "NetworKit::LevelHierarchyCache<NetworKit::CSRMatrix>::setRetain" (count) except +
+	count _getLamgCacheRetain "NetworKit::LevelHierarchyCache<NetworKit::CSRMatrix>::getRetain" () except +
+	void _clearLamgCache "NetworKit::LevelHierarchyCache<NetworKit::CSRMatrix>::clear" () except +
+
+def setLamgCacheDirectory(directory):
+	""" Set the directory in which the LAMG setups of CommuteTimeDistance, SpanningEdgeCentrality and MaxentStress
+	are saved and from which they are loaded again, also by later runs. An empty string disables saving.
+
+	Parameters
+	----------
+	directory : str
+		The directory, it has to exist.
+	"""
+	_setLamgCacheDirectory(stdstring(directory))
+
+def getLamgCacheDirectory():
+	""" Get the directory in which LAMG setups are saved, empty if they are not saved. """
+	return pystring(_getLamgCacheDirectory())
+
+def setLamgCacheRetain(count number):
+	""" Keep the `number` most recently used LAMG setups in memory. By default, a setup is released together with the
+	last object that uses it, so e.g. a SpanningEdgeCentrality that is created after a CommuteTimeDistance on the same
+	graph has been deleted only reuses its setup if setups are retained or a cache directory is set.
+
+	Parameters
+	----------
+	number : count
+		The number of setups to keep.
+	"""
+	_setLamgCacheRetain(number)
+
+def getLamgCacheRetain():
+	""" Get the number of most recently used LAMG setups that are kept in memory. """
+	return _getLamgCacheRetain()
+
+def clearLamgCache():
+	""" Release all LAMG setups held in memory. Saved setups are kept. """
+	_clearLamgCache()
+
+
 cdef extern from "cpp/distance/CommuteTimeDistance.h":
 	cdef cppclass _CommuteTimeDistance "NetworKit::CommuteTimeDistance":
 		_CommuteTimeDistance(_Graph G, double tol) except +
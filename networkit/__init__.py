@@ -88,7 +88,7 @@ except ImportError as importError:
 # TODO: introduce settings module
 
 # extension imports
-from _NetworKit import getLogLevel, setLogLevel, setPrintLocation, enableNestedParallelism, setNumberOfThreads, getCurrentNumberOfThreads, getMaxNumberOfThreads, none, setSeed
+from _NetworKit import getLogLevel, setLogLevel, setPrintLocation, enableNestedParallelism, setNumberOfThreads, getCurrentNumberOfThreads, getMaxNumberOfThreads, none, setSeed, setLamgCacheDirectory, getLamgCacheDirectory, setLamgCacheRetain, getLamgCacheRetain, clearLamgCache
 
 # local imports into the top namespace
 from .graph import Graph
@@ -7,12 +7,15 @@
 
 #include "CSRMatrix.h"
 
+#include <algorithm>
 #include <cassert>
 #include <atomic>
 #include "omp.h"
 
 namespace NetworKit {
 
+const count CSRMatrix::heapRowThreshold = 8;
+
 CSRMatrix::CSRMatrix() : rowIdx(0), columnIdx(0), nonZeros(0), nRows(0), nCols(0), isSorted(true), zero(0.0) {
 }
 
@@ -83,6 +86,9 @@ CSRMatrix::CSRMatrix(const count nRows, const count nCols, const std::vector<std
 CSRMatrix::CSRMatrix(const count nRows, const count nCols, const std::vector<index>& rowIdx, const std::vector<index>& columnIdx, const std::vector<double>& nonZeros,  const double zero, bool isSorted) : rowIdx(rowIdx), columnIdx(columnIdx), nonZeros(nonZeros), nRows(nRows), nCols(nCols), isSorted(isSorted), zero(zero) {
 }
 
+CSRMatrix::CSRMatrix(const count nRows, const count nCols, std::vector<index>&& rowIdx, std::vector<index>&& columnIdx, std::vector<double>&& nonZeros,  const double zero, bool isSorted) : rowIdx(std::move(rowIdx)), columnIdx(std::move(columnIdx)), nonZeros(std::move(nonZeros)), nRows(nRows), nCols(nCols), isSorted(isSorted), zero(zero) {
+}
+
 count CSRMatrix::nnzInRow(const index i) const {
 	assert(i >= 0 && i < nRows);
 	return rowIdx[i+1] - rowIdx[i];
@@ -347,77 +353,325 @@ Vector CSRMatrix::operator*(const Vector &vector) const {
 	return result;
 }
 
-CSRMatrix CSRMatrix::operator*(const CSRMatrix &other) const {
-	assert(nCols == other.nRows);
-
-	std::vector<index> rowIdx(numberOfRows()+1, 0);
-	std::vector<index> columnIdx;
-	std::vector<double> nonZeros;
-
+/**
+ * Turns @a values, where values[0] = 0 and values[i+1] holds the number of entries of row i, into the row offsets
+ * of a CSR matrix by a prefix sum that runs on blocks of the vector in parallel.
+ */
+static void parallelPrefixSum(std::vector<index>& values) {
+	const count n = values.size();
+	std::vector<index> blockSum(omp_get_max_threads() + 1, 0);
 #pragma omp parallel
 	{
-		std::vector<int64_t> marker(other.numberOfColumns(), -1);
-		count numThreads = omp_get_num_threads();
-		index threadId = omp_get_thread_num();
-
-		count chunkSize = (numberOfRows() + numThreads - 1) / numThreads;
-		index chunkStart = threadId * chunkSize;
-		index chunkEnd = std::min(numberOfRows(), chunkStart + chunkSize);
-
-		for (index i = chunkStart; i < chunkEnd; ++i) {
-			for (index jA = this->rowIdx[i]; jA < this->rowIdx[i+1]; ++jA) {
-				index k = this->columnIdx[jA];
-				for (index jB = other.rowIdx[k]; jB < other.rowIdx[k+1]; ++jB) {
-					index j = other.columnIdx[jB];
-					if (marker[j] != (int64_t) i) {
-						marker[j] = i;
-						++rowIdx[i+1];
-					}
-				}
-			}
+		const count numThreads = omp_get_num_threads();
+		const index threadId = omp_get_thread_num();
+		const index begin = n * threadId / numThreads;
+		const index end = n * (threadId + 1) / numThreads;
+
+		index sum = 0;
+		for (index i = begin; i < end; ++i) {
+			sum += values[i];
+			values[i] = sum;
 		}
-
-		std::fill(marker.begin(), marker.end(), -1);
+		blockSum[threadId + 1] = sum;
 
 #pragma omp barrier
 #pragma omp single
 		{
-			for (index i = 0; i < numberOfRows(); ++i) {
-				rowIdx[i+1] += rowIdx[i];
+			for (index t = 1; t <= numThreads; ++t) {
+				blockSum[t] += blockSum[t - 1];
 			}
+		}
+
+		for (index i = begin; i < end; ++i) {
+			values[i] += blockSum[threadId];
+		}
+	}
+}
+
+/**
+ * @return The prefix sums of the number of scalar products of the rows of @a A * @a B, i.e. entry i is the number
+ * of products needed for the rows before row i.
+ */
+static std::vector<index> productFlops(const CSRMatrix& A, const CSRMatrix& B) {
+	std::vector<index> flops(A.numberOfRows() + 1, 0);
+#pragma omp parallel for schedule(guided)
+	for (index i = 0; i < A.numberOfRows(); ++i) {
+		A.forNonZeroElementsInRow(i, [&](index k, double) {
+			flops[i + 1] += B.nnzInRow(k);
+		});
+	}
+	parallelPrefixSum(flops);
+	return flops;
+}
+
+namespace {
+
+/**
+ * Open addressing hash table from columns to values that accumulates one row of a matrix product at a time.
+ * It is reused for all rows a thread computes, only the slots used by a row are cleared afterwards.
+ */
+class RowHashAccumulator {
+public:
+	/**
+	 * Prepares the table for a row with at most @a maxEntries distinct columns.
+	 */
+	void reset(count maxEntries) {
+		count size = 16;
+		while (size < 2 * maxEntries) {
+			size <<= 1;
+		}
+		if (size > keys.size()) {
+			keys.assign(size, none);
+			values.resize(size);
+			hits.resize(size);
+		}
+		mask = size - 1;
+	}
+
+	/**
+	 * Adds @a value to the entry of column @a j, which is created if it does not exist yet.
+	 */
+	void add(index j, double value) {
+		index slot = probe(j);
+		if (keys[slot] == j) {
+			values[slot] += value;
+		} else {
+			keys[slot] = j;
+			values[slot] = value;
+			used.push_back(slot);
+		}
+	}
+
+	/**
+	 * Creates an entry for column @a j that has not been hit yet.
+	 */
+	void insert(index j) {
+		index slot = probe(j);
+		if (keys[slot] != j) {
+			keys[slot] = j;
+			values[slot] = 0.0;
+			hits[slot] = false;
+			used.push_back(slot);
+		}
+	}
+
+	/**
+	 * Adds @a value to the entry of column @a j and marks it as hit, if there is an entry for @a j.
+	 */
+	void addIfPresent(index j, double value) {
+		index slot = probe(j);
+		if (keys[slot] == j) {
+			values[slot] += value;
+			hits[slot] = true;
+		}
+	}
+
+	/**
+	 * Sets @a value to the value of the entry of column @a j and returns true if that entry has been hit.
+	 */
+	bool lookup(index j, double& value) const {
+		index slot = probe(j);
+		value = values[slot];
+		return keys[slot] == j && hits[slot];
+	}
+
+	/**
+	 * Appends all entries to @a columns and @a values, sorted by column if @a sorted is set, and clears the table.
+	 */
+	void extract(std::vector<index>& columns, std::vector<double>& values, bool sorted) {
+		if (sorted) {
+			std::sort(used.begin(), used.end(), [&](index a, index b) {
+				return keys[a] < keys[b];
+			});
+		}
+		for (index slot : used) {
+			columns.push_back(keys[slot]);
+			values.push_back(this->values[slot]);
+		}
+		clear();
+	}
+
+	/**
+	 * Removes all entries.
+	 */
+	void clear() {
+		for (index slot : used) {
+			keys[slot] = none;
+		}
+		used.clear();
+	}
+
+private:
+	std::vector<index> keys;
+	std::vector<double> values;
+	std::vector<bool> hits;
+	std::vector<index> used;
+	index mask = 0;
+
+	index probe(index j) const {
+		index slot = (j * 107) & mask;
+		while (keys[slot] != none && keys[slot] != j) {
+			slot = (slot + 1) & mask;
+		}
+		return slot;
+	}
+};
+
+/**
+ * A row of the right factor in the heap merge: its current column and position and the entry of the left factor
+ * it is multiplied with.
+ */
+struct RowCursor {
+	index column;
+	index position;
+	index leftEntry;
+};
+
+/**
+ * Per thread scratch space for computing the rows of a product.
+ */
+struct ProductWorkspace {
+	RowHashAccumulator hash;
+	std::vector<RowCursor> heap;
+};
+
+/**
+ * Computes a product matrix whose row i is appended to columns and values by rowProduct(i, workspace, columns,
+ * values). The rows are cut into chunks of about the same number of scalar products according to the prefix sums
+ * @a flops, a few more chunks than threads, which are scheduled dynamically. Every chunk is computed once into a
+ * buffer of its own and copied to its place in the result as soon as the row offsets are known.
+ */
+template<typename F>
+CSRMatrix balancedProduct(count nRows, count nCols, const std::vector<index>& flops, bool isSorted, F rowProduct) {
+	const count numChunks = std::max<count>(1, std::min<count>(nRows, 4 * omp_get_max_threads()));
+	std::vector<index> chunkBegin(numChunks + 1, nRows);
+	for (index c = 0; c < numChunks; ++c) {
+		chunkBegin[c] = std::lower_bound(flops.begin(), flops.end() - 1, flops.back() * c / numChunks) - flops.begin();
+	}
 
-			columnIdx = std::vector<index>(rowIdx[numberOfRows()]);
-			nonZeros = std::vector<double>(rowIdx[numberOfRows()]);
+	std::vector<index> rowIdx(nRows + 1, 0);
+	std::vector<std::vector<index>> chunkColumns(numChunks);
+	std::vector<std::vector<double>> chunkValues(numChunks);
+#pragma omp parallel
+	{
+		ProductWorkspace workspace;
+#pragma omp for schedule(dynamic, 1)
+		for (index c = 0; c < numChunks; ++c) {
+			for (index i = chunkBegin[c]; i < chunkBegin[c+1]; ++i) {
+				const count before = chunkColumns[c].size();
+				rowProduct(i, workspace, chunkColumns[c], chunkValues[c]);
+				rowIdx[i+1] = chunkColumns[c].size() - before;
+			}
 		}
+	}
 
-		for (index i = chunkStart; i < chunkEnd; ++i) {
-			index rowBegin = rowIdx[i];
-			index rowEnd = rowBegin;
+	parallelPrefixSum(rowIdx);
+	std::vector<index> columnIdx(rowIdx[nRows]);
+	std::vector<double> nonZeros(rowIdx[nRows]);
+#pragma omp parallel for schedule(dynamic, 1)
+	for (index c = 0; c < numChunks; ++c) {
+		std::copy(chunkColumns[c].begin(), chunkColumns[c].end(), columnIdx.begin() + rowIdx[chunkBegin[c]]);
+		std::copy(chunkValues[c].begin(), chunkValues[c].end(), nonZeros.begin() + rowIdx[chunkBegin[c]]);
+		std::vector<index>().swap(chunkColumns[c]);
+		std::vector<double>().swap(chunkValues[c]);
+	}
+
+	return CSRMatrix(nRows, nCols, std::move(rowIdx), std::move(columnIdx), std::move(nonZeros), 0.0, isSorted);
+}
 
-			for (index jA = this->rowIdx[i]; jA < this->rowIdx[i+1]; ++jA) {
-				index k = this->columnIdx[jA];
-				double valA = this->nonZeros[jA];
+} /* namespace */
+
+CSRMatrix CSRMatrix::operator*(const CSRMatrix &other) const {
+	assert(nCols == other.nRows);
 
+	const bool sortedResult = sorted() && other.sorted();
+	const std::vector<index> flops = productFlops(*this, other);
+	auto greaterColumn = [](const RowCursor& a, const RowCursor& b) {
+		return a.column > b.column;
+	};
+
+	return balancedProduct(nRows, other.nCols, flops, sortedResult, [&](index i, ProductWorkspace& workspace, std::vector<index>& columns, std::vector<double>& values) {
+		const count rowFlops = flops[i+1] - flops[i];
+		if (rowFlops == 0) return;
+
+		if (other.sorted() && nnzInRow(i) <= heapRowThreshold) {
+			// k-way merge of the sorted rows of other, yields the row sorted
+			std::vector<RowCursor>& heap = workspace.heap;
+			heap.clear();
+			for (index jA = rowIdx[i]; jA < rowIdx[i+1]; ++jA) {
+				const index k = columnIdx[jA];
+				if (other.rowIdx[k] < other.rowIdx[k+1]) {
+					heap.push_back({other.columnIdx[other.rowIdx[k]], other.rowIdx[k], jA});
+				}
+			}
+			std::make_heap(heap.begin(), heap.end(), greaterColumn);
+
+			const index rowBegin = columns.size();
+			while (!heap.empty()) {
+				std::pop_heap(heap.begin(), heap.end(), greaterColumn);
+				RowCursor& cursor = heap.back();
+				const double product = nonZeros[cursor.leftEntry] * other.nonZeros[cursor.position];
+				if (columns.size() > rowBegin && columns.back() == cursor.column) {
+					values.back() += product;
+				} else {
+					columns.push_back(cursor.column);
+					values.push_back(product);
+				}
+
+				const index k = columnIdx[cursor.leftEntry];
+				if (++cursor.position < other.rowIdx[k+1]) {
+					cursor.column = other.columnIdx[cursor.position];
+					std::push_heap(heap.begin(), heap.end(), greaterColumn);
+				} else {
+					heap.pop_back();
+				}
+			}
+		} else {
+			RowHashAccumulator& hash = workspace.hash;
+			hash.reset(std::min(rowFlops, other.nCols));
+			for (index jA = rowIdx[i]; jA < rowIdx[i+1]; ++jA) {
+				const index k = columnIdx[jA];
+				const double valA = nonZeros[jA];
 				for (index jB = other.rowIdx[k]; jB < other.rowIdx[k+1]; ++jB) {
-					index j = other.columnIdx[jB];
-					double valB = other.nonZeros[jB];
-
-					if (marker[j] < (int64_t) rowBegin) {
-						marker[j] = rowEnd;
-						columnIdx[rowEnd] = j;
-						nonZeros[rowEnd] = valA * valB;
-						++rowEnd;
-					} else {
-						nonZeros[marker[j]] += valA * valB;
-					}
+					hash.add(other.columnIdx[jB], valA * other.nonZeros[jB]);
 				}
 			}
+			hash.extract(columns, values, sortedResult);
 		}
-	}
+	});
+}
 
-	CSRMatrix result(numberOfRows(), other.numberOfColumns(), rowIdx, columnIdx, nonZeros);
-	if (sorted() && other.sorted()) result.sort();
-	return result;
+CSRMatrix CSRMatrix::maskedMultiply(const CSRMatrix &A, const CSRMatrix &B, const CSRMatrix &mask) {
+	assert(A.nCols == B.nRows);
+	assert(mask.nRows == A.nRows && mask.nCols == B.nCols);
+
+	const std::vector<index> flops = productFlops(A, B);
+	return balancedProduct(A.nRows, B.nCols, flops, mask.sorted(), [&](index i, ProductWorkspace& workspace, std::vector<index>& columns, std::vector<double>& values) {
+		if (flops[i+1] == flops[i] || mask.rowIdx[i+1] == mask.rowIdx[i]) return;
+
+		RowHashAccumulator& hash = workspace.hash;
+		hash.reset(mask.nnzInRow(i));
+		for (index jM = mask.rowIdx[i]; jM < mask.rowIdx[i+1]; ++jM) {
+			hash.insert(mask.columnIdx[jM]);
+		}
+		for (index jA = A.rowIdx[i]; jA < A.rowIdx[i+1]; ++jA) {
+			const index k = A.columnIdx[jA];
+			const double valA = A.nonZeros[jA];
+			for (index jB = B.rowIdx[k]; jB < B.rowIdx[k+1]; ++jB) {
+				hash.addIfPresent(B.columnIdx[jB], valA * B.nonZeros[jB]);
+			}
+		}
+
+		// entries in the order of the mask, only those that received a product
+		for (index jM = mask.rowIdx[i]; jM < mask.rowIdx[i+1]; ++jM) {
+			double value;
+			if (hash.lookup(mask.columnIdx[jM], value)) {
+				columns.push_back(mask.columnIdx[jM]);
+				values.push_back(value);
+			}
+		}
+		hash.clear();
+	});
 }
 
 CSRMatrix CSRMatrix::operator/(const double &divisor) const {
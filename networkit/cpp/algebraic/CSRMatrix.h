@@ -34,6 +34,12 @@ private:
 	bool isSorted;
 	double zero;
 
+	/**
+	 * Rows of a product with at most this many nonzeros in the left factor are computed by merging the
+	 * rows of the right factor in a heap instead of accumulating them in a hash table.
+	 */
+	static const count heapRowThreshold;
+
 	/**
 	 * Quicksort algorithm on columnIdx between [@a left, @a right].
 	 * @param left
@@ -122,6 +128,19 @@ public:
 	 */
 	CSRMatrix(const count nRows, const count nCols, const std::vector<index>& rowIdx, const std::vector<index>& columnIdx, const std::vector<double>& nonZeros, const double zero = 0.0, bool isSorted = false);
 
+	/**
+	 * Constructs the @a nRows x @a nCols Matrix from the CSR vectors @a rowIdx, @a columnIdx and @a nonZeros, which are
+	 * moved into the matrix instead of being copied.
+	 * @param nRows Defines how many rows this matrix has.
+	 * @param nCols Defines how many columns this matrix has.
+	 * @param rowIdx The rowIdx vector of the CSR format.
+	 * @param columnIdx The columnIdx vector of the CSR format.
+	 * @param nonZeros The nonZero vector of the CSR format. Should be as long as the @a columnIdx vector.
+	 * @param zero The zero element (default is 0.0).
+	 * @param isSorted True, if the column indices are sorted in every row. Default is false.
+	 */
+	CSRMatrix(const count nRows, const count nCols, std::vector<index>&& rowIdx, std::vector<index>&& columnIdx, std::vector<double>&& nonZeros, const double zero = 0.0, bool isSorted = false);
+
 	/** Default copy constructor */
 	CSRMatrix (const CSRMatrix &other) = default;
 
@@ -197,6 +216,20 @@ public:
 	 */
 	count nnz() const;
 
+	/**
+	 * @return The inner product of row @a i with the dense vector @a x, i.e. entry @a i of this matrix times @a x.
+	 * @note @a x must hold at least numberOfColumns() values.
+	 */
+	inline double rowDot(const index i, const double* x) const {
+		const index end = rowIdx[i+1];
+		double sum = 0.0;
+#pragma omp simd reduction(+:sum)
+		for (index k = rowIdx[i]; k < end; ++k) {
+			sum += nonZeros[k] * x[columnIdx[k]];
+		}
+		return sum;
+	}
+
 	/**
 	 * @return Value at matrix position (i,j).
 	 */
@@ -277,7 +310,10 @@ public:
 	Vector operator*(const Vector &vector) const;
 
 	/**
-	 * Multiplies this matrix with @a other and returns the result in a new matrix.
+	 * Multiplies this matrix with @a other and returns the result in a new matrix. The rows are distributed over
+	 * the threads by the number of scalar products they need, so that a few dense rows do not dominate a single
+	 * thread. Short rows are computed by a heap merge of the rows of @a other if @a other is sorted, all others by
+	 * a hash table accumulator.
 	 * @return The result of multiplying this matrix with @a other.
 	 */
 	CSRMatrix operator*(const CSRMatrix &other) const;
@@ -304,6 +340,18 @@ public:
 	 */
 	template<typename L> static CSRMatrix binaryOperator(const CSRMatrix &A, const CSRMatrix &B, L binaryOp);
 
+	/**
+	 * Computes the masked product C<M> = @a A * @a B, i.e. the entries of @a A * @a B at the positions of the
+	 * nonzeros of @a mask. All other entries of the product are neither computed nor stored, the values of
+	 * @a mask are ignored. The result is sorted if @a mask is sorted.
+	 * @param A
+	 * @param B
+	 * @param mask
+	 * @return The masked product of @a A and @a B.
+	 * @note @a mask must have the dimensions of @a A * @a B.
+	 */
+	static CSRMatrix maskedMultiply(const CSRMatrix &A, const CSRMatrix &B, const CSRMatrix &mask);
+
 	/**
 	 * Computes @a A^T * @a B.
 	 * @param A
@@ -8,11 +8,14 @@
 #ifndef NETWORKIT_CPP_ALGEBRAIC_GRAPHBLAS_H_
 #define NETWORKIT_CPP_ALGEBRAIC_GRAPHBLAS_H_
 
+#include <cstdint>
 #include <limits>
+#include <omp.h>
 #include "Semirings.h"
 #include "SparseAccumulator.h"
 #include "AlgebraicGlobals.h"
 #include "Vector.h"
+#include "CSRMatrix.h"
 
 /**
  * @ingroup algebraic
@@ -188,6 +191,84 @@ void MxM(const Matrix& A, const Matrix& B, Matrix& C, F accum) {
 	C = eWiseBinOp<SemiRing, Matrix>(C, temp, accum);
 }
 
+/**
+ * Computes the masked matrix-matrix multiplication for arbitrary Semirings and matrix types, see maskedMxM.
+ */
+template<class SemiRing, class Matrix>
+struct MaskedMxM {
+	static Matrix multiply(const Matrix& A, const Matrix& B, const Matrix& M) {
+		std::vector<std::vector<NetworKit::Triplet>> triplets(omp_get_max_threads());
+#pragma omp parallel
+		{
+			// state of a column in the current row: 0 = not in the mask, 1 = in the mask, 2 = also hit by A * B
+			std::vector<uint8_t> state(B.numberOfColumns(), 0);
+			std::vector<double> row(B.numberOfColumns(), SemiRing::zero());
+			std::vector<NetworKit::Triplet>& local = triplets[omp_get_thread_num()];
+
+#pragma omp for schedule(dynamic, 64)
+			for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
+				M.forNonZeroElementsInRow(i, [&](NetworKit::index j, double) {
+					state[j] = 1;
+				});
+
+				A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
+					B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
+						if (state[j] != 0) {
+							row[j] = state[j] == 1? SemiRing::mult(w1,w2) : SemiRing::add(row[j], SemiRing::mult(w1,w2));
+							state[j] = 2;
+						}
+					});
+				});
+
+				M.forNonZeroElementsInRow(i, [&](NetworKit::index j, double) {
+					if (state[j] == 2) {
+						local.push_back({i,j,row[j]});
+					}
+					state[j] = 0;
+					row[j] = SemiRing::zero();
+				});
+			}
+		}
+
+		std::vector<NetworKit::Triplet> result;
+		for (const auto& local : triplets) {
+			result.insert(result.end(), local.begin(), local.end());
+		}
+		return Matrix(A.numberOfRows(), B.numberOfColumns(), result, A.getZero());
+	}
+};
+
+/**
+ * The arithmetic masked product of CSRMatrices uses the flop-balanced kernel of CSRMatrix.
+ */
+template<>
+struct MaskedMxM<ArithmeticSemiring, NetworKit::CSRMatrix> {
+	static NetworKit::CSRMatrix multiply(const NetworKit::CSRMatrix& A, const NetworKit::CSRMatrix& B, const NetworKit::CSRMatrix& M) {
+		return NetworKit::CSRMatrix::maskedMultiply(A, B, M);
+	}
+};
+
+/**
+ * Computes the masked matrix-matrix multiplication C<M> = A * B, i.e. only the entries (i,j) of A * B where the
+ * mask @a M has a nonzero are computed, all other entries of the result are zero. The values of @a M are ignored.
+ * This skips all work for the entries of the product that are not needed, e.g. triangle counting only needs A * A
+ * at the nonzeros of A. Note that A.numberOfColumns() must be equal to B.numberOfRows(), that @a M must have the
+ * dimensions of the product and that the zero elements must be the same. The default Semiring is the
+ * ArithmeticSemiring.
+ * @param A
+ * @param B
+ * @param M
+ * @return The masked product of @a A and @a B.
+ */
+template<class SemiRing = ArithmeticSemiring, class Matrix>
+Matrix maskedMxM(const Matrix& A, const Matrix& B, const Matrix& M) {
+	assert(A.numberOfColumns() == B.numberOfRows());
+	assert(M.numberOfRows() == A.numberOfRows() && M.numberOfColumns() == B.numberOfColumns());
+	assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero());
+
+	return MaskedMxM<SemiRing, Matrix>::multiply(A, B, M);
+}
+
 /**
  * Computes the matrix-vector product of matrix @a A and Vector @a v. The default Semiring is the ArithmeticSemiring.
  * @param A
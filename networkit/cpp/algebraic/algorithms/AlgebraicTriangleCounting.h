@@ -9,6 +9,7 @@
 #define NETWORKIT_CPP_ALGEBRAIC_ALGORITHMS_ALGEBRAICTRIANGLECOUNTING_H_
 
 #include "../../base/Algorithm.h"
+#include "../GraphBLAS.h"
 
 namespace NetworKit {
 
@@ -60,14 +61,18 @@ private:
 
 template<class Matrix>
 void AlgebraicTriangleCounting<Matrix>::run() {
-	Matrix powA = A * A * A;
+	// only the diagonal of A^3 is needed and A^3(i,i) = sum_j (A*A)(i,j) * A(j,i), so A*A is computed at the nonzeros of A^T
+	const Matrix AT = directed? A.transpose() : Matrix();
+	const Matrix& mask = directed? AT : A;
+	Matrix paths = GraphBLAS::maskedMxM(A, A, mask);
+	NetworKit::Vector closedPaths = GraphBLAS::rowReduce(GraphBLAS::eWiseMult(paths, mask));
 
 	nodeScores.clear();
 	nodeScores.resize(A.numberOfRows(), 0);
 
 #pragma omp parallel for
-	for (index i = 0; i < powA.numberOfRows(); ++i) {
-		nodeScores[i] = directed? powA(i,i) : powA(i,i) / 2.0;
+	for (index i = 0; i < A.numberOfRows(); ++i) {
+		nodeScores[i] = directed? closedPaths[i] : closedPaths[i] / 2.0;
 	}
 
 	hasRun = true;
@@ -0,0 +1,172 @@
+/*
+ * PowerIteration.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "PowerIteration.h"
+#include "../../auxiliary/SignalHandling.h"
+
+namespace NetworKit {
+
+const count PowerIteration::blockSize = 1 << 14;
+
+PowerIteration::PowerIteration(const CSRMatrix& A, double scale, double diagonal, double shift, bool normalize) :
+	A(A), scale(scale), diagonal(diagonal), shift(shift), normalize(normalize), residual(std::numeric_limits<double>::max()) {
+	if (A.numberOfRows() != A.numberOfColumns()) {
+		throw std::runtime_error("power iteration needs a square matrix");
+	}
+
+	// a block ends as soon as its rows and non-zeros exceed blockSize, rows count as well since empty rows are written too
+	std::vector<std::pair<count, std::pair<index, index>>> weightedBlocks;
+	const count n = A.numberOfRows();
+	index begin = 0;
+	count work = 0;
+	for (index i = 0; i < n; ++i) {
+		work += A.nnzInRow(i) + 1;
+		if (work >= blockSize || i + 1 == n) {
+			weightedBlocks.push_back({work, {begin, i + 1}});
+			begin = i + 1;
+			work = 0;
+		}
+	}
+	std::stable_sort(weightedBlocks.begin(), weightedBlocks.end(), [](const std::pair<count, std::pair<index, index>>& a, const std::pair<count, std::pair<index, index>>& b) {
+		return a.first > b.first;
+	});
+	blocks.reserve(weightedBlocks.size());
+	for (const auto& block : weightedBlocks) {
+		blocks.push_back(block.second);
+	}
+}
+
+count PowerIteration::run(std::vector<double>& x, double tol, Norm norm, count maxIterations) {
+	const count n = A.numberOfRows();
+	if (x.size() != n) {
+		throw std::runtime_error("dimension of the start vector does not match the matrix");
+	}
+	if (n == 0) {
+		residual = 0.0;
+		return 0;
+	}
+	Aux::SignalHandler handler;
+	next.resize(n);
+
+	// the current iterate is x * invLength, normalization is applied lazily by the next product
+	double invLength = 1.0;
+	count iterations = 0;
+	residual = std::numeric_limits<double>::max();
+
+	while (residual > tol && iterations < maxIterations) {
+		handler.assureRunning();
+		const double a = scale * invLength;
+		const double d = diagonal * invLength;
+		const double* current = x.data();
+		double* result = next.data();
+		double sumAbs = 0.0;
+		double sumSquares = 0.0;
+		double maxAbs = 0.0;
+		double lengthSquared = 0.0;
+
+		#pragma omp parallel for schedule(dynamic, 1) reduction(+:sumAbs,sumSquares,lengthSquared) reduction(max:maxAbs)
+		for (index b = 0; b < blocks.size(); ++b) {
+			const index end = blocks[b].second;
+			for (index i = blocks[b].first; i < end; ++i) {
+				const double y = a * A.rowDot(i, current) + d * current[i] + shift;
+				result[i] = y;
+				if (normalize) {
+					lengthSquared += y * y;
+				} else {
+					const double diff = std::fabs(y - current[i]);
+					sumAbs += diff;
+					sumSquares += diff * diff;
+					maxAbs = std::max(maxAbs, diff);
+				}
+			}
+		}
+
+		if (normalize) {
+			if (lengthSquared == 0.0) {
+				throw std::runtime_error("power iteration reached the zero vector");
+			}
+			const double nextInvLength = 1.0 / std::sqrt(lengthSquared);
+			#pragma omp parallel for reduction(+:sumAbs,sumSquares) reduction(max:maxAbs)
+			for (index i = 0; i < n; ++i) {
+				const double diff = std::fabs(result[i] * nextInvLength - current[i] * invLength);
+				sumAbs += diff;
+				sumSquares += diff * diff;
+				maxAbs = std::max(maxAbs, diff);
+			}
+			invLength = nextInvLength;
+		}
+
+		std::swap(x, next);
+		++iterations;
+		switch (norm) {
+		case L1: residual = sumAbs; break;
+		case L2: residual = std::sqrt(sumSquares); break;
+		case MAX: residual = maxAbs; break;
+		}
+	}
+
+	if (invLength != 1.0) {
+		#pragma omp parallel for
+		for (index i = 0; i < n; ++i) {
+			x[i] *= invLength;
+		}
+	}
+	return iterations;
+}
+
+CSRMatrix PowerIteration::inEdgeMatrix(const Graph& G, std::vector<node>& rowNodes, const std::vector<double>& columnScale) {
+	const count z = G.upperNodeIdBound();
+	rowNodes.clear();
+	rowNodes.reserve(G.numberOfNodes());
+	G.forNodes([&](node u) {
+		rowNodes.push_back(u);
+	});
+	const count n = rowNodes.size();
+
+	// node ids only have to be renumbered if there are deleted nodes
+	const bool compact = n != z;
+	std::vector<index> rowOfNode;
+	if (compact) {
+		rowOfNode.assign(z, none);
+		for (index r = 0; r < n; ++r) {
+			rowOfNode[rowNodes[r]] = r;
+		}
+	}
+
+	std::vector<index> rowIdx(n + 1, 0);
+	#pragma omp parallel for
+	for (index r = 0; r < n; ++r) {
+		rowIdx[r + 1] = G.degreeIn(rowNodes[r]);
+	}
+	for (index r = 0; r < n; ++r) {
+		rowIdx[r + 1] += rowIdx[r];
+	}
+
+	const bool scaled = !columnScale.empty();
+	std::vector<index> columnIdx(rowIdx[n]);
+	std::vector<double> nonZeros(rowIdx[n]);
+	#pragma omp parallel for schedule(guided)
+	for (index r = 0; r < n; ++r) {
+		index k = rowIdx[r];
+		G.forInEdgesOf(rowNodes[r], [&](node, node v, edgeweight w) {
+			columnIdx[k] = compact ? rowOfNode[v] : v;
+			nonZeros[k] = scaled ? w * columnScale[v] : w;
+			++k;
+		});
+		assert(k == rowIdx[r + 1]);
+	}
+
+	return CSRMatrix(n, n, std::move(rowIdx), std::move(columnIdx), std::move(nonZeros));
+}
+
+} /* namespace NetworKit */
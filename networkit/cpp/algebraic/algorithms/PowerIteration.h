@@ -0,0 +1,92 @@
+/*
+ * PowerIteration.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef NETWORKIT_CPP_ALGEBRAIC_ALGORITHMS_POWERITERATION_H_
+#define NETWORKIT_CPP_ALGEBRAIC_ALGORITHMS_POWERITERATION_H_
+
+#include <vector>
+#include <utility>
+
+#include "../../Globals.h"
+#include "../../graph/Graph.h"
+#include "../CSRMatrix.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup algebraic
+ * Power iteration x <- scale * A * x + diagonal * x + shift on a CSRMatrix @a A, optionally followed by
+ * normalization to unit 2-norm. This is the common core of PageRank, Katz and eigenvector centrality.
+ *
+ * One iteration is a single pass over the non-zeros of @a A: the result is written into a second buffer
+ * which is swapped with the current vector afterwards, and the difference to the previous iterate is
+ * accumulated in the same pass. When normalizing, the division by the length is not applied to the vector
+ * but folded into the scale of the next iteration. The rows are cut into blocks of consecutive rows with
+ * about the same number of non-zeros, so that the writes of a block stay in cache, and the blocks are
+ * scheduled heaviest first, so that blocks of high-degree rows do not end up at the tail of an iteration.
+ */
+class PowerIteration final {
+
+public:
+	/** Norm of the difference of two successive iterates that is compared to the tolerance. */
+	enum Norm {
+		L1,
+		L2,
+		MAX
+	};
+
+	/** Upper bound on the number of non-zeros (and rows) per block. */
+	static const count blockSize;
+
+	/**
+	 * Prepares the power iteration on the square matrix @a A, which must outlive this object.
+	 * @param A The iteration matrix.
+	 * @param scale Factor of the matrix-vector product.
+	 * @param diagonal Factor of the previous iterate that is added, i.e. the iteration matrix is scale * A + diagonal * I.
+	 * @param shift Constant added to every entry.
+	 * @param normalize If true, every iterate is normalized to unit 2-norm.
+	 */
+	PowerIteration(const CSRMatrix& A, double scale = 1.0, double diagonal = 0.0, double shift = 0.0, bool normalize = false);
+
+	/**
+	 * Iterates starting from @a x until the difference of two successive iterates in norm @a norm is at most @a tol,
+	 * or until @a maxIterations iterations have been done. @a x is replaced by the last iterate.
+	 * @return The number of iterations.
+	 */
+	count run(std::vector<double>& x, double tol, Norm norm = L2, count maxIterations = none);
+
+	/**
+	 * @return The difference of the last two iterates of run() in the requested norm.
+	 */
+	double getResidual() const {
+		return residual;
+	}
+
+	/**
+	 * Builds the matrix whose row for node u holds the in-edges (v, u) of @a G, weighted by w(v, u) * columnScale[v],
+	 * i.e. the transposed adjacency matrix. The rows are numbered consecutively over the existing nodes of @a G, and
+	 * @a rowNodes receives the node of every row.
+	 * @param G The graph.
+	 * @param rowNodes Receives the node of every row (and column).
+	 * @param columnScale Factor per node id applied to its out-edges, all ones if empty.
+	 */
+	static CSRMatrix inEdgeMatrix(const Graph& G, std::vector<node>& rowNodes, const std::vector<double>& columnScale = std::vector<double>());
+
+private:
+	const CSRMatrix& A;
+	double scale;
+	double diagonal;
+	double shift;
+	bool normalize;
+	double residual;
+	std::vector<std::pair<index, index>> blocks;
+	std::vector<double> next;
+};
+
+} /* namespace NetworKit */
+
+#endif /* NETWORKIT_CPP_ALGEBRAIC_ALGORITHMS_POWERITERATION_H_ */
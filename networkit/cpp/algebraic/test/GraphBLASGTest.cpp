@@ -7,6 +7,7 @@
 
 #include "GraphBLASGTest.h"
 #include "../CSRMatrix.h"
+#include "../DynamicMatrix.h"
 #include <iostream>
 namespace NetworKit {
 
@@ -169,6 +170,55 @@ TEST_F(GraphBLASGTest, testMxMAccum) {
 	EXPECT_EQ(17, C(3,3));
 }
 
+TEST_F(GraphBLASGTest, testMaskedMxM) {
+	std::vector<Triplet> triplets = {{0,0,1}, {0,1,2}, {0,2,3}, {1,0,2}, {1,1,2}, {2,0,3}, {2,2,3}, {2,3,-1}, {3,2,-1}, {3,3,4}};
+	std::vector<Triplet> maskTriplets = {{0,0,5}, {0,3,5}, {1,3,5}, {2,2,5}, {3,1,5}};
+
+	//
+	//				 1  2  3  0
+	// 				 2  2  0  0
+	// mat1 = mat2 = 3  0  3 -1
+	//				 0  0 -1  4
+	//
+	CSRMatrix mat1(4, triplets);
+	CSRMatrix mat2(4, triplets);
+	CSRMatrix mask(4, maskTriplets);
+
+	//
+	//			14  0   0  -3
+	//			 0  0   0   0
+	// result =  0  0  19   0
+	//			 0  0   0   0
+	//
+	CSRMatrix result = GraphBLAS::maskedMxM(mat1, mat2, mask);
+	EXPECT_EQ(3u, result.nnz());
+	EXPECT_EQ(14, result(0,0));
+	EXPECT_EQ(-3, result(0,3));
+	EXPECT_EQ(19, result(2,2));
+	EXPECT_EQ(0, result(1,3));
+	EXPECT_EQ(0, result(3,1));
+
+	DynamicMatrix dynamicResult = GraphBLAS::maskedMxM(DynamicMatrix(4, triplets), DynamicMatrix(4, triplets), DynamicMatrix(4, maskTriplets));
+	EXPECT_EQ(3u, dynamicResult.nnz());
+	EXPECT_EQ(14, dynamicResult(0,0));
+	EXPECT_EQ(-3, dynamicResult(0,3));
+	EXPECT_EQ(19, dynamicResult(2,2));
+
+
+	// max-plus semiring
+	mat1 = CSRMatrix(4, triplets, MaxPlusSemiring::zero());
+	mat2 = CSRMatrix(4, triplets, MaxPlusSemiring::zero());
+	mask = CSRMatrix(4, maskTriplets, MaxPlusSemiring::zero());
+
+	result = GraphBLAS::maskedMxM<MaxPlusSemiring>(mat1, mat2, mask);
+	EXPECT_EQ(3u, result.nnz());
+	EXPECT_EQ(6, result(0,0));
+	EXPECT_EQ(2, result(0,3));
+	EXPECT_EQ(6, result(2,2));
+	EXPECT_EQ(MaxPlusSemiring::zero(), result(1,3));
+	EXPECT_EQ(MaxPlusSemiring::zero(), result(3,1));
+}
+
 TEST_F(GraphBLASGTest, testMxV) {
 	std::vector<Triplet> triplets;
 
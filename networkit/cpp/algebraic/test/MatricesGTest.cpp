@@ -7,6 +7,9 @@
 
 #include "MatricesGTest.h"
 
+#include <algorithm>
+#include <set>
+
 #include "../CSRMatrix.h"
 #include "../DenseMatrix.h"
 #include "../DynamicMatrix.h"
@@ -100,6 +103,72 @@ TEST_F(MatricesGTest, testBigMatrixMultiplcation) {
 	testBigMatrixMultiplication<CSRMatrix>();
 }
 
+TEST_F(MatricesGTest, testSparseMatrixProductKernels) {
+	// a few hub rows and columns next to many short rows, so that both the heap and the hash kernel are used
+	const count n = 300;
+	std::set<std::pair<index, index>> positions;
+	for (index i = 0; i < n; ++i) {
+		const count entries = i < 3? 200 : 4;
+		for (index e = 0; e < entries; ++e) {
+			positions.insert({i, Aux::Random::integer(n-1)});
+			positions.insert({Aux::Random::integer(n-1), i % 3});
+		}
+	}
+	std::vector<Triplet> triplets;
+	for (auto p : positions) {
+		triplets.push_back({p.first, p.second, Aux::Random::real(-1, 1)});
+	}
+	std::shuffle(triplets.begin(), triplets.end(), Aux::Random::getURNG());
+
+	DynamicMatrix reference = DynamicMatrix(n, triplets) * DynamicMatrix(n, triplets);
+
+	CSRMatrix unsortedA(n, triplets);
+	CSRMatrix sortedA = unsortedA;
+	sortedA.sort();
+	for (const CSRMatrix& A : {unsortedA, sortedA}) {
+		CSRMatrix product = A * A;
+		EXPECT_EQ(A.sorted(), product.sorted());
+		EXPECT_EQ(reference.nnz(), product.nnz());
+		reference.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+			EXPECT_NEAR(value, product(i,j), 1e-9);
+		});
+		if (product.sorted()) {
+			for (index i = 0; i < n; ++i) {
+				index previous = none;
+				product.forNonZeroElementsInRow(i, [&](index j, double) {
+					EXPECT_TRUE(previous == none || previous < j);
+					previous = j;
+				});
+			}
+		}
+	}
+
+	// masked product: exactly the entries of the product at the nonzeros of the mask
+	std::vector<Triplet> maskTriplets;
+	for (index e = 0; e < 5 * n; ++e) {
+		maskTriplets.push_back({Aux::Random::integer(n-1), Aux::Random::integer(n-1), 1.0});
+	}
+	std::sort(maskTriplets.begin(), maskTriplets.end(), [](const Triplet& a, const Triplet& b) {
+		return a.row < b.row || (a.row == b.row && a.column < b.column);
+	});
+	maskTriplets.erase(std::unique(maskTriplets.begin(), maskTriplets.end(), [](const Triplet& a, const Triplet& b) {
+		return a.row == b.row && a.column == b.column;
+	}), maskTriplets.end());
+	CSRMatrix mask(n, maskTriplets, 0.0, true);
+
+	CSRMatrix masked = CSRMatrix::maskedMultiply(sortedA, unsortedA, mask);
+	EXPECT_TRUE(masked.sorted());
+	count expectedNnz = 0;
+	mask.forNonZeroElementsInRowOrder([&](index i, index j, double) {
+		EXPECT_NEAR(reference(i,j), masked(i,j), 1e-9);
+		if (reference(i,j) != 0.0) ++expectedNnz;
+	});
+	EXPECT_EQ(expectedNnz, masked.nnz());
+	masked.forNonZeroElementsInRowOrder([&](index i, index j, double) {
+		EXPECT_EQ(1.0, mask(i,j));
+	});
+}
+
 TEST_F(MatricesGTest, testAdjacencyMatrixOfGraph) {
 	testAdjacencyMatrix<DynamicMatrix>();
 	testAdjacencyMatrix<CSRMatrix>();
@@ -35,9 +35,10 @@ void BucketPQ::construct(uint64_t capacity) {
 	}
 
 	// init
-	buckets.resize(maxAdmissibleKey-minAdmissibleKey+1);
-	nodePtr.resize(capacity);
-	myBucket.resize(capacity);
+	bucketHead.assign(maxAdmissibleKey-minAdmissibleKey+1, NetworKit::none);
+	next.assign(capacity, NetworKit::none);
+	prev.assign(capacity, NetworKit::none);
+	myBucket.assign(capacity, NetworKit::none);
 	currentMinKey = std::numeric_limits<int64_t>::max();
 	currentMaxKey = std::numeric_limits<int64_t>::min();
 	numElems = 0;
@@ -47,11 +48,19 @@ void BucketPQ::construct(uint64_t capacity) {
 
 void BucketPQ::insert(int64_t key, index value) {
 	assert(minAdmissibleKey <= key && key <= maxAdmissibleKey);
-	assert(0 <= value && value < nodePtr.size());
-
-	buckets[key+offset].push_front(value);
-	nodePtr[value] = buckets[key+offset].begin();
-	myBucket[value] = key+offset;
+	assert(0 <= value && value < myBucket.size());
+	assert(myBucket[value] == NetworKit::none);
+
+	// push to the front of the bucket
+	index b = key+offset;
+	index head = bucketHead[b];
+	next[value] = head;
+	prev[value] = NetworKit::none;
+	if (head != NetworKit::none) {
+		prev[head] = value;
+	}
+	bucketHead[b] = value;
+	myBucket[value] = b;
 	++numElems;
 
 	// bookkeeping
@@ -64,13 +73,20 @@ void BucketPQ::insert(int64_t key, index value) {
 }
 
 void BucketPQ::remove(const index& value) {
-	assert(0 <= value && value < nodePtr.size());
-
-	if (myBucket[value] != none) {
-		// remove from appropriate bucket
-		index key = myBucket[value];
-		buckets[key].erase(nodePtr[value]);
-		myBucket[value] = none;
+	assert(0 <= value && value < myBucket.size());
+
+	if (myBucket[value] != NetworKit::none) {
+		// unlink from appropriate bucket
+		index b = myBucket[value];
+		if (prev[value] != NetworKit::none) {
+			next[prev[value]] = next[value];
+		} else {
+			bucketHead[b] = next[value];
+		}
+		if (next[value] != NetworKit::none) {
+			prev[next[value]] = prev[value];
+		}
+		myBucket[value] = NetworKit::none;
 		--numElems;
 
 		if (size() == 0) {
@@ -80,12 +96,12 @@ void BucketPQ::remove(const index& value) {
 		}
 		else {
 			// adjust max pointer if necessary
-			while (buckets[currentMaxKey+offset].empty() && currentMaxKey > currentMinKey) {
+			while (bucketHead[currentMaxKey+offset] == NetworKit::none && currentMaxKey > currentMinKey) {
 				--currentMaxKey;
 			}
 
 			// adjust min pointer if necessary
-			while (buckets[currentMinKey+offset].empty() && currentMinKey < currentMaxKey) {
+			while (bucketHead[currentMinKey+offset] == NetworKit::none && currentMinKey < currentMaxKey) {
 				++currentMinKey;
 			}
 		}
@@ -97,8 +113,8 @@ std::pair<int64_t, index> BucketPQ::extractMin() {
 		return std::make_pair(none, NetworKit::none);
 	}
 	else {
-		assert(! buckets[currentMinKey+offset].empty());
-		index result = buckets[currentMinKey+offset].front();
+		assert(bucketHead[currentMinKey+offset] != NetworKit::none);
+		index result = bucketHead[currentMinKey+offset];
 
 		// store currentMinKey because remove(result) will change it
 		int64_t oldMinKey = currentMinKey;
@@ -11,14 +11,12 @@
 #include "Log.h"
 #include "../Globals.h"
 #include "PrioQueue.h"
-#include <list>
 #include <limits>
 
 namespace Aux {
 
 typedef NetworKit::index index;
 typedef NetworKit::count count;
-typedef std::list<index> Bucket;
 constexpr int64_t none = std::numeric_limits<int64_t>::max();
 
 /**
@@ -27,12 +25,16 @@ constexpr int64_t none = std::numeric_limits<int64_t>::max();
  * minPrio and maxPrio can be positive or negative, respectively with
  * the obvious constraint minPrio <= maxPrio.
  * Amortized constant running time for each operation.
+ *
+ * The buckets are doubly linked lists threaded through arrays indexed by value,
+ * so no memory is allocated after construction.
  */
 class BucketPQ: public PrioQueue<int64_t, index> {
 private:
-	std::vector<Bucket> buckets;			// the actual buckets
-	std::vector<Bucket::iterator> nodePtr;	// keeps track of node positions
-	std::vector<index> myBucket;			// keeps track of current bucket for each value
+	std::vector<index> bucketHead;			// first value of each bucket, NetworKit::none if empty
+	std::vector<index> next;				// successor of each value in its bucket
+	std::vector<index> prev;				// predecessor of each value in its bucket
+	std::vector<index> myBucket;			// keeps track of current bucket for each value, NetworKit::none if not stored
 	int64_t currentMinKey;					// current min key
 	int64_t currentMaxKey;					// current max key
 	int64_t minAdmissibleKey;				// minimum admissible key
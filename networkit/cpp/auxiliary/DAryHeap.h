@@ -0,0 +1,281 @@
+/*
+ * DAryHeap.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef DARYHEAP_H_
+#define DARYHEAP_H_
+
+#include <algorithm>
+#include <vector>
+#include <set>
+#include <limits>
+#include <cassert>
+
+#include "PrioQueue.h"
+
+namespace Aux {
+
+/**
+ * Addressable d-ary min-heap with extract-min and change-key, a drop-in
+ * replacement for PrioQueue without the node allocations and rebalancing
+ * of the underlying std::set.
+ * The type Value takes on integer values between 0 and n-1, the position of
+ * every value in the heap array is tracked so that changeKey and remove
+ * take O(d log_d n) time. Elements are ordered by (key, value) just as in
+ * PrioQueue, so both queues extract elements in exactly the same order.
+ */
+template<class Key, class Value, unsigned arity = 4>
+class DAryHeap final : public PrioQueue<Key, Value> {
+	static_assert(arity >= 2, "a d-ary heap needs at least two children per node");
+
+private:
+	typedef std::pair<Key, Value> ElemType;
+	static constexpr uint64_t absent = std::numeric_limits<uint64_t>::max();
+
+	std::vector<ElemType> heap;
+	std::vector<uint64_t> position; // position[v] is the index of value v in heap or absent
+
+	inline void place(uint64_t i, const ElemType& elem) {
+		heap[i] = elem;
+		position[elem.second] = i;
+	}
+
+	void siftUp(uint64_t i);
+	void siftDown(uint64_t i);
+
+	/**
+	 * Restores the heap property at position @a i after its key has changed.
+	 */
+	inline void repair(uint64_t i) {
+		if (i > 0 && heap[i] < heap[(i - 1) / arity]) {
+			siftUp(i);
+		} else {
+			siftDown(i);
+		}
+	}
+
+protected:
+	/**
+	 * Removes key-value pair given by @a elem.
+	 */
+	void remove(const ElemType& elem) override {
+		remove(elem.second);
+	}
+
+	/**
+	 * @return current content of queue
+	 */
+	std::set<ElemType> content() const override {
+		return std::set<ElemType>(heap.begin(), heap.end());
+	}
+
+public:
+	/**
+	 * Builds priority queue from the vector @a keys, values are indices
+	 * of @a keys. Takes linear time.
+	 */
+	DAryHeap(const std::vector<Key>& keys);
+
+	/**
+	 * Builds priority queue of the specified capacity @a capacity.
+	 */
+	DAryHeap(uint64_t capacity);
+
+	/**
+	 * Inserts key-value pair. If @a value is already contained, its key is changed instead.
+	 */
+	void insert(Key key, Value value) override;
+
+	/**
+	 * Removes the element with minimum key and returns it.
+	 */
+	ElemType extractMin() override;
+
+	/**
+	 * @return The element with minimum key without removing it.
+	 */
+	const ElemType& peekMin() const {
+		assert(!heap.empty());
+		return heap.front();
+	}
+
+	/**
+	 * Modifies entry with value @a value.
+	 * The entry is then set to @a newKey with the same value.
+	 * If the corresponding key is not present, the element will be inserted.
+	 */
+	void changeKey(Key newKey, Value value) override;
+
+	/**
+	 * @return Number of elements in PQ.
+	 */
+	uint64_t size() const override {
+		return heap.size();
+	}
+
+	/**
+	 * @return True if the PQ is empty.
+	 */
+	bool empty() const {
+		return heap.empty();
+	}
+
+	/**
+	 * @return True if @a value is contained in the PQ.
+	 */
+	bool contains(const Value& value) const {
+		return value < position.size() && position[value] != absent;
+	}
+
+	/**
+	 * Removes all elements, keeps the capacity.
+	 */
+	void clear();
+
+	/**
+	 * Removes key-value pair given by value @a val. Does nothing if @a val is not contained.
+	 */
+	void remove(const Value& val) override;
+
+	/**
+	 * DEBUGGING
+	 */
+	void print() override {
+		DEBUG("num entries: ", heap.size());
+		for (auto& elem : heap) {
+			(void)elem; // prevent unused variable warning
+			DEBUG("key: ", elem.first, ", val: ", elem.second, "\n");
+		}
+	}
+};
+
+
+template<class Key, class Value, unsigned arity>
+constexpr uint64_t DAryHeap<Key, Value, arity>::absent;
+
+template<class Key, class Value, unsigned arity>
+DAryHeap<Key, Value, arity>::DAryHeap(const std::vector<Key>& keys) : position(keys.size()) {
+	heap.reserve(keys.size());
+	for (uint64_t i = 0; i < keys.size(); ++i) {
+		heap.emplace_back(keys[i], i);
+		position[i] = i;
+	}
+	// bottom-up heap construction
+	if (heap.size() > 1) {
+		for (uint64_t i = (heap.size() - 2) / arity + 1; i-- > 0; ) {
+			siftDown(i);
+		}
+	}
+}
+
+template<class Key, class Value, unsigned arity>
+DAryHeap<Key, Value, arity>::DAryHeap(uint64_t capacity) : position(capacity, absent) {
+	heap.reserve(capacity);
+}
+
+template<class Key, class Value, unsigned arity>
+void DAryHeap<Key, Value, arity>::siftUp(uint64_t i) {
+	ElemType elem = heap[i];
+	while (i > 0) {
+		uint64_t parent = (i - 1) / arity;
+		if (!(elem < heap[parent])) {
+			break;
+		}
+		place(i, heap[parent]);
+		i = parent;
+	}
+	place(i, elem);
+}
+
+template<class Key, class Value, unsigned arity>
+void DAryHeap<Key, Value, arity>::siftDown(uint64_t i) {
+	const uint64_t n = heap.size();
+	ElemType elem = heap[i];
+	while (true) {
+		uint64_t first = arity * i + 1;
+		if (first >= n) {
+			break;
+		}
+		uint64_t last = std::min(first + arity, n);
+		uint64_t best = first;
+		for (uint64_t c = first + 1; c < last; ++c) {
+			if (heap[c] < heap[best]) {
+				best = c;
+			}
+		}
+		if (!(heap[best] < elem)) {
+			break;
+		}
+		place(i, heap[best]);
+		i = best;
+	}
+	place(i, elem);
+}
+
+template<class Key, class Value, unsigned arity>
+inline void DAryHeap<Key, Value, arity>::insert(Key key, Value value) {
+	if (value >= position.size()) {
+		position.resize(std::max<uint64_t>(2 * position.size(), value + 1), absent);
+	}
+	if (position[value] != absent) {
+		changeKey(key, value);
+		return;
+	}
+	heap.emplace_back(key, value);
+	position[value] = heap.size() - 1;
+	siftUp(heap.size() - 1);
+}
+
+template<class Key, class Value, unsigned arity>
+std::pair<Key, Value> DAryHeap<Key, Value, arity>::extractMin() {
+	assert(heap.size() > 0);
+	ElemType elem = heap.front();
+	position[elem.second] = absent;
+	ElemType back = heap.back();
+	heap.pop_back();
+	if (!heap.empty()) {
+		place(0, back);
+		siftDown(0);
+	}
+	return elem;
+}
+
+template<class Key, class Value, unsigned arity>
+inline void DAryHeap<Key, Value, arity>::changeKey(Key newKey, Value value) {
+	if (!contains(value)) {
+		insert(newKey, value);
+		return;
+	}
+	uint64_t i = position[value];
+	heap[i].first = newKey;
+	repair(i);
+}
+
+template<class Key, class Value, unsigned arity>
+inline void DAryHeap<Key, Value, arity>::remove(const Value& val) {
+	if (!contains(val)) {
+		return;
+	}
+	uint64_t i = position[val];
+	position[val] = absent;
+	ElemType back = heap.back();
+	heap.pop_back();
+	if (i < heap.size()) {
+		place(i, back);
+		repair(i);
+	}
+}
+
+template<class Key, class Value, unsigned arity>
+void DAryHeap<Key, Value, arity>::clear() {
+	for (auto& elem : heap) {
+		position[elem.second] = absent;
+	}
+	heap.clear();
+}
+
+} /* namespace Aux */
+#endif /* DARYHEAP_H_ */
@@ -0,0 +1,53 @@
+/*
+ * MemoryMappedFile.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "MemoryMappedFile.h"
+
+namespace Aux {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path) : begin(nullptr), length(0) {
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		throw std::runtime_error("unable to open file " + path);
+	}
+	struct stat info;
+	if (fstat(fd, &info) != 0) {
+		close(fd);
+		throw std::runtime_error("unable to determine the size of file " + path);
+	}
+	length = info.st_size;
+	if (length > 0) {
+		void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapped == MAP_FAILED) {
+			close(fd);
+			throw std::runtime_error("unable to map file " + path);
+		}
+		begin = static_cast<const char*>(mapped);
+	}
+	// the mapping stays valid after the descriptor is closed
+	close(fd);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+	if (begin != nullptr) {
+		munmap(const_cast<char*>(begin), length);
+	}
+}
+
+void MemoryMappedFile::adviseSequential() const {
+	if (begin != nullptr) {
+		madvise(const_cast<char*>(begin), length, MADV_SEQUENTIAL);
+	}
+}
+
+} /* namespace Aux */
@@ -0,0 +1,59 @@
+/*
+ * MemoryMappedFile.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef MEMORYMAPPEDFILE_H_
+#define MEMORYMAPPEDFILE_H_
+
+#include <string>
+#include <cstdint>
+
+namespace Aux {
+
+/**
+ * Read-only memory mapping of a whole file. The pages are loaded lazily by the
+ * operating system when they are first accessed, so mapping even a large file is cheap.
+ * The mapping is released when the object is destroyed.
+ */
+class MemoryMappedFile final {
+
+public:
+	/**
+	 * Maps the file at @a path. Throws std::runtime_error if the file cannot be opened or mapped.
+	 */
+	MemoryMappedFile(const std::string& path);
+
+	~MemoryMappedFile();
+
+	MemoryMappedFile(const MemoryMappedFile&) = delete;
+	MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+	/**
+	 * @return Pointer to the first byte of the file, nullptr for an empty file.
+	 */
+	const char* data() const {
+		return begin;
+	}
+
+	/**
+	 * @return The size of the file in bytes.
+	 */
+	uint64_t size() const {
+		return length;
+	}
+
+	/**
+	 * Advises the operating system that the file will be read sequentially.
+	 */
+	void adviseSequential() const;
+
+private:
+	const char* begin;
+	uint64_t length;
+};
+
+} /* namespace Aux */
+#endif /* MEMORYMAPPEDFILE_H_ */
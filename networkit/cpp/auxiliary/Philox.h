@@ -0,0 +1,136 @@
+/*
+ * Philox.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef PHILOX_H_
+#define PHILOX_H_
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace Aux {
+
+/**
+ * Counter-based random number generator Philox4x32-10 from
+ * Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC 2011.
+ *
+ * The i-th output of the stream @a stream under seed @a seed is a pure function of (seed, stream, i),
+ * so every node, edge or sample of an algorithm can draw from its own stream, and the result does not
+ * depend on the number of threads or on the schedule. Creating a generator costs nothing, skipping
+ * ahead is O(1), and one block of ten rounds of 32 bit multiplications yields two 64 bit outputs.
+ * The class satisfies the requirements of a UniformRandomBitGenerator, so it can also be used with
+ * the distributions of <random>.
+ */
+class Philox final {
+
+public:
+	using result_type = uint64_t;
+
+	/**
+	 * Creates the generator for stream @a stream under seed @a seed, positioned at its first output.
+	 */
+	Philox(uint64_t seed = 0, uint64_t stream = 0) : seed(seed), stream(stream), position(0), cachedBlock(std::numeric_limits<uint64_t>::max()) {
+	}
+
+	static constexpr result_type min() {
+		return 0;
+	}
+
+	static constexpr result_type max() {
+		return std::numeric_limits<result_type>::max();
+	}
+
+	/**
+	 * @return The next 64 random bits.
+	 */
+	result_type operator()() {
+		const uint64_t blockIndex = position >> 1;
+		if (blockIndex != cachedBlock) {
+			output = block({static_cast<uint32_t>(blockIndex), static_cast<uint32_t>(blockIndex >> 32),
+					static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)},
+					{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)});
+			cachedBlock = blockIndex;
+		}
+		const uint64_t i = (position++ & 1) * 2;
+		return (static_cast<uint64_t>(output[i + 1]) << 32) | output[i];
+	}
+
+	/**
+	 * Skips the next @a z outputs in constant time.
+	 */
+	void discard(uint64_t z) {
+		position += z;
+	}
+
+	/**
+	 * @return A double distributed uniformly in [0, 1).
+	 */
+	double real() {
+		return ((*this)() >> 11) * (1.0 / 9007199254740992.0); // 2^-53
+	}
+
+	/**
+	 * @return A double distributed uniformly in [0, 1].
+	 */
+	double probability() {
+		return ((*this)() >> 11) * (1.0 / 9007199254740991.0); // 1 / (2^53 - 1)
+	}
+
+	/**
+	 * @return An integer distributed uniformly in [0, @a max - 1], @a max has to be positive.
+	 */
+	uint64_t index(uint64_t max) {
+		// Lemire's multiply-and-shift with rejection of the biased low products
+		unsigned __int128 product = static_cast<unsigned __int128>((*this)()) * max;
+		uint64_t low = static_cast<uint64_t>(product);
+		if (low < max) {
+			const uint64_t threshold = (0 - max) % max;
+			while (low < threshold) {
+				product = static_cast<unsigned __int128>((*this)()) * max;
+				low = static_cast<uint64_t>(product);
+			}
+		}
+		return static_cast<uint64_t>(product >> 64);
+	}
+
+	/**
+	 * @return An integer distributed uniformly in [0, @a upperBound].
+	 */
+	uint64_t integer(uint64_t upperBound) {
+		return upperBound == max() ? (*this)() : index(upperBound + 1);
+	}
+
+	/**
+	 * Computes one block of Philox4x32-10, i.e. the ten rounds applied to @a counter under @a key.
+	 */
+	static std::array<uint32_t, 4> block(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key) {
+		for (int round = 0; round < 10; ++round) {
+			const uint64_t product0 = static_cast<uint64_t>(multiplier0) * counter[0];
+			const uint64_t product1 = static_cast<uint64_t>(multiplier1) * counter[2];
+			counter = {static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0], static_cast<uint32_t>(product1),
+					static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1], static_cast<uint32_t>(product0)};
+			key[0] += weyl0;
+			key[1] += weyl1;
+		}
+		return counter;
+	}
+
+private:
+	static const uint32_t multiplier0 = 0xD2511F53;
+	static const uint32_t multiplier1 = 0xCD9E8D57;
+	static const uint32_t weyl0 = 0x9E3779B9;
+	static const uint32_t weyl1 = 0xBB67AE85;
+
+	uint64_t seed;
+	uint64_t stream;
+	uint64_t position;
+	uint64_t cachedBlock;
+	std::array<uint32_t, 4> output;
+};
+
+} /* namespace Aux */
+#endif /* PHILOX_H_ */
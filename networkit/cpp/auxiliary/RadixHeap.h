@@ -0,0 +1,294 @@
+/*
+ * RadixHeap.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef RADIXHEAP_H_
+#define RADIXHEAP_H_
+
+#include <vector>
+#include <set>
+#include <limits>
+#include <cstring>
+#include <cassert>
+#include <type_traits>
+
+#include "PrioQueue.h"
+
+namespace Aux {
+
+/**
+ * Addressable monotone radix heap for non-negative integer or floating point keys.
+ * The type Value takes on integer values between 0 and n-1.
+ *
+ * A radix heap requires that keys are never smaller than the key of the last extracted
+ * element, which holds for Dijkstra-like algorithms with non-negative edge weights.
+ * Floating point keys are compared via their IEEE 754 bit pattern, which preserves the
+ * order of non-negative values. Elements are kept in 65 buckets according to the highest
+ * bit in which they differ from the last extracted key; extractMin takes amortized
+ * O(log C) time for keys of C bits, all other operations take constant time.
+ * In contrast to PrioQueue, elements with equal keys are not extracted in order of their values.
+ */
+template<class Key, class Value>
+class RadixHeap final : public PrioQueue<Key, Value> {
+	static_assert(std::is_arithmetic<Key>::value && sizeof(Key) <= sizeof(uint64_t), "RadixHeap needs integer or floating point keys of at most 64 bits");
+
+private:
+	typedef std::pair<Key, Value> ElemType;
+	static constexpr uint64_t absent = std::numeric_limits<uint64_t>::max();
+	static constexpr unsigned numBuckets = 65;
+
+	struct Entry {
+		uint64_t radixKey;
+		Key key;
+		Value value;
+	};
+
+	std::vector<std::vector<Entry>> buckets;
+	std::vector<uint64_t> bucketOf; // bucket of each value or absent
+	std::vector<uint64_t> slotOf; // position of each value in its bucket
+	uint64_t last; // radix key of the last extracted element
+	uint64_t numElems;
+
+	static inline uint64_t toRadix(Key key) {
+		assert(key >= 0);
+		if (std::is_floating_point<Key>::value) {
+			// non-negative IEEE 754 numbers are ordered like their bit patterns
+			uint64_t bits = 0;
+			if (sizeof(Key) == sizeof(double)) {
+				double d = key;
+				std::memcpy(&bits, &d, sizeof(d));
+			} else {
+				float f = key;
+				uint32_t b = 0;
+				std::memcpy(&b, &f, sizeof(f));
+				bits = b;
+			}
+			return bits;
+		}
+		return static_cast<uint64_t>(key);
+	}
+
+	inline unsigned bucketIndex(uint64_t radixKey) const {
+		return radixKey == last ? 0 : 64 - __builtin_clzll(radixKey ^ last);
+	}
+
+	inline void push(const Entry& entry) {
+		unsigned b = bucketIndex(entry.radixKey);
+		bucketOf[entry.value] = b;
+		slotOf[entry.value] = buckets[b].size();
+		buckets[b].push_back(entry);
+	}
+
+	inline void erase(const Value& value) {
+		auto& bucket = buckets[bucketOf[value]];
+		uint64_t slot = slotOf[value];
+		if (slot + 1 < bucket.size()) {
+			bucket[slot] = bucket.back();
+			slotOf[bucket[slot].value] = slot;
+		}
+		bucket.pop_back();
+		bucketOf[value] = absent;
+	}
+
+	/**
+	 * Refills bucket 0 from the first non-empty bucket if necessary.
+	 */
+	void pull();
+
+protected:
+	/**
+	 * Removes key-value pair given by @a elem.
+	 */
+	void remove(const ElemType& elem) override {
+		remove(elem.second);
+	}
+
+	/**
+	 * @return current content of queue
+	 */
+	std::set<ElemType> content() const override {
+		std::set<ElemType> result;
+		for (auto& bucket : buckets) {
+			for (auto& entry : bucket) {
+				result.emplace(entry.key, entry.value);
+			}
+		}
+		return result;
+	}
+
+public:
+	/**
+	 * Builds priority queue from the vector @a keys, values are indices
+	 * of @a keys.
+	 */
+	RadixHeap(const std::vector<Key>& keys);
+
+	/**
+	 * Builds priority queue of the specified capacity @a capacity.
+	 */
+	RadixHeap(uint64_t capacity);
+
+	/**
+	 * Inserts key-value pair. If @a value is already contained, its key is changed instead.
+	 * @a key must not be smaller than the key of the last extracted element.
+	 */
+	void insert(Key key, Value value) override;
+
+	/**
+	 * Removes the element with minimum key and returns it.
+	 */
+	ElemType extractMin() override;
+
+	/**
+	 * Modifies entry with value @a value. If the corresponding key is not present,
+	 * the element will be inserted. @a newKey must not be smaller than the key of the
+	 * last extracted element.
+	 */
+	void changeKey(Key newKey, Value value) override;
+
+	/**
+	 * @return Number of elements in PQ.
+	 */
+	uint64_t size() const override {
+		return numElems;
+	}
+
+	/**
+	 * @return True if the PQ is empty.
+	 */
+	bool empty() const {
+		return numElems == 0;
+	}
+
+	/**
+	 * @return True if @a value is contained in the PQ.
+	 */
+	bool contains(const Value& value) const {
+		return value < bucketOf.size() && bucketOf[value] != absent;
+	}
+
+	/**
+	 * Removes all elements and resets the monotonicity bound, keeps the capacity.
+	 */
+	void clear();
+
+	/**
+	 * Removes key-value pair given by value @a val. Does nothing if @a val is not contained.
+	 */
+	void remove(const Value& val) override;
+
+	/**
+	 * DEBUGGING
+	 */
+	void print() override {
+		DEBUG("num entries: ", numElems);
+		for (auto& elem : content()) {
+			(void)elem; // prevent unused variable warning
+			DEBUG("key: ", elem.first, ", val: ", elem.second, "\n");
+		}
+	}
+};
+
+
+template<class Key, class Value>
+constexpr uint64_t RadixHeap<Key, Value>::absent;
+
+template<class Key, class Value>
+constexpr unsigned RadixHeap<Key, Value>::numBuckets;
+
+template<class Key, class Value>
+RadixHeap<Key, Value>::RadixHeap(const std::vector<Key>& keys) : RadixHeap(keys.size()) {
+	for (uint64_t i = 0; i < keys.size(); ++i) {
+		insert(keys[i], i);
+	}
+}
+
+template<class Key, class Value>
+RadixHeap<Key, Value>::RadixHeap(uint64_t capacity) : buckets(numBuckets), bucketOf(capacity, absent), slotOf(capacity), last(0), numElems(0) {
+}
+
+template<class Key, class Value>
+inline void RadixHeap<Key, Value>::insert(Key key, Value value) {
+	if (value >= bucketOf.size()) {
+		uint64_t newSize = std::max<uint64_t>(2 * bucketOf.size(), value + 1);
+		bucketOf.resize(newSize, absent);
+		slotOf.resize(newSize);
+	}
+	if (bucketOf[value] != absent) {
+		erase(value);
+		--numElems;
+	}
+	uint64_t radixKey = toRadix(key);
+	assert(radixKey >= last);
+	push(Entry{radixKey, key, value});
+	++numElems;
+}
+
+template<class Key, class Value>
+void RadixHeap<Key, Value>::pull() {
+	if (!buckets[0].empty()) {
+		return;
+	}
+	unsigned b = 1;
+	while (buckets[b].empty()) {
+		++b;
+	}
+	// the new lower bound is the minimum of the first non-empty bucket
+	uint64_t newLast = buckets[b][0].radixKey;
+	for (auto& entry : buckets[b]) {
+		newLast = std::min(newLast, entry.radixKey);
+	}
+	last = newLast;
+	// all elements of bucket b move to smaller buckets
+	std::vector<Entry> moved;
+	std::swap(moved, buckets[b]);
+	for (auto& entry : moved) {
+		push(entry);
+	}
+	// keep the allocated memory of bucket b
+	moved.clear();
+	std::swap(moved, buckets[b]);
+}
+
+template<class Key, class Value>
+std::pair<Key, Value> RadixHeap<Key, Value>::extractMin() {
+	assert(numElems > 0);
+	pull();
+	Entry entry = buckets[0].back();
+	buckets[0].pop_back();
+	bucketOf[entry.value] = absent;
+	--numElems;
+	return std::make_pair(entry.key, entry.value);
+}
+
+template<class Key, class Value>
+inline void RadixHeap<Key, Value>::changeKey(Key newKey, Value value) {
+	insert(newKey, value);
+}
+
+template<class Key, class Value>
+inline void RadixHeap<Key, Value>::remove(const Value& val) {
+	if (!contains(val)) {
+		return;
+	}
+	erase(val);
+	--numElems;
+}
+
+template<class Key, class Value>
+void RadixHeap<Key, Value>::clear() {
+	for (auto& bucket : buckets) {
+		for (auto& entry : bucket) {
+			bucketOf[entry.value] = absent;
+		}
+		bucket.clear();
+	}
+	numElems = 0;
+	last = 0;
+}
+
+} /* namespace Aux */
+#endif /* RADIXHEAP_H_ */
@@ -61,6 +61,14 @@ std::mt19937_64& getURNG() {
 	return generator;
 }
 
+Philox stream(uint64_t key) {
+	if (staticSeed) {
+		return Philox(seedValue, key);
+	}
+	static const uint64_t processSeed = std::uniform_int_distribution<uint64_t>{}(getURNG());
+	return Philox(processSeed, key);
+}
+
 uint64_t integer() {
 	AUX_THREAD_LOCAL static std::uniform_int_distribution<uint64_t> dist{};
 	return dist(getURNG());
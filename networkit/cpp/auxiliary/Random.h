@@ -14,6 +14,7 @@
 #include <random>
 #include <stdexcept>
 #include "Log.h"
+#include "Philox.h"
 
 namespace Aux {
 
@@ -42,6 +43,14 @@ uint64_t getSeed();
 std::mt19937_64& getURNG();
 
 
+/**
+ * @returns the counter-based generator for stream @a key, e.g. a node, edge or sample index.
+ * The stream depends only on @a key and the seed set with setSeed (the thread id is never added), so
+ * algorithms that draw the random numbers of item i from stream(i) give the same result for every
+ * number of threads. Without a fixed seed, a random seed is chosen once per process.
+ */
+Philox stream(uint64_t key);
+
 /**
  * @returns an integer distributed uniformly in an inclusive range;
  * @param upperBound the upper bound, default = UNINT64_T_MAX
@@ -90,10 +99,10 @@ typename Container::const_reference choice(const Container& container) {
 
 
 /**
- * @returns a weighted random choice from a vector of elements with given weights.
+ * @returns a weighted random choice from a vector of elements with given weights, drawn from @a urng.
  */
-template <typename Element>
-const Element& weightedChoice(const std::vector<std::pair<Element, double>>& weightedElements) {
+template <typename Element, typename URNG>
+const Element& weightedChoice(const std::vector<std::pair<Element, double>>& weightedElements, URNG& urng) {
 	if (weightedElements.size() == 0)
 		throw std::runtime_error("Random::weightedChoice: input size equal to 0");
 	double total = 0.0;
@@ -101,7 +110,8 @@ const Element& weightedChoice(const std::vector<std::pair<Element, double>>& wei
 		assert(entry.second >= 0.0 && "This algorithm only works with non-negative weights");
 		total += entry.second;
 	}
-	double r = Aux::Random::real(total);
+	std::uniform_real_distribution<double> dist{0.0, total};
+	double r = dist(urng);
 	for (const auto& entry : weightedElements) {
 		if (r < entry.second) {
 			return entry.first;
@@ -111,6 +121,14 @@ const Element& weightedChoice(const std::vector<std::pair<Element, double>>& wei
 	throw std::runtime_error("Random::weightedChoice: should never get here"); // should never get here
 }
 
+/**
+ * @returns a weighted random choice from a vector of elements with given weights.
+ */
+template <typename Element>
+const Element& weightedChoice(const std::vector<std::pair<Element, double>>& weightedElements) {
+	return weightedChoice(weightedElements, getURNG());
+}
+
 } // namespace Random
 } // namespace Aux
 
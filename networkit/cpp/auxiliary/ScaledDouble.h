@@ -0,0 +1,93 @@
+/*
+ * ScaledDouble.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef SCALEDDOUBLE_H_
+#define SCALEDDOUBLE_H_
+
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+namespace Aux {
+
+/**
+ * Non-negative number stored as a double mantissa and a separate binary exponent,
+ * i.e. value = mantissa * 2^exponent. It supports addition and division, which is all
+ * that is needed to count shortest paths and to compute ratios of path counts, without
+ * overflowing at 1e308 like a plain double. As long as the mantissa stays below 2^512,
+ * the exponent remains zero and every operation is a single floating point operation.
+ * The relative error of a sum is that of double arithmetic.
+ */
+class ScaledDouble final {
+
+public:
+	ScaledDouble(double value = 0.0) : mantissa(value), exponent(0) {
+	}
+
+	ScaledDouble& operator+=(const ScaledDouble& other) {
+		if (exponent == other.exponent) {
+			mantissa += other.mantissa;
+		} else if (other.mantissa == 0.0) {
+			return *this;
+		} else if (mantissa == 0.0) {
+			*this = other;
+			return *this;
+		} else if (exponent > other.exponent) {
+			mantissa += scale(other.mantissa, other.exponent - exponent);
+		} else {
+			mantissa = other.mantissa + scale(mantissa, exponent - other.exponent);
+			exponent = other.exponent;
+		}
+		if (mantissa >= limit) {
+			mantissa = std::ldexp(mantissa, -shift);
+			exponent += shift;
+		}
+		return *this;
+	}
+
+	/**
+	 * @return The quotient @a a / @a b as a double.
+	 */
+	friend double operator/(const ScaledDouble& a, const ScaledDouble& b) {
+		if (a.exponent == b.exponent) {
+			return a.mantissa / b.mantissa;
+		}
+		return scale(a.mantissa / b.mantissa, a.exponent - b.exponent);
+	}
+
+	bool operator==(const ScaledDouble& other) const {
+		return mantissa == other.mantissa && exponent == other.exponent;
+	}
+
+	/**
+	 * @return The value as a double, infinity if it does not fit.
+	 */
+	double toDouble() const {
+		return scale(mantissa, exponent);
+	}
+
+	/**
+	 * @return The binary logarithm of the value.
+	 */
+	double log2() const {
+		return std::log2(mantissa) + exponent;
+	}
+
+private:
+	static constexpr double limit = 1.3407807929942597e154; // 2^512
+	static constexpr int shift = 512;
+
+	double mantissa;
+	int64_t exponent;
+
+	static double scale(double x, int64_t e) {
+		return std::ldexp(x, static_cast<int>(std::max<int64_t>(std::min<int64_t>(e, 4096), -4096)));
+	}
+};
+
+} /* namespace Aux */
+#endif /* SCALEDDOUBLE_H_ */
@@ -22,6 +22,10 @@
 #include "../Timer.h"
 #include "../MissingMath.h"
 #include "../PrioQueue.h"
+#include "../DAryHeap.h"
+#include "../RadixHeap.h"
+#include "../ScaledDouble.h"
+#include "../Philox.h"
 #include "../PrioQueueForInts.h"
 #include "../BucketPQ.h"
 #include "../StringTools.h"
@@ -207,6 +211,198 @@ TEST_F(AuxGTest, testPriorityQueue) {
 	EXPECT_EQ(pq.size(), vec.size() - 5);
 }
 
+TEST_F(AuxGTest, testDAryHeap) {
+	// same sequence as testPriorityQueue
+	std::vector<double> vec = {0.5, 3.5, 4.5, 2.5, 0.75, 1.5, 8.5, 3.25, 4.75, 5.0, 11.5, 0.25};
+	Aux::DAryHeap<double, uint64_t> pq(vec);
+	EXPECT_EQ(pq.size(), vec.size());
+	EXPECT_EQ(0.25, pq.peekMin().first);
+
+	std::vector<std::pair<double, uint64_t>> expected = {{0.25, 11}, {0.5, 0}, {0.75, 4}, {1.5, 5}, {2.5, 3}};
+	for (auto& e : expected) {
+		EXPECT_EQ(e, pq.extractMin());
+	}
+	EXPECT_EQ(pq.size(), vec.size() - expected.size());
+
+	// decrease, increase and remove
+	pq.changeKey(0.1, 10);
+	pq.changeKey(20.0, 7);
+	pq.remove(1);
+	EXPECT_FALSE(pq.contains(1));
+	EXPECT_EQ(std::make_pair(0.1, (uint64_t) 10), pq.extractMin());
+	EXPECT_EQ(std::make_pair(4.5, (uint64_t) 2), pq.extractMin());
+	EXPECT_EQ(4u, pq.size());
+}
+
+TEST_F(AuxGTest, testDAryHeapAgainstPrioQueue) {
+	Aux::Random::setSeed(42, false);
+	const uint64_t n = 500;
+	Aux::PrioQueue<double, uint64_t> reference(n);
+	Aux::DAryHeap<double, uint64_t, 3> heap(n);
+	std::vector<bool> present(n, false);
+
+	for (uint64_t i = 0; i < 20000; ++i) {
+		uint64_t v = Aux::Random::integer(n - 1);
+		double key = (double) Aux::Random::integer(50);
+		switch (Aux::Random::integer(3)) {
+		case 0:
+		case 1:
+			reference.changeKey(key, v);
+			heap.changeKey(key, v);
+			present[v] = true;
+			break;
+		case 2:
+			if (present[v]) {
+				reference.remove(v);
+				heap.remove(v);
+				present[v] = false;
+			}
+			break;
+		default:
+			if (reference.size() > 0) {
+				auto elem = reference.extractMin();
+				ASSERT_EQ(elem, heap.extractMin());
+				present[elem.second] = false;
+			}
+		}
+		ASSERT_EQ(reference.size(), heap.size());
+	}
+	while (reference.size() > 0) {
+		ASSERT_EQ(reference.extractMin(), heap.extractMin());
+	}
+	EXPECT_TRUE(heap.empty());
+}
+
+TEST_F(AuxGTest, testRadixHeap) {
+	Aux::Random::setSeed(42, false);
+	const uint64_t n = 1000;
+	for (bool integral : {true, false}) {
+		Aux::RadixHeap<double, uint64_t> pq(n);
+		Aux::RadixHeap<uint64_t, uint64_t> ipq(n);
+		std::vector<double> key(n, -1.0);
+		double last = 0.0;
+		// monotone sequence of inserts, decrease-keys and extractions as in Dijkstra
+		for (uint64_t round = 0; round < 5000; ++round) {
+			uint64_t v = Aux::Random::integer(n - 1);
+			double k = last + (integral ? (double) Aux::Random::integer(100) : Aux::Random::real(0.0, 100.0));
+			if (key[v] < 0.0 || k < key[v]) {
+				key[v] = k;
+				pq.changeKey(k, v);
+				if (integral) {
+					ipq.changeKey((uint64_t) k, v);
+				}
+			}
+			if (Aux::Random::integer(1) == 0 && !pq.empty()) {
+				auto elem = pq.extractMin();
+				ASSERT_LE(last, elem.first);
+				ASSERT_EQ(key[elem.second], elem.first);
+				for (uint64_t u = 0; u < n; ++u) {
+					if (key[u] >= 0.0) {
+						ASSERT_LE(elem.first, key[u]);
+					}
+				}
+				if (integral) {
+					auto ielem = ipq.extractMin();
+					ASSERT_EQ((uint64_t) elem.first, ielem.first);
+				}
+				last = elem.first;
+				key[elem.second] = -1.0;
+			}
+		}
+		EXPECT_EQ(pq.size(), (uint64_t) std::count_if(key.begin(), key.end(), [](double k) { return k >= 0.0; }));
+		pq.clear();
+		EXPECT_TRUE(pq.empty());
+	}
+}
+
+TEST_F(AuxGTest, testScaledDouble) {
+	// small values behave like doubles
+	Aux::ScaledDouble a(1.0);
+	double d = 1.0;
+	for (uint64_t i = 0; i < 100; ++i) {
+		a += Aux::ScaledDouble(i + 0.5);
+		d += i + 0.5;
+	}
+	EXPECT_EQ(d, a.toDouble());
+	EXPECT_EQ(d / 3.0, a / Aux::ScaledDouble(3.0));
+
+	// 2^2000 does not fit into a double
+	Aux::ScaledDouble big(1.0);
+	std::vector<Aux::ScaledDouble> powers;
+	for (uint64_t i = 0; i < 2000; ++i) {
+		powers.push_back(big);
+		big += big;
+	}
+	EXPECT_DOUBLE_EQ(2000.0, big.log2());
+	EXPECT_EQ(std::numeric_limits<double>::infinity(), big.toDouble());
+	EXPECT_EQ(0.5, powers[1999] / big);
+	EXPECT_EQ(std::ldexp(1.0, -1000), powers[1000] / big);
+	EXPECT_EQ(std::ldexp(1.0, 10), powers[1010] / powers[1000]);
+
+	// operands with different exponents
+	Aux::ScaledDouble sum = powers[1500];
+	sum += powers[1];
+	sum += Aux::ScaledDouble(0.0);
+	EXPECT_EQ(1.0, sum / powers[1500]);
+	Aux::ScaledDouble small(3.0);
+	small += powers[700];
+	EXPECT_DOUBLE_EQ(700.0, small.log2());
+	EXPECT_EQ(std::ldexp(3.0, -700), Aux::ScaledDouble(3.0) / small);
+}
+
+TEST_F(AuxGTest, testPhilox) {
+	// known answers from the Random123 distribution
+	std::array<uint32_t, 4> zero = Aux::Philox::block({0, 0, 0, 0}, {0, 0});
+	EXPECT_EQ((std::array<uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}), zero);
+	std::array<uint32_t, 4> ones = Aux::Philox::block({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff});
+	EXPECT_EQ((std::array<uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}), ones);
+	std::array<uint32_t, 4> pi = Aux::Philox::block({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0});
+	EXPECT_EQ((std::array<uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}), pi);
+
+	// skipping ahead and drawing give the same outputs
+	Aux::Philox a(42, 7);
+	std::vector<uint64_t> values;
+	for (int i = 0; i < 9; ++i) {
+		values.push_back(a());
+	}
+	Aux::Philox b(42, 7);
+	b.discard(5);
+	EXPECT_EQ(values[5], b());
+	b.discard(2);
+	EXPECT_EQ(values[8], b());
+
+	// other streams and seeds give other outputs
+	EXPECT_NE(values[0], Aux::Philox(42, 8)());
+	EXPECT_NE(values[0], Aux::Philox(43, 7)());
+
+	Aux::Philox c(1, 2);
+	std::vector<uint64_t> histogram(10, 0);
+	for (int i = 0; i < 100000; ++i) {
+		double r = c.real();
+		EXPECT_LE(0.0, r);
+		EXPECT_LT(r, 1.0);
+		uint64_t j = c.index(10);
+		ASSERT_LT(j, 10u);
+		++histogram[j];
+		EXPECT_LE(c.integer(3), 3u);
+	}
+	for (uint64_t h : histogram) {
+		EXPECT_NEAR(10000.0, (double) h, 500.0);
+	}
+
+	// streams of the global seed do not depend on the thread
+	Aux::Random::setSeed(5, true);
+	uint64_t expected = Aux::Random::stream(3)();
+	std::vector<uint64_t> drawn(4, 0);
+	#pragma omp parallel for num_threads(4)
+	for (int i = 0; i < 4; ++i) {
+		drawn[i] = Aux::Random::stream(3)();
+	}
+	for (uint64_t value : drawn) {
+		EXPECT_EQ(expected, value);
+	}
+}
+
 TEST_F(AuxGTest, testPrioQueueForIntsWithEmptiness) {
 	// fill vector with priorities
 	std::vector<int64_t> vec = {17, 4, 1, 5, 3, 11, 9, 19, -9, 1, 4, 20, 8, 8};
@@ -231,6 +427,31 @@ TEST_F(AuxGTest, testPrioQueueForIntsWithEmptiness) {
 	EXPECT_EQ(mini.second, 8u);
 }
 
+TEST_F(AuxGTest, testBucketPQRemove) {
+	Aux::BucketPQ pq(10, -5, 5);
+	pq.remove(3); // not contained, no effect
+	EXPECT_EQ(0u, pq.size());
+
+	pq.insert(2, 0);
+	pq.insert(2, 1);
+	pq.insert(2, 2);
+	pq.insert(-1, 3);
+	pq.remove(1); // from the middle of a bucket
+	pq.changeKey(5, 3);
+	EXPECT_EQ(3u, pq.size());
+
+	std::pair<int64_t, uint64_t> mini = pq.extractMin();
+	EXPECT_EQ(2, mini.first);
+	EXPECT_EQ(2u, mini.second); // buckets are LIFO
+	mini = pq.extractMin();
+	EXPECT_EQ(2, mini.first);
+	EXPECT_EQ(0u, mini.second);
+	mini = pq.extractMin();
+	EXPECT_EQ(5, mini.first);
+	EXPECT_EQ(3u, mini.second);
+	EXPECT_EQ(0u, pq.size());
+}
+
 TEST_F(AuxGTest, testPrioQueueForInts) {
 	// fill vector with priorities
 	std::vector<int64_t> vec;
@@ -8,7 +8,6 @@
 #include "ApproxBetweenness.h"
 #include "../auxiliary/Random.h"
 #include "../distance/Diameter.h"
-#include "../graph/Sampling.h"
 #include "../distance/Dijkstra.h"
 #include "../distance/BFS.h"
 #include "../distance/SSSP.h"
@@ -50,8 +49,9 @@ void ApproxBetweenness::run() {
 	// parallelization:
 	count maxThreads = omp_get_max_threads();
 	DEBUG("max threads: ", maxThreads);
-	std::vector<std::vector<double> > scorePerThread(maxThreads, std::vector<double>(G.upperNodeIdBound()));
-	DEBUG("score per thread size: ", scorePerThread.size());
+	// sample i draws from its own random stream and the hits are counted as integers, so the result does not depend on the number of threads
+	std::vector<std::vector<count> > hitsPerThread(maxThreads, std::vector<count>(G.upperNodeIdBound()));
+	DEBUG("score per thread size: ", hitsPerThread.size());
 	handler.assureRunning();
 	#pragma omp parallel for
 	for (count i = 1; i <= r; i++) {
@@ -60,10 +60,18 @@ void ApproxBetweenness::run() {
 		// if (i >= 1000) throw std::runtime_error("too many iterations");
 		// DEBUG
 		// sample random node pair
+		Aux::Philox urng = Aux::Random::stream(i);
+		auto randomNode = [&]() {
+			node w;
+			do {
+				w = urng.index(G.upperNodeIdBound());
+			} while (!G.hasNode(w));
+			return w;
+		};
 		node u, v;
-		u = Sampling::randomNode(G);
+		u = randomNode();
 		do {
-			v = Sampling::randomNode(G);
+			v = randomNode();
 		} while (v == u);
 
 		// runs faster for unweighted graphs
@@ -91,10 +99,10 @@ void ApproxBetweenness::run() {
 					tmp.ToDouble(weight);
 					choices.emplace_back(z, weight); 	// sigma_uz / sigma_us
 				}
-				node z = Aux::Random::weightedChoice(choices);
+				node z = Aux::Random::weightedChoice(choices, urng);
 				assert (z <= G.upperNodeIdBound());
 				if (z != u) {
-					scorePerThread[thread][z] += 1 / (double) r;
+					hitsPerThread[thread][z] += 1;
 				}
 				// s = t;
 				t = z;
@@ -105,11 +113,14 @@ void ApproxBetweenness::run() {
 
 	INFO("adding thread-local scores");
 	// add up all thread-local values
-	for (auto &local : scorePerThread) {
+	for (auto &local : hitsPerThread) {
 		G.parallelForNodes([&](node v){
 			scoreData[v] += local[v];
 		});
 	}
+	G.parallelForNodes([&](node v){
+		scoreData[v] /= (double) r;
+	});
 
 	hasRun = true;
 }
@@ -6,7 +6,7 @@
  */
 
 #include "ApproxCloseness.h"
-#include "../auxiliary/PrioQueue.h"
+#include "../auxiliary/DAryHeap.h"
 #include <cassert>
 #include <queue>
 
@@ -134,7 +134,7 @@ void ApproxCloseness::computeClosenessForDirectedWeightedGraph(bool outbound) {
 	std::vector<edgeweight> distSum(G.upperNodeIdBound(), 0);
 	std::vector<edgeweight> dist(G.upperNodeIdBound(), infDist);
 	std::vector<index> round(G.upperNodeIdBound(), 0);
-	Aux::PrioQueue<edgeweight, node> pq(dist.size());
+	Aux::DAryHeap<edgeweight, node> pq(dist.size());
 
 	G.forNodesInRandomOrder([&](node u) {
 		t++;
@@ -265,7 +265,7 @@ void ApproxCloseness::computeClosenessForDirectedUnweightedGraph(bool outbound)
 void ApproxCloseness::computeClosestPivot(const std::vector<node> &samples, std::vector<node> &pivot, std::vector<edgeweight> &delta) {
 	std::fill(delta.begin(), delta.end(), infDist);
 
-	Aux::PrioQueue<edgeweight, node> pq(delta.size());
+	Aux::DAryHeap<edgeweight, node> pq(delta.size());
 	for (index i = 0; i < samples.size(); ++i) {
 		delta[samples[i]] = 0.0; // distance to closest pivot is 0 for pivot itself
 		pivot[samples[i]] = i; // sample node is its own pivot
@@ -370,7 +370,7 @@ void ApproxCloseness::orderNodesByIncreasingDistance(node c, std::vector<node> &
 	order = std::vector<node>(G.numberOfNodes());
 
 	if (G.isWeighted()) { // use Dijkstra
-		Aux::PrioQueue<edgeweight, node> pq(pivotDist.size());
+		Aux::DAryHeap<edgeweight, node> pq(pivotDist.size());
 		pq.insert(0.0, c);
 		index idx = 0;
 		while (pq.size() > 0) {
@@ -15,16 +15,53 @@
 #include "../auxiliary/PrioQueue.h"
 #include "../auxiliary/Log.h"
 #include "../auxiliary/SignalHandling.h"
-#include "../distance/SSSP.h"
-#include "../distance/Dijkstra.h"
-#include "../distance/BFS.h"
+#include "../distance/SSSPWorkspace.h"
 
 namespace NetworKit {
 
-Betweenness::Betweenness(const Graph& G, bool normalized, bool computeEdgeCentrality) : Centrality(G, normalized, computeEdgeCentrality) {
+Betweenness::Betweenness(const Graph& G, bool normalized, bool computeEdgeCentrality, PathCounting pathCounting) : Centrality(G, normalized, computeEdgeCentrality), pathCounting(pathCounting) {
 
 }
 
+template<class PathCount>
+void Betweenness::accumulateDependencies(std::vector<std::vector<double>>& scorePerThread, std::vector<std::vector<double>>& edgeScorePerThread) {
+	Aux::SignalHandler handler;
+	count z = G.upperNodeIdBound();
+
+	// the searches run on a CSR snapshot, every thread reuses one workspace for all of its sources
+	StaticGraph S(G, false);
+
+	#pragma omp parallel
+	{
+		SSSPWorkspace<PathCount> sssp(S);
+		std::vector<double> dependency(z, 0.0);
+		std::vector<double>& score = scorePerThread[omp_get_thread_num()];
+
+		#pragma omp for schedule(guided)
+		for (node s = 0; s < z; ++s) {
+			if (!S.hasNode(s) || !handler.isRunning()) continue;
+			sssp.run(s);
+			// compute dependencies for nodes in order of decreasing distance from s
+			const std::vector<node>& order = sssp.getOrder();
+			for (index i = order.size(); i-- > 0; ) {
+				node u = order[i];
+				double delta = 0.0;
+				sssp.forSuccessorsOf(i, [&](node w, edgeid eid) {
+					double c = sssp.pathRatio(u, w) * (1 + dependency[w]);
+					delta += c;
+					if (computeEdgeCentrality) {
+						edgeScorePerThread[omp_get_thread_num()][eid] += c;
+					}
+				});
+				dependency[u] = delta;
+				if (u != s) {
+					score[u] += delta;
+				}
+			}
+		}
+	}
+}
+
 void Betweenness::run() {
 	Aux::SignalHandler handler;
 	count z = G.upperNodeIdBound();
@@ -47,45 +84,12 @@ void Betweenness::run() {
 	}
 	DEBUG("edge score per thread: ", edgeScorePerThread.size());
 
-	auto computeDependencies = [&](node s) {
-
-		std::vector<double> dependency(z, 0.0);
-
-		// run SSSP algorithm and keep track of everything
-		std::unique_ptr<SSSP> sssp;
-		if (G.isWeighted()) {
-			sssp.reset(new Dijkstra(G, s, true, true));
-		} else {
-			sssp.reset(new BFS(G, s, true, true));
-		}
-		if (!handler.isRunning()) return;
-		sssp->run();
-		if (!handler.isRunning()) return;
-		// compute dependencies for nodes in order of decreasing distance from s
-		std::vector<node> stack = sssp->getStack();
-		while (!stack.empty()) {
-			node t = stack.back();
-			stack.pop_back();
-			for (node p : sssp->getPredecessors(t)) {
-				// workaround for integer overflow in large graphs
-				bigfloat tmp = sssp->numberOfPaths(p) / sssp->numberOfPaths(t);
-				double weight;
-				tmp.ToDouble(weight);
-				double c= weight * (1 + dependency[t]);
-				dependency[p] += c;
-				if (computeEdgeCentrality) {
-					edgeScorePerThread[omp_get_thread_num()][G.edgeId(p,t)] += c;
-				}
-
-
-			}
-			if (t != s) {
-				scorePerThread[omp_get_thread_num()][t] += dependency[t];
-			}
-		}
-	};
 	handler.assureRunning();
-	G.balancedParallelForNodes(computeDependencies);
+	if (pathCounting == SCALED_DOUBLE) {
+		accumulateDependencies<Aux::ScaledDouble>(scorePerThread, edgeScorePerThread);
+	} else {
+		accumulateDependencies<bigfloat>(scorePerThread, edgeScorePerThread);
+	}
 	handler.assureRunning();
 	DEBUG("adding thread-local scores");
 	// add up all thread-local values
@@ -17,6 +17,16 @@ namespace NetworKit {
  */
 class Betweenness: public NetworKit::Centrality {
 public:
+	/**
+	 * Number type used to count shortest paths. BIGFLOAT uses arbitrary precision arithmetic,
+	 * SCALED_DOUBLE uses doubles with a separate exponent, which cannot overflow either and is
+	 * considerably faster, but rounds path counts beyond 2^53 to double precision.
+	 */
+	enum PathCounting {
+		BIGFLOAT,
+		SCALED_DOUBLE
+	};
+
 	/**
 	 * Constructs the Betweenness class for the given Graph @a G. If the betweenness scores should be normalized,
 	 * then set @a normalized to <code>true</code>. The run() method takes O(nm) time, where n is the number
@@ -25,8 +35,9 @@ public:
 	 * @param G The graph.
 	 * @param normalized Set this parameter to <code>true</code> if scores should be normalized in the interval [0,1].
 	 * @param computeEdgeCentrality Set this parameter to <code>true</code> if edge betweenness should be computed as well.
+	 * @param pathCounting The number type used to count shortest paths.
 	 */
-	Betweenness(const Graph& G, bool normalized=false, bool computeEdgeCentrality=false);
+	Betweenness(const Graph& G, bool normalized=false, bool computeEdgeCentrality=false, PathCounting pathCounting=BIGFLOAT);
 
 
 
@@ -40,6 +51,11 @@ public:
 	*/
 	double maximum() override;
 
+private:
+	PathCounting pathCounting;
+
+	template<class PathCount>
+	void accumulateDependencies(std::vector<std::vector<double>>& scorePerThread, std::vector<std::vector<double>>& edgeScorePerThread);
 };
 
 } /* namespace NetworKit */
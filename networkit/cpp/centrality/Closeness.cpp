@@ -14,13 +14,15 @@
 #include "../auxiliary/Log.h"
 #include "../distance/SSSP.h"
 #include "../distance/Dijkstra.h"
+#include "../distance/DeltaSteppingSSSP.h"
 #include "../distance/BFS.h"
+#include "../distance/MultiSourceBFS.h"
 #include "../components/ConnectedComponents.h"
 
 
 namespace NetworKit {
 
-Closeness::Closeness(const Graph& G, bool normalized, bool checkConnectedness) : Centrality(G, normalized) {
+Closeness::Closeness(const Graph& G, bool normalized, bool checkConnectedness, SSSP::WeightedAlgorithm weightedAlgorithm) : Centrality(G, normalized), weightedAlgorithm(weightedAlgorithm) {
 	// TODO: extend closeness definition to make check for connectedness unnecessary
 	if (checkConnectedness) {
 		ConnectedComponents compo(G);
@@ -37,26 +39,65 @@ void Closeness::run() {
 	scoreData.resize(z);
 	edgeweight infDist = std::numeric_limits<edgeweight>::max();
 
-	G.parallelForNodes([&](node s) {
-		std::unique_ptr<SSSP> sssp;
-		if (G.isWeighted()) {
-			sssp.reset(new Dijkstra(G, s, true, true));
-		} else {
-			sssp.reset(new BFS(G, s, true, true));
-		}
-		sssp->run();
+	if (G.isWeighted() && weightedAlgorithm == SSSP::DELTA_STEPPING) {
+		StaticGraph S(G, false);
+		G.forNodes([&](node s) {
+			DeltaSteppingSSSP sssp(G, S, s, false, false);
+			sssp.run();
+			double sum = 0;
+			for (auto dist : sssp.getDistances()) {
+				if (dist != infDist) {
+					sum += dist;
+				}
+			}
+			scoreData[s] = 1 / sum;
+		});
+	} else if (G.isWeighted()) {
+		G.parallelForNodes([&](node s) {
+			Dijkstra dijkstra(G, s, false, false);
+			dijkstra.run();
+			std::vector<edgeweight> distances = dijkstra.getDistances();
+
+			double sum = 0;
+			for (auto dist : distances) {
+				if (dist != infDist ) {
+					sum += dist;
+				}
+			}
+			scoreData[s] = 1 / sum;
+		});
+	} else {
+		// bit-parallel BFS from batches of sources, every thread reuses one workspace
+		StaticGraph S(G, false);
+		std::vector<node> nodes;
+		G.forNodes([&](node u) {
+			nodes.push_back(u);
+		});
+		const count batches = (nodes.size() + MultiSourceBFS::batchSize - 1) / MultiSourceBFS::batchSize;
 
-		std::vector<edgeweight> distances = sssp->getDistances();
+		#pragma omp parallel
+		{
+			MultiSourceBFS msbfs(S);
+			std::vector<node> sources;
+			std::vector<double> sum(MultiSourceBFS::batchSize);
 
-		double sum = 0;
-		for (auto dist : distances) {
-			if (dist != infDist ) {
-				sum += dist;
+			#pragma omp for schedule(dynamic, 1)
+			for (index b = 0; b < batches; ++b) {
+				auto first = nodes.begin() + b * MultiSourceBFS::batchSize;
+				sources.assign(first, first + std::min<count>(MultiSourceBFS::batchSize, nodes.end() - first));
+				std::fill(sum.begin(), sum.end(), 0.0);
+				msbfs.run(sources, [&](node, uint64_t mask, count dist) {
+					MultiSourceBFS::forBits(mask, [&](index i) {
+						sum[i] += dist;
+					});
+				});
+				for (index i = 0; i < sources.size(); ++i) {
+					scoreData[sources[i]] = 1 / sum[i];
+				}
 			}
 		}
-		scoreData[s] = 1 / sum;
+	}
 
-	});
 	if (normalized) {
 		G.forNodes([&](node u){
 			scoreData[u] = scoreData[u] * (G.numberOfNodes() - 1);
@@ -9,6 +9,7 @@
 #define CLOSENESS_H_
 
 #include "Centrality.h"
+#include "../distance/SSSP.h"
 
 namespace NetworKit {
 
@@ -25,9 +26,10 @@ public:
 	 * @param G The graph.
 	 * @param normalized Set this parameter to <code>true</code> if scores should be normalized in the interval [0,1].
 	 * @param	checkConnectedness	turn this off if you know the graph is connected
+	 * @param weightedAlgorithm The shortest path algorithm used if @a G is weighted.
 	 *
 	 */
-	Closeness(const Graph& G, bool normalized=false, bool checkConnectedness=true);
+	Closeness(const Graph& G, bool normalized=false, bool checkConnectedness=true, SSSP::WeightedAlgorithm weightedAlgorithm=SSSP::DIJKSTRA);
 
 
 
@@ -40,6 +42,9 @@ public:
 	 * Returns the maximum possible Closeness a node can have in a graph with the same amount of nodes (=a star)
 	 */
 	double maximum() override;
+
+private:
+	SSSP::WeightedAlgorithm weightedAlgorithm;
 };
 
 } /* namespace NetworKit */
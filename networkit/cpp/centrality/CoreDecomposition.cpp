@@ -9,7 +9,6 @@
 #include <set>
 
 #include "CoreDecomposition.h"
-#include "../auxiliary/PrioQueueForInts.h"
 #include <omp.h>
 #include "../centrality/DegreeCentrality.h"
 
@@ -20,8 +19,7 @@ CoreDecomposition::CoreDecomposition(const Graph& G, bool normalized, bool enfor
 		storeNodeOrder(storeNodeOrder)
 {
 	if (G.numberOfSelfLoops()) throw std::runtime_error("Core Decomposition implementation does not support graphs with self-loops. Call Graph.removeSelfLoops() first.");
-	if (storeNodeOrder) this->enforceBucketQueueAlgorithm = true;
-	canRunInParallel = (! enforceBucketQueueAlgorithm && (G.numberOfNodes() == G.upperNodeIdBound()));
+	canRunInParallel = (! enforceBucketQueueAlgorithm && ! G.isDirected());
 }
 
 void CoreDecomposition::run() {
@@ -29,7 +27,7 @@ void CoreDecomposition::run() {
 		runWithBucketQueues();
 	}
 	else {
-		runWithParK();
+		runWithPKC();
 	}
 
 	if (normalized) {
@@ -43,136 +41,91 @@ void CoreDecomposition::run() {
 	}
 }
 
-void CoreDecomposition::runWithParK() {
-	count z = G.upperNodeIdBound();
-	scoreData.resize(z); // TODO: move to base class
-
-	count nUnprocessed = G.numberOfNodes();
-	std::vector<node> curr; // currently processed nodes
-	std::vector<node> next; // nodes to be processed next
-	std::vector<char> active(z,0);
-	index level = 0; // current level
-	count size = 0;  // number of nodes currently processed
+void CoreDecomposition::runWithPKC() {
+	const count z = G.upperNodeIdBound();
+	const count n = G.numberOfNodes();
+	scoreData.assign(z, 0.0); // TODO: move to base class
 
-	// fill in degrees
-	std::vector<count> degrees(z);
+	std::vector<count> degrees(z, 0);
 	G.parallelForNodes([&](node u) {
 		degrees[u] = G.degree(u);
-		active[u] = 1;
 	});
 
-	// main loop
-	while (nUnprocessed > 0) {
-		// find nodes with degree == current level
-		if (! canRunInParallel || z <= 256) {
-			scan(level, degrees, curr);
-		}
-		else {
-			scanParallel(level, degrees, curr, active);
-		}
-
-		// process such nodes in curr
-		size = curr.size();
-		while (size > 0) {
-			nUnprocessed -= size;
-			if (! canRunInParallel || size <= 256) {
-				processSublevel(level, degrees, curr, next);
-			}
-			else {
-				processSublevelParallel(level, degrees, curr, next, active);
-			}
-
-			std::swap(curr, next);
-			size = curr.size();
-			next.clear();
-		}
-		++level;
-	}
-
-	maxCore = level-1;
-	hasRun = true;
-}
-
-void NetworKit::CoreDecomposition::scan(index level, const std::vector<count>& degrees,
-		std::vector<node>& curr)
-{
+	// nodes that may not have been processed yet, the processed ones are removed from time to time
+	std::vector<node> candidates;
+	candidates.reserve(n);
 	G.forNodes([&](node u) {
-		if (degrees[u] == level) {
-			curr.push_back(u);
-		}
+		candidates.push_back(u);
 	});
-}
 
-void NetworKit::CoreDecomposition::scanParallel(index level, const std::vector<count>& degrees,
-		std::vector<node>& curr, std::vector<char>& active)
-{
-	const count z = G.upperNodeIdBound();
-	std::vector<std::vector<node>> next(omp_get_max_threads());
-	curr.clear();
-
-#pragma omp parallel for schedule(guided)
-	for (index u = 0; u < z; ++u) {
-		if (active[u] && degrees[u] == level) {
-			auto tid = omp_get_thread_num();
-			next[tid].push_back(u);
-		}
-	}
-	for (auto& n : next) {
-		curr.insert(curr.end(),n.begin(),n.end());
+	if (storeNodeOrder) {
+		nodeOrder.assign(n, none);
 	}
-}
+	index orderSize = 0;
+	count processed = 0;
+	index level = 0;
+
+	#pragma omp parallel
+	{
+		std::vector<node> buffer; // nodes of the current level found by this thread, in peeling order
+		auto enqueue = [&](node v) {
+			buffer.push_back(v);
+			if (storeNodeOrder) {
+				nodeOrder[__atomic_fetch_add(&orderSize, 1, __ATOMIC_SEQ_CST)] = v;
+			}
+		};
 
-void NetworKit::CoreDecomposition::processSublevel(index level,
-		std::vector<count>& degrees, const std::vector<node>& curr,
-		std::vector<node>& next)
-{
-	// check for each neighbor of vertices in curr if their updated degree reaches level;
-	// if so, process them next
-	for (auto u: curr) {
-		scoreData[u] = level;
-		G.forNeighborsOf(u, [&](node v) {
-			if (degrees[v] > level) {
-				degrees[v]--;
+		while (processed < n) {
+			// find the nodes whose remaining degree equals the level; degrees do not change during the scan
+			buffer.clear();
+			#pragma omp for schedule(static)
+			for (index i = 0; i < candidates.size(); ++i) {
+				node v = candidates[i];
 				if (degrees[v] == level) {
-					next.push_back(v);
+					enqueue(v);
 				}
 			}
-		});
-	}
-}
 
-void NetworKit::CoreDecomposition::processSublevelParallel(index level,
-		std::vector<count>& degrees, const std::vector<node>& curr,
-		std::vector<node>& next, std::vector<char>& active)
-{
-	// check for each neighbor of vertices in curr if their updated degree reaches level;
-	// if so, process them next
-
-	const count size = curr.size();
-	std::vector<std::vector<node>> localNext(omp_get_max_threads());
-
-#pragma omp parallel for schedule(guided)
-	for (index i = 0; i < size; ++i) {
-		node u = curr[i];
-		active[u] = 0;
-		scoreData[u] = level;
-		G.forNeighborsOf(u, [&](node v) {
-			if (degrees[v] > level) {
-				index tmp;
-#pragma omp atomic capture
-				tmp = --degrees[v];
-
-				// ensure that neighbor is inserted exactly once if necessary
-				if (tmp == level) { // error in external publication on ParK fixed here
-					auto tid = omp_get_thread_num();
-					localNext[tid].push_back(v);
+			// peel them; neighbors whose degree drops to the level are peeled by the same thread
+			for (index j = 0; j < buffer.size(); ++j) {
+				node v = buffer[j];
+				scoreData[v] = level;
+				G.forNeighborsOf(v, [&](node u) {
+					if (__atomic_load_n(&degrees[u], __ATOMIC_RELAXED) > level) {
+						count before = __atomic_fetch_sub(&degrees[u], 1, __ATOMIC_SEQ_CST);
+						if (before == level + 1) {
+							enqueue(u);
+						} else if (before <= level) {
+							// another thread got the degree to the level first, u is peeled already
+							__atomic_fetch_add(&degrees[u], 1, __ATOMIC_RELAXED);
+						}
+					}
+				});
+			}
+
+			#pragma omp atomic
+			processed += buffer.size();
+			#pragma omp barrier
+
+			#pragma omp single
+			{
+				++level;
+				// drop the processed nodes once they make up half of the candidates
+				if (2 * (n - processed) < candidates.size()) {
+					index k = 0;
+					for (node v : candidates) {
+						if (degrees[v] >= level) {
+							candidates[k++] = v;
+						}
+					}
+					candidates.resize(k);
 				}
 			}
-		});
-	}
-	for (auto& n : localNext) {
-		next.insert(next.end(), n.begin(), n.end());
+		}
 	}
+
+	maxCore = level > 0 ? level - 1 : 0;
+	hasRun = true;
 }
 
 void CoreDecomposition::runWithBucketQueues() {
@@ -31,14 +31,16 @@ public:
 	/**
 	 * Create CoreDecomposition class for graph @a G. The graph may not contain self-loops.
 	 *
-	 * Contains the parallel algorithm by
-	 * Dasari, N.S.; Desh, R.; Zubair, M., "ParK: An efficient algorithm for k-core decomposition on multicore processors," in Big Data (Big Data), * 2014 IEEE International Conference.
+	 * Undirected graphs are decomposed in parallel with the algorithm PKC by
+	 * Kabir, H.; Madduri, K., "Parallel k-Core Decomposition on Multicore Platforms," in IPDPS Workshops 2017,
+	 * a refinement of ParK by Dasari, N.S.; Desh, R.; Zubair, M., "ParK: An efficient algorithm for k-core
+	 * decomposition on multicore processors," in Big Data (Big Data), 2014 IEEE International Conference.
 	 *
 	 * TODO complexity?
 	 * @param G The graph.
 	 * @param normalized If set to @c true the scores are normalized in the interval [0,1].
-	 * @param enforceBucketQueueAlgorithm If set to @c true, uses a bucket priority queue data structure. This it is generally slower than ParK but may be more flexible. TODO check
-	 * @param storeNodeOrder If set to @c true, the order of the nodes in ascending order of the cores is stored and can later be returned using getNodeOrder(). Enforces the sequential bucket priority queue algorithm.
+	 * @param enforceBucketQueueAlgorithm If set to @c true, uses the sequential algorithm with an array of degree buckets. Directed graphs always use it.
+	 * @param storeNodeOrder If set to @c true, the order in which the nodes are peeled is stored and can later be returned using getNodeOrder().
 	 */
 	CoreDecomposition(const Graph& G, bool normalized=false, bool enforceBucketQueueAlgorithm = false, bool storeNodeOrder = false);
 
@@ -80,13 +82,14 @@ public:
 	 *
 	 * This is only possible when storeNodeOrder was set.
 	 *
-	 * @return The nodes sorted by increasing core number.
+	 * @return The nodes sorted by increasing core number. Within a core, the nodes are in the order in
+	 * which they were peeled, so every node has at most maxCoreNumber() neighbors after it (a degeneracy ordering).
 	 */
 	const std::vector<node>& getNodeOrder() const;
 
 	/**
-	 * The algorithm ParK can run in parallel under certain conditions,
-	 * the bucket PQ based one cannot.
+	 * The algorithm PKC runs in parallel on undirected graphs,
+	 * the bucket based one cannot.
 	 */
 	virtual bool isParallel() const {
 		return canRunInParallel;
@@ -105,52 +108,20 @@ private:
 	std::vector<node> nodeOrder; // Stores the node order, i.e., all nodes sorted by core number
 
 	/**
-	 * Perform k-core decomposition of graph passed in constructor.
-	 * ParK is an algorithm by Naga Shailaja Dasari, Ranjan Desh, and Zubair M.
-	 * See http://ieeexplore.ieee.org/stamp/stamp.jsp?tp=&arnumber=7004366 for details.
+	 * Perform k-core decomposition of graph passed in constructor, in parallel.
+	 * PKC is an algorithm by Humayun Kabir and Kamesh Madduri, "Parallel k-Core
+	 * Decomposition on Multicore Platforms", IPDPSW 2017. Every thread peels the nodes it
+	 * finds at the current level and the neighbors whose degree drops to the level on its own,
+	 * with atomic degree decrements, so there is only one synchronization per level.
 	 */
-	void runWithParK();
+	void runWithPKC();
 
 	/**
 	 * Perform k-core decomposition of graph passed in constructor.
-	 * The algorithm is based on a bucket priority queue data structure.
-	 * It is generally slower than ParK but may be more flexible.
+	 * The algorithm by Batagelj and Zaversnik keeps the nodes bucket-sorted by remaining degree
+	 * in a single array. It is sequential but may be more flexible.
 	 */
 	void runWithBucketQueues();
-
-	/**
-	 * Determines nodes whose remaining degree equals @a level.
-	 * @param[in] level Shell number (= level) currently processed.
-	 * @param[in] degrees Remaining degree for each node.
-	 * @param[inout] curr Nodes to be processed in current level.
-	 */
-	void scan(index level, const std::vector<count>& degrees, std::vector<node>& curr);
-
-	/**
-	 * Determines in parallel the nodes whose remaining degree equals @a level.
-	 * @param[in] level Shell number (= level) currently processed.
-	 * @param[in] degrees Remaining degree for each node.
-	 * @param[inout] curr Nodes to be processed in current level.
-	 */
-	void scanParallel(index level, const std::vector<count>& degrees, std::vector<node>& curr, std::vector<char>& active);
-
-	/**
-	 * Processes nodes (and their neighbors) identified by previous scan.
-	 * @param[in] level Shell number (= level) currently processed.
-	 * @param[inout] degrees Remaining degree for each node.
-	 * @param[in] curr Nodes to be processed in this call.
-	 * @param[inout] next Nodes to be processed next in current level (certain neighbors of nodes in curr).
-	 */
-	void processSublevel(index level, std::vector<count>& degrees, const std::vector<node>& curr, std::vector<node>& next);
-
-	/**
-	 * Processes in parallel nodes (and their neighbors) identified by previous scan.
-	 * @param[in] level Shell number (= level) currently processed.
-	 * @param[inout] degrees Remaining degree for each node.
-	 * @param[in] curr Nodes to be processed in this call.
-	 * @param[inout] next Nodes to be processed next in current level (certain neighbors of nodes in curr).
-	 */
-	void processSublevelParallel(index level, std::vector<count>& degrees, const std::vector<node>& curr, std::vector<node>& next, std::vector<char>& active);
 };
 
 } /* namespace NetworKit */
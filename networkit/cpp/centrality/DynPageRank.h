@@ -0,0 +1,113 @@
+/*
+ * DynPageRank.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef DYNPAGERANK_H_
+#define DYNPAGERANK_H_
+
+#include <queue>
+#include <vector>
+
+#include "Centrality.h"
+#include "../base/DynAlgorithm.h"
+#include "../dynamics/GraphEvent.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * PageRank (as computed by PageRank) that is kept up to date under edge insertions, removals and weight changes.
+ *
+ * Besides the (unnormalized) rank vector x, the residual r = (1 - damp) / n + damp * P * x - x of the PageRank
+ * equation is stored for every node. After a batch of edge updates, only the residuals of the endpoints of the
+ * changed edges and of the out-neighbors of their sources change; they are recomputed and then pushed as in
+ * ApproximatePageRank: a node u with |r(u)| > tol adds r(u) to x(u) and distributes damp * r(u) to its out-neighbors.
+ * The work of an update is thus proportional to the region the change affects, not to the size of the graph.
+ * Node additions and removals change the teleport term of every node, in this case the power iteration is
+ * restarted from the previous vector.
+ *
+ * The graph has to be modified before update() or updateBatch() are called with the corresponding events.
+ */
+class DynPageRank: public Centrality, public DynAlgorithm {
+
+public:
+	/**
+	 * Constructs the DynPageRank class for the Graph @a G
+	 *
+	 * @param[in] G Graph to be processed.
+	 * @param[in] damp Damping factor of the PageRank algorithm.
+	 * @param[in] tol Maximum residual per node that is left unpushed.
+	 */
+	DynPageRank(const Graph& G, double damp = 0.85, double tol = 1e-9);
+
+	/**
+	 * Computes page rank on the graph passed in constructor.
+	 */
+	void run() override;
+
+	/**
+	 * Updates the page rank after the edge event @a e.
+	 */
+	void update(GraphEvent e) override;
+
+	/**
+	 * Updates the page rank after the batch of events @a batch.
+	 */
+	void updateBatch(const std::vector<GraphEvent>& batch) override;
+
+	/**
+	 * @return The number of pushes done by the last call of run(), update() or updateBatch().
+	 */
+	count numberOfPushes() const {
+		return pushes;
+	}
+
+	/**
+	 * Returns upper bound on the page rank: 1.0.
+	 */
+	double maximum() override {
+		return 1.0;
+	}
+
+private:
+	double damp;
+	double tol;
+	count n; // number of nodes the teleport term is based on
+	count pushes;
+	std::vector<double> pr; // unnormalized rank vector
+	std::vector<double> residual;
+	std::vector<edgeweight> deg;
+	std::vector<bool> queued;
+	std::queue<node> activeNodes;
+
+	/**
+	 * Computes the rank vector with the power iteration, starting from the previous vector if @a warmStart is true.
+	 */
+	void recompute(bool warmStart);
+
+	/**
+	 * @return The residual of @a v computed from its in-edges.
+	 */
+	double exactResidual(node v) const;
+
+	/**
+	 * Adds @a v to the nodes to push if its residual exceeds the tolerance.
+	 */
+	void activate(node v);
+
+	/**
+	 * Pushes residuals until no node exceeds the tolerance any more.
+	 */
+	void pushResiduals();
+
+	/**
+	 * Stores the rank vector, normalized to sum 1, in scoreData.
+	 */
+	void normalize();
+};
+
+} /* namespace NetworKit */
+#endif /* DYNPAGERANK_H_ */
@@ -6,69 +6,35 @@
  */
 
 #include "EigenvectorCentrality.h"
-#include "../auxiliary/NumericTools.h"
+#include <cmath>
 
 namespace NetworKit {
 
-EigenvectorCentrality::EigenvectorCentrality(const Graph& G, double tol):
-		Centrality(G, true), tol(tol)
+EigenvectorCentrality::EigenvectorCentrality(const Graph& G, double tol, PowerIteration::Norm norm):
+		Centrality(G, true), tol(tol), norm(norm)
 {
 
 }
 
 void EigenvectorCentrality::run() {
-	count z = G.upperNodeIdBound();
-	std::vector<double> values(z, 1.0);
-	scoreData = values;
-
-	double length = 0.0;
-	double oldLength = 0.0;
-
-	auto converged([&](double val, double other) {
-		// compute residual
-		return (Aux::NumericTools::equal(val, other, tol));
-	});
-
-	do {
-		oldLength = length;
-
-		// iterate matrix-vector product
-		G.parallelForNodes([&](node u) {
-			values[u] = 0.0;
-			G.forInEdgesOf(u, [&](node u, node v, edgeweight ew) {
-				values[u] += ew * scoreData[v];
-			});
-		});
-
-//		// set everything very small to zero
-//		G.parallelForNodes([&](node u) {
-//			if (values[u] < 1e-16) {
-//				values[u] = 0.0;
-//			}
-//		});
-
-		// normalize values
-		length = 0.0;
-		length = G.parallelSumForNodes([&](node u) {
-			return (values[u] * values[u]);
-		});
-		length = sqrt(length);
-
-//		TRACE("length: ", length);
-//		TRACE(values);
-
-		assert(! Aux::NumericTools::equal(length, 1e-16));
-		G.parallelForNodes([&](node u) {
-			values[u] /= length;
-		});
-
-//		TRACE(values);
-
-		scoreData = values;
-	} while (! converged(length, oldLength));
+	std::vector<node> nodes;
+	CSRMatrix A = PowerIteration::inEdgeMatrix(G, nodes);
+	count n = nodes.size();
+
+	// iterate with A + I, which has the same leading eigenvector as A, but no other eigenvalue of the
+	// same absolute value, so the iteration also converges on bipartite graphs
+	std::vector<double> values(n, 1.0);
+	PowerIteration iteration(A, 1.0, 1.0, 0.0, true);
+	iteration.run(values, tol, norm);
+
+	scoreData.assign(G.upperNodeIdBound(), 0.0);
+	#pragma omp parallel for
+	for (index i = 0; i < n; ++i) {
+		scoreData[nodes[i]] = values[i];
+	}
 
 	// check sign and correct if necessary
-	if (scoreData[0] < 0) {
+	if (n > 0 && values[0] < 0) {
 		G.parallelForNodes([&](node u) {
 			scoreData[u] = fabs(scoreData[u]);
 		});
@@ -9,6 +9,7 @@
 #define EIGENVECTORCENTRALITY_H_
 
 #include "Centrality.h"
+#include "../algebraic/algorithms/PowerIteration.h"
 
 namespace NetworKit {
 
@@ -20,6 +21,7 @@ namespace NetworKit {
 class EigenvectorCentrality: public Centrality {
 protected:
 	double tol; // error tolerance
+	PowerIteration::Norm norm; // norm of the difference of two successive iterations
 
 public:
 	/**
@@ -27,9 +29,10 @@ public:
 	 *
 	 * @param[in] G The graph.
 	 * @param[in] tol The tolerance for convergence.
+	 * @param[in] norm Norm of the difference of two successive iterations that is compared to @a tol.
 	 * TODO running time
 	 */
-	EigenvectorCentrality(const Graph& G, double tol = 1e-8);
+	EigenvectorCentrality(const Graph& G, double tol = 1e-8, PowerIteration::Norm norm = PowerIteration::L2);
 
 	/**
 	 * Computes eigenvector centrality on the graph passed in constructor.
@@ -6,67 +6,34 @@
  */
 
 #include "KatzCentrality.h"
-#include "../auxiliary/NumericTools.h"
 
 namespace NetworKit {
 
-KatzCentrality::KatzCentrality(const Graph& G, double alpha, double beta, double tol):
-		Centrality(G, true), alpha(alpha), beta(beta), tol(tol)
+KatzCentrality::KatzCentrality(const Graph& G, double alpha, double beta, double tol, PowerIteration::Norm norm):
+		Centrality(G, true), alpha(alpha), beta(beta), tol(tol), norm(norm)
 {
 
 }
 
 void KatzCentrality::run() {
-	count z = G.upperNodeIdBound();
-	std::vector<double> values(z, 1.0);
-	scoreData = values;
-	double length = 0.0;
-	double oldLength = 0.0;
-
-	auto converged([&](double val, double other) {
-		// compute residual
-		return (Aux::NumericTools::equal(val, other, tol));
-	});
-
-	do {
-		oldLength = length;
-
-		// iterate matrix-vector product
-		G.parallelForNodes([&](node u) {
-			values[u] = 0.0;
-			// note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
-			// we follow the verbal description, which requires to sum over the incoming edges
-			G.forInEdgesOf(u, [&](node v, edgeweight ew) {
-				values[u] += ew * scoreData[v];
-			});
-			values[u] *= alpha;
-			values[u] += beta;
-		});
-
-		// normalize values
-		length = 0.0;
-		length = G.parallelSumForNodes([&](node u) {
-			return (values[u] * values[u]);
-		});
-		length = sqrt(length);
-		G.parallelForNodes([&](node u) {
-			values[u] /= length;
-		});
-
-//		TRACE("length: ", length);
-//		TRACE(values);
-
-		scoreData = values;
-	} while (! converged(length, oldLength));
+	// note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
+	// we follow the verbal description, which requires to sum over the incoming edges
+	std::vector<node> nodes;
+	CSRMatrix A = PowerIteration::inEdgeMatrix(G, nodes);
+	count n = nodes.size();
+
+	// iterate values <- alpha * A^T * values + beta, normalized in 2-norm
+	std::vector<double> values(n, 1.0);
+	PowerIteration iteration(A, alpha, 0.0, beta, true);
+	iteration.run(values, tol, norm);
+
+	scoreData.assign(G.upperNodeIdBound(), 0.0);
+	#pragma omp parallel for
+	for (index i = 0; i < n; ++i) {
+		scoreData[nodes[i]] = values[i];
+	}
 
 	hasRun = true;
-
-//	// check sign and correct if necessary
-//	if (scoreData[0] < 0) {
-//		G.parallelForNodes([&](node u) {
-//			scoreData[u] = fabs(scoreData[u]);
-//		});
-//	}
 }
 
 } /* namespace NetworKit */
@@ -9,6 +9,7 @@
 #define KATZCENTRALITY_H_
 
 #include "Centrality.h"
+#include "../algebraic/algorithms/PowerIteration.h"
 
 namespace NetworKit {
 
@@ -24,6 +25,7 @@ protected:
 	double alpha; // damping
 	double beta; // constant centrality amount
 	double tol; // error tolerance
+	PowerIteration::Norm norm; // norm of the difference of two successive iterations
 
 public:
 	/**
@@ -34,8 +36,9 @@ public:
 	 * @param[in] alpha Damping of the matrix vector product result
 	 * @param[in] beta Constant value added to the centrality of each vertex
 	 * @param[in] tol The tolerance for convergence.
+	 * @param[in] norm Norm of the difference of two successive iterations that is compared to @a tol.
 	 */
-	KatzCentrality(const Graph& G, double alpha = 5e-4, double beta = 0.1, double tol = 1e-8);
+	KatzCentrality(const Graph& G, double alpha = 5e-4, double beta = 0.1, double tol = 1e-8, PowerIteration::Norm norm = PowerIteration::L2);
 
 	/**
 	 * Computes katz centrality on the graph passed in constructor.
@@ -7,65 +7,49 @@
 
 #include "PageRank.h"
 #include "../auxiliary/NumericTools.h"
-#include "../auxiliary/SignalHandling.h"
 
 namespace NetworKit {
 
-NetworKit::PageRank::PageRank(const Graph& G, double damp, double tol):
-		Centrality(G, true), damp(damp), tol(tol)
+NetworKit::PageRank::PageRank(const Graph& G, double damp, double tol, PowerIteration::Norm norm):
+		Centrality(G, true), damp(damp), tol(tol), norm(norm)
 {
 
 }
 
 void NetworKit::PageRank::run() {
-	Aux::SignalHandler handler;
-	count n = G.numberOfNodes();
 	count z = G.upperNodeIdBound();
-	double oneOverN = 1.0 / (double) n;
-	double teleportProb = (1.0 - damp) / (double) n;
-	scoreData.resize(z, oneOverN);
-	std::vector<double> pr = scoreData;
-	bool isConverged = false;
 
-	std::vector<double> deg(z, 0.0);
+	// the out-degree normalization is part of the matrix, so it is not recomputed per iteration
+	std::vector<double> invDeg(z, 0.0);
 	G.parallelForNodes([&](node u) {
-		deg[u] = (double) G.weightedDegree(u);
+		double deg = G.weightedDegree(u);
+		if (deg != 0.0) {
+			invDeg[u] = 1.0 / deg;
+		}
 	});
 
-	while (! isConverged) {
-		handler.assureRunning();
-		G.balancedParallelForNodes([&](node u) {
-			pr[u] = 0.0;
-			G.forInEdgesOf(u, [&](node u, node v, edgeweight w) {
-				// note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
-				// we follow the verbal description, which requires to sum over the incoming edges
-				pr[u] += scoreData[v] * w / deg[v];
-			});
-			pr[u] *= damp;
-			pr[u] += teleportProb;
-		});
-
-		auto converged([&]() {
-			double diff = G.parallelSumForNodes([&](node u) {
-				double d = scoreData[u] - pr[u];
-				return d * d;
-			});
-//			TRACE("sqrt(diff): ", sqrt(diff));
-			return (sqrt(diff) <= tol);
-		});
+	// note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
+	// we follow the verbal description, which requires to sum over the incoming edges
+	std::vector<node> nodes;
+	CSRMatrix A = PowerIteration::inEdgeMatrix(G, nodes, invDeg);
+	count n = nodes.size();
+	double teleportProb = (1.0 - damp) / (double) n;
+	std::vector<double> pr(n, 1.0 / (double) n);
+	PowerIteration iteration(A, damp, 0.0, teleportProb);
+	iteration.run(pr, tol, norm);
 
-		isConverged = converged();
-		scoreData = pr;
-	}
-	handler.assureRunning();
 	// make sure scoreData sums up to 1
-	double sum = G.parallelSumForNodes([&](node u) {
-		return scoreData[u];
-	});
+	double sum = 0.0;
+	#pragma omp parallel for reduction(+:sum)
+	for (index i = 0; i < n; ++i) {
+		sum += pr[i];
+	}
 	assert(! Aux::NumericTools::equal(sum, 0.0, 1e-15));
-	G.parallelForNodes([&](node u) {
-		scoreData[u] /= sum;
-	});
+	scoreData.assign(z, 0.0);
+	#pragma omp parallel for
+	for (index i = 0; i < n; ++i) {
+		scoreData[nodes[i]] = pr[i] / sum;
+	}
 
 	hasRun = true;
 }
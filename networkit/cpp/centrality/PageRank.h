@@ -9,6 +9,7 @@
 #define PAGERANK_H_
 
 #include "Centrality.h"
+#include "../algebraic/algorithms/PowerIteration.h"
 
 namespace NetworKit {
 
@@ -23,6 +24,7 @@ class PageRank: public NetworKit::Centrality {
 protected:
 	double damp;
 	double tol;
+	PowerIteration::Norm norm;
 
 public:
 	/**
@@ -31,8 +33,9 @@ public:
 	 * @param[in] G Graph to be processed.
 	 * @param[in] damp Damping factor of the PageRank algorithm.
 	 * @param[in] tol Error tolerance for PageRank iteration.
+	 * @param[in] norm Norm of the difference of two successive iterations that is compared to @a tol.
 	 */
-	PageRank(const Graph& G, double damp=0.85, double tol = 1e-8);
+	PageRank(const Graph& G, double damp=0.85, double tol = 1e-8, PowerIteration::Norm norm = PowerIteration::L2);
 
 	/**
 	 * Computes page rank on the graph passed in constructor.
@@ -15,7 +15,7 @@
 #include "../components/ConnectedComponents.h"
 #include "../components/StronglyConnectedComponents.h"
 #include "../auxiliary/PrioQueueForInts.h"
-#include "../auxiliary/PrioQueue.h"
+#include "../auxiliary/DAryHeap.h"
 #include "../auxiliary/Log.h"
 #include "../distance/SSSP.h"
 #include "../distance/Dijkstra.h"
@@ -405,7 +405,7 @@ double TopCloseness::BFScut(node v, double x, bool *visited, count *distances, n
 
 void TopCloseness::run() {
     init();
-    Aux::PrioQueue<double, node> top(n); // like in Crescenzi
+    Aux::DAryHeap<double, node> top(n); // like in Crescenzi
     std::vector<bool> toAnalyze(n, true);
     omp_lock_t lock;
     omp_init_lock(&lock);
@@ -427,7 +427,7 @@ void TopCloseness::run() {
             farness[u] = -((double) G.degreeOut(u));
         }
     });
-    Aux::PrioQueue<double, node> Q(farness);
+    Aux::DAryHeap<double, node> Q(farness);
     DEBUG("Done filling the queue");
 
 #pragma omp parallel // Shared variables:
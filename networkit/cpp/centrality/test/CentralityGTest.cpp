@@ -27,10 +27,12 @@
 #include "../PermanenceCentrality.h"
 #include "../../structures/Partition.h"
 #include "../../auxiliary/Timer.h"
+#include "../../auxiliary/Random.h"
 #include "../../generators/ErdosRenyiGenerator.h"
 #include "../../generators/DorogovtsevMendesGenerator.h"
 #include "../TopCloseness.h"
 #include <iostream>
+#include <omp.h>
 #include <iomanip>
 
 
@@ -69,6 +71,34 @@ TEST_F(CentralityGTest, testBetweennessCentrality) {
 }
 
 
+TEST_F(CentralityGTest, testBetweennessScaledPathCounting) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(200, 0.03).generate();
+	Graph Gw(G, true, true);
+	Gw.forEdges([&](node u, node v) {
+		Gw.setWeight(u, v, (double) Aux::Random::integer(1, 3));
+	});
+
+	for (Graph* H : {&G, &Gw}) {
+		H->indexEdges();
+		Betweenness exact(*H, false, true, Betweenness::BIGFLOAT);
+		Betweenness scaled(*H, false, true, Betweenness::SCALED_DOUBLE);
+		exact.run();
+		scaled.run();
+		std::vector<double> expected = exact.scores();
+		std::vector<double> bc = scaled.scores();
+		H->forNodes([&](node u) {
+			EXPECT_NEAR(expected[u], bc[u], 1e-9 * std::max(1.0, expected[u]));
+		});
+		std::vector<double> expectedEdges = exact.edgeScores();
+		std::vector<double> edgeBc = scaled.edgeScores();
+		H->forEdges([&](node, node, edgeid eid) {
+			EXPECT_NEAR(expectedEdges[eid], edgeBc[eid], 1e-9 * std::max(1.0, expectedEdges[eid]));
+		});
+	}
+}
+
+
 TEST_F(CentralityGTest, testBetweenness2Centrality) {
 /* Graph:
 	0    3
@@ -282,6 +312,67 @@ TEST_F(CentralityGTest, testPageRankCentrality) {
 	EXPECT_NEAR(0.0565, fabs(cen[7]), tol);
 }
 
+TEST_F(CentralityGTest, testApproxBetweennessThreadIndependent) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(200, 0.03).generate();
+
+	std::vector<std::vector<double>> results;
+	int threads = omp_get_max_threads();
+	for (int t : {1, 4}) {
+		omp_set_num_threads(t);
+		Aux::Random::setSeed(7, true);
+		ApproxBetweenness abc(G, 0.1, 0.1);
+		abc.run();
+		results.push_back(abc.scores());
+	}
+	omp_set_num_threads(threads);
+	EXPECT_EQ(results[0], results[1]);
+}
+
+TEST_F(CentralityGTest, testPageRankConvergenceNorms) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(300, 0.03, true).generate();
+	G.removeNode(7); // rows of the iteration matrix are renumbered around deleted nodes
+
+	PageRank l2(G, 0.85, 1e-10);
+	l2.run();
+	std::vector<double> reference = l2.scores();
+	EXPECT_EQ(0.0, reference[7]);
+
+	double sum = 0.0;
+	G.forNodes([&](node u) {
+		sum += reference[u];
+	});
+	EXPECT_NEAR(1.0, sum, 1e-12);
+
+	for (PowerIteration::Norm norm : {PowerIteration::L1, PowerIteration::MAX}) {
+		PageRank pr(G, 0.85, 1e-10, norm);
+		pr.run();
+		std::vector<double> scores = pr.scores();
+		G.forNodes([&](node u) {
+			EXPECT_NEAR(reference[u], scores[u], 1e-8);
+		});
+	}
+}
+
+TEST_F(CentralityGTest, testEigenvectorCentralityBipartite) {
+	// the adjacency matrix of a star has the eigenvalues sqrt(k) and -sqrt(k),
+	// the leading eigenvector is 1/sqrt(2) at the center and 1/sqrt(2k) at the leaves
+	count k = 16;
+	Graph G(k + 1);
+	for (node v = 1; v <= k; ++v) {
+		G.addEdge(0, v);
+	}
+
+	EigenvectorCentrality centrality(G, 1e-10);
+	centrality.run();
+	std::vector<double> cen = centrality.scores();
+	EXPECT_NEAR(1.0 / sqrt(2.0), cen[0], 1e-8);
+	for (node v = 1; v <= k; ++v) {
+		EXPECT_NEAR(1.0 / sqrt(2.0 * k), cen[v], 1e-8);
+	}
+}
+
 TEST_F(CentralityGTest, benchSequentialBetweennessCentralityOnRealGraph) {
 	METISGraphReader reader;
 	Graph G = reader.read("input/celegans_metabolic.graph");
@@ -470,6 +561,21 @@ TEST_F(CentralityGTest, testClosenessCentrality) {
 }
 
 
+TEST_F(CentralityGTest, testClosenessCentralityDeltaStepping) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(200, 0.05).generate();
+	Graph Gw(G, true, false);
+	Gw.forEdges([&](node u, node v) {
+		Gw.setWeight(u, v, (double) Aux::Random::integer(1, 10));
+	});
+
+	Closeness dijkstra(Gw, true, false);
+	dijkstra.run();
+	Closeness deltaStepping(Gw, true, false, SSSP::DELTA_STEPPING);
+	deltaStepping.run();
+	EXPECT_EQ(dijkstra.scores(), deltaStepping.scores());
+}
+
 TEST_F(CentralityGTest, testKPathCentrality) {
     METISGraphReader reader;
     Graph G = reader.read("input/power.graph");
@@ -569,6 +675,48 @@ TEST_F(CentralityGTest, testCoreDecomposition) {
 	EXPECT_ANY_THROW(CoreDecomposition CoreDec(H));
 }
 
+TEST_F(CentralityGTest, testCoreDecompositionParallelPeelingOrder) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(3000, 0.01).generate();
+	for (node u = 0; u < 3000; u += 37) {
+		std::vector<node> neighbors = G.neighbors(u);
+		for (node v : neighbors) {
+			G.removeEdge(u, v);
+		}
+		G.removeNode(u);
+	}
+
+	CoreDecomposition sequential(G, false, true);
+	sequential.run();
+	CoreDecomposition parallel(G, false, false, true);
+	EXPECT_TRUE(parallel.isParallel());
+	parallel.run();
+	EXPECT_EQ(sequential.maxCoreNumber(), parallel.maxCoreNumber());
+	G.forNodes([&](node u) {
+		EXPECT_EQ(sequential.score(u), parallel.score(u));
+	});
+
+	// in the peeling order, every node has at most as many later neighbors as its core number
+	const std::vector<node>& order = parallel.getNodeOrder();
+	ASSERT_EQ(G.numberOfNodes(), order.size());
+	std::vector<index> position(G.upperNodeIdBound(), none);
+	for (index i = 0; i < order.size(); ++i) {
+		ASSERT_TRUE(G.hasNode(order[i]));
+		ASSERT_EQ(none, position[order[i]]);
+		position[order[i]] = i;
+	}
+	G.forNodes([&](node u) {
+		count later = 0;
+		G.forNeighborsOf(u, [&](node v) {
+			later += position[v] > position[u];
+		});
+		EXPECT_LE(later, parallel.score(u));
+		if (position[u] > 0) {
+			EXPECT_LE(parallel.score(order[position[u] - 1]), parallel.score(u));
+		}
+	});
+}
+
 TEST_F(CentralityGTest, benchCoreDecompositionSnapGraphs) {
 	SNAPGraphReader reader;
 	std::vector<std::string> filenames = {"soc-LiveJournal1.edgelist-t0.graph", "cit-Patents.txt", "com-orkut.ungraph.txt", "web-BerkStan.edgelist-t0.graph"};
@@ -0,0 +1,89 @@
+/*
+ * DynPageRankGTest.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include "DynPageRankGTest.h"
+#include "../DynPageRank.h"
+#include "../PageRank.h"
+#include "../../auxiliary/Random.h"
+#include "../../graph/Sampling.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+
+namespace NetworKit {
+
+static void expectSameRanks(const Graph& G, const std::vector<double>& dyn, double tol) {
+	PageRank pr(G, 0.85, 1e-12);
+	pr.run();
+	std::vector<double> expected = pr.scores();
+	G.forNodes([&](node u) {
+		EXPECT_NEAR(expected[u], dyn[u], tol);
+	});
+}
+
+TEST_F(DynPageRankGTest, testEdgeUpdates) {
+	Aux::Random::setSeed(42, false);
+	for (bool directed : {false, true}) {
+		Graph G = ErdosRenyiGenerator(500, 0.02, directed).generate();
+		DynPageRank dpr(G, 0.85, 1e-12);
+		dpr.run();
+		expectSameRanks(G, dpr.scores(), 1e-9);
+
+		std::vector<GraphEvent> batch;
+		count i = 0;
+		while (i < 10) {
+			node u = Sampling::randomNode(G);
+			node v = Sampling::randomNode(G);
+			if (u != v && !G.hasEdge(u, v)) {
+				G.addEdge(u, v);
+				batch.push_back(GraphEvent(GraphEvent::EDGE_ADDITION, u, v, 1.0));
+				++i;
+			}
+		}
+		i = 0;
+		while (i < 10) {
+			node u = Sampling::randomNode(G);
+			if (G.degree(u) > 0) {
+				node v = G.randomNeighbor(u);
+				G.removeEdge(u, v);
+				batch.push_back(GraphEvent(GraphEvent::EDGE_REMOVAL, u, v));
+				++i;
+			}
+		}
+		dpr.updateBatch(batch);
+		expectSameRanks(G, dpr.scores(), 1e-9);
+
+		// isolating a node leaves only the teleport probability for it
+		node u = Sampling::randomNode(G);
+		std::vector<node> neighbors;
+		G.forNeighborsOf(u, [&](node v) {
+			neighbors.push_back(v);
+		});
+		for (node v : neighbors) {
+			G.removeEdge(u, v);
+			dpr.update(GraphEvent(GraphEvent::EDGE_REMOVAL, u, v));
+		}
+		expectSameRanks(G, dpr.scores(), 1e-9);
+	}
+}
+
+TEST_F(DynPageRankGTest, testNodeAddition) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(300, 0.03, true).generate();
+	DynPageRank dpr(G);
+	dpr.run();
+
+	node u = G.addNode();
+	G.addEdge(u, 0);
+	G.addEdge(1, u);
+	std::vector<GraphEvent> batch;
+	batch.push_back(GraphEvent(GraphEvent::NODE_ADDITION, u));
+	batch.push_back(GraphEvent(GraphEvent::EDGE_ADDITION, u, 0));
+	batch.push_back(GraphEvent(GraphEvent::EDGE_ADDITION, 1, u));
+	dpr.updateBatch(batch);
+	expectSameRanks(G, dpr.scores(), 1e-7);
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,20 @@
+/*
+ * DynPageRankGTest.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef DYNPAGERANKGTEST_H_
+#define DYNPAGERANKGTEST_H_
+
+#include <gtest/gtest.h>
+
+namespace NetworKit {
+
+class DynPageRankGTest: public testing::Test {
+};
+
+} /* namespace NetworKit */
+
+#endif /* DYNPAGERANKGTEST_H_ */
@@ -7,128 +7,145 @@
 
 #include "ParallelPartitionCoarsening.h"
 #include <omp.h>
+#include <algorithm>
 #include "../graph/GraphBuilder.h"
 #include "../auxiliary/Timer.h"
 #include "../auxiliary/Log.h"
 
 namespace NetworKit {
 
-ParallelPartitionCoarsening::ParallelPartitionCoarsening(const Graph& G, const Partition& zeta, bool useGraphBuilder) : GraphCoarsening(G), zeta(zeta),	useGraphBuilder(useGraphBuilder) {
-
-}
-
-void ParallelPartitionCoarsening::run() {
-	Aux::Timer timer;
-	timer.start();
-
-	Partition nodeToSuperNode = zeta;
-	nodeToSuperNode.compact((zeta.upperBound() <= G.upperNodeIdBound())); // use turbo if the upper id bound is <= number of nodes
-	count nextNodeId = nodeToSuperNode.upperBound();
-
-	Graph Gcombined;
-	if (!useGraphBuilder) {
-		Graph Ginit(nextNodeId, true); // initial graph containing supernodes
+namespace {
 
-		// make copies of initial graph
-		count nThreads = omp_get_max_threads();
-		std::vector<Graph> localGraphs(nThreads, Ginit); // thread-local graphs
-
-
-		// iterate over edges of G and create edges in coarse graph or update edge and node weights in Gcon
-		DEBUG("create edges in coarse graphs");
-		G.parallelForEdges([&](node u, node v, edgeweight ew) {
-			index t = omp_get_thread_num();
+/**
+ * Sums up the weights of the edges from one supernode to the other supernodes in an
+ * open-addressing hash table with linear probing. The table grows with the number of
+ * distinct neighbors, not with the number of edges, and only the used slots are reset.
+ */
+class WeightAccumulator {
+public:
+	WeightAccumulator() : logCapacity(4), keys(16, none), weights(16, 0.0) {
+	}
 
-			node su = nodeToSuperNode[u];
-			node sv = nodeToSuperNode[v];
-			localGraphs.at(t).increaseWeight(su, sv, ew);
+	void add(node key, edgeweight ew) {
+		index i = find(key);
+		if (keys[i] == none) {
+			keys[i] = key;
+			used.push_back(i);
+			if (2 * used.size() > keys.size()) {
+				grow();
+				i = find(key);
+			}
+		}
+		weights[i] += ew;
+	}
 
+	/**
+	 * Calls @a handle(key, weight) in ascending order of the keys and empties the table.
+	 */
+	template<typename L> void forEntriesAndClear(L handle) {
+		std::sort(used.begin(), used.end(), [&](index i, index j) {
+			return keys[i] < keys[j];
 		});
+		for (index i : used) {
+			handle(keys[i], weights[i]);
+			keys[i] = none;
+			weights[i] = 0.0;
+		}
+		used.clear();
+	}
 
+private:
+	count logCapacity;
+	std::vector<node> keys;
+	std::vector<edgeweight> weights;
+	std::vector<index> used;
+
+	index find(node key) const {
+		const index mask = keys.size() - 1;
+		index i = (key * 0x9E3779B97F4A7C15ULL) >> (64 - logCapacity);
+		while (keys[i] != none && keys[i] != key) {
+			i = (i + 1) & mask;
+		}
+		return i;
+	}
 
-		Aux::Timer timer2;
-		timer2.start();
-		// combine local graphs in parallel
-		// Graph Gcombined(Ginit.numberOfNodes(), true); //
-		Gcombined = Graph(Ginit.numberOfNodes(), true);
-
-		std::vector<count> numEdges(nThreads);
-
-
-		// access internals of Graph to write adjacencies
-		auto threadSafeIncreaseWeight = [&](node u, node v, edgeweight ew) {
-
-			index vi = Gcombined.indexInOutEdgeArray(u, v);
-			if (vi == none) {
-				index t = omp_get_thread_num();
-				if (u == v) {
-					numEdges[t] += 2;
-				} else {
-					numEdges[t] += 1; // normal edges count half
-				}
-				Gcombined.outDeg[u]++;
-				Gcombined.outEdges[u].push_back(v);
-				Gcombined.outEdgeWeights[u].push_back(ew);
-			} else {
-				Gcombined.outEdgeWeights[u][vi] += ew;
-			}
-
-		};
+	void grow() {
+		std::vector<node> oldKeys(2 * keys.size(), none);
+		std::vector<edgeweight> oldWeights(2 * keys.size(), 0.0);
+		std::swap(keys, oldKeys);
+		std::swap(weights, oldWeights);
+		++logCapacity;
+		for (index& i : used) {
+			const index j = find(oldKeys[i]);
+			keys[j] = oldKeys[i];
+			weights[j] = oldWeights[i];
+			i = j;
+		}
+	}
+};
 
-		DEBUG("combining graphs");
-		Gcombined.balancedParallelForNodes([&](node u) {
-			for (index l = 0; l < nThreads; ++l) {
-				localGraphs.at(l).forEdgesOf(u, [&](node u, node v, edgeweight w) {
-					TRACE("increasing weight of (", u, v, ") to", w);
-					threadSafeIncreaseWeight(u, v, w);
-				});
-			}
-		});
+} /* namespace */
 
+ParallelPartitionCoarsening::ParallelPartitionCoarsening(const Graph& G, const Partition& zeta, bool useGraphBuilder) : GraphCoarsening(G), zeta(zeta),	useGraphBuilder(useGraphBuilder) {
 
-		// ensure consistency of data structure
-		DEBUG("numEdges: ", numEdges);
-		count twiceM = std::accumulate(numEdges.begin(), numEdges.end(), 0);
-		assert (twiceM % 2 == 0);
-		Gcombined.m = (twiceM / 2);
+}
 
-		assert (Gcombined.checkConsistency());
+void ParallelPartitionCoarsening::run() {
+	Aux::Timer timer;
+	timer.start();
 
-		// stop both timers before printing
-		timer2.stop();
-		INFO("combining coarse graphs took ", timer2.elapsedTag());
-	} else {
-		std::vector< std::vector<node> > nodesPerSuperNode(nextNodeId);
-		G.forNodes([&](node v) {
-			node sv = nodeToSuperNode[v];
-			nodesPerSuperNode[sv].push_back(v);
-		});
+	Partition nodeToSuperNode = zeta;
+	nodeToSuperNode.compact((zeta.upperBound() <= G.upperNodeIdBound())); // use turbo if the upper id bound is <= number of nodes
+	count nextNodeId = nodeToSuperNode.upperBound();
 
-		// iterate over edges of G and create edges in coarse graph or update edge and node weights in Gcon
-		DEBUG("create edges in coarse graphs");
-		GraphBuilder b(nextNodeId, true, false);
-		#pragma omp parallel for schedule(guided)
+	// group the nodes by supernode with a counting sort
+	std::vector<index> memberBegin(nextNodeId + 1, 0);
+	G.parallelForNodes([&](node v) {
+		#pragma omp atomic
+		memberBegin[nodeToSuperNode[v] + 1]++;
+	});
+	for (index su = 0; su < nextNodeId; su++) {
+		memberBegin[su + 1] += memberBegin[su];
+	}
+	std::vector<node> members(memberBegin[nextNodeId]);
+	std::vector<index> position(memberBegin.begin(), memberBegin.begin() + nextNodeId);
+	G.parallelForNodes([&](node v) {
+		index pos;
+		#pragma omp atomic capture
+		pos = position[nodeToSuperNode[v]]++;
+		members[pos] = v;
+	});
+
+	// iterate over edges of G and create edges in coarse graph
+	DEBUG("create edges in coarse graphs");
+	GraphBuilder b(nextNodeId, true, false);
+	#pragma omp parallel
+	{
+		WeightAccumulator outEdges;
+		#pragma omp for schedule(guided)
 		for (node su = 0; su < nextNodeId; su++) {
-			std::map<index, edgeweight> outEdges;
-			for (node u : nodesPerSuperNode[su]) {
+			// fixed order of the members, so that the weights do not depend on the scheduling
+			std::sort(members.begin() + memberBegin[su], members.begin() + memberBegin[su + 1]);
+			for (index i = memberBegin[su]; i < memberBegin[su + 1]; i++) {
+				node u = members[i];
 				G.forNeighborsOf(u, [&](node v, edgeweight ew) {
 					node sv = nodeToSuperNode[v];
 					if (su != sv || u >= v) { // count edges inside uv only once (we iterate over them twice)
-						outEdges[sv] += ew;
+						outEdges.add(sv, ew);
 					}
 				});
 			}
-			for (auto it : outEdges) {
-				b.addHalfEdge(su, it.first, it.second);
-			}
+			outEdges.forEntriesAndClear([&](node sv, edgeweight ew) {
+				b.addHalfEdge(su, sv, ew);
+			});
 		}
-
-		Gcombined = b.toGraph(false);
 	}
 
+	// both half edges of every coarse edge have been added, so the adjacency arrays are moved into the graph
+	Gcoarsened = b.toGraph(false);
+
 	timer.stop();
 	INFO("parallel coarsening took ", timer.elapsedTag());
-	Gcoarsened = std::move(Gcombined);
 	nodeMapping = nodeToSuperNode.getVector();
 	hasRun = true;
 }
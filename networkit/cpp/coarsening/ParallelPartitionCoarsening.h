@@ -16,9 +16,20 @@ namespace NetworKit {
 
 /**
  * @ingroup coarsening
+ * Contracts every subset of a partition into a supernode. The weight of a coarse edge is the
+ * total weight of the edges between its supernodes, edges inside a subset become a self-loop.
+ *
+ * Every supernode is handled by one thread, which sums up the weights of its coarse edges in a
+ * thread-local hash table. The adjacency arrays are then moved into the coarse graph, so apart
+ * from the coarse graph only O(n) memory is used.
  */
 class ParallelPartitionCoarsening: public NetworKit::GraphCoarsening {
 public:
+	/**
+	 * @param[in]	G	the graph
+	 * @param[in]	zeta	the partition of the nodes of @a G
+	 * @param[in]	useGraphBuilder	ignored, kept for compatibility
+	 */
 	ParallelPartitionCoarsening(const Graph& G, const Partition& zeta, bool useGraphBuilder = true);
 
 	virtual void run();
@@ -10,6 +10,7 @@
 #include "CoarseningGTest.h"
 
 #include "../../auxiliary/Log.h"
+#include "../../auxiliary/Random.h"
 #include "../../community/ClusteringGenerator.h"
 #include "../../coarsening/ClusteringProjector.h"
 #include "../../community/GraphClusteringTools.h"
@@ -229,6 +230,38 @@ TEST_F(CoarseningGTest, testParallelPartitionCoarseningOnRealGraphWithGraphBuild
 	});
 }
 
+TEST_F(CoarseningGTest, testParallelPartitionCoarseningEdgeWeights) {
+	Aux::Random::setSeed(42, false);
+	ErdosRenyiGenerator ERGen(300, 0.1);
+	Graph G = ERGen.generate();
+	Graph Gw(G, true, false);
+	Gw.forEdges([&](node u, node v) {
+		Gw.setWeight(u, v, Aux::Random::probability());
+	});
+	Gw.addEdge(5, 5, 2.0);
+
+	ClusteringGenerator clusteringGen;
+	Partition random = clusteringGen.makeRandomClustering(Gw, 20);
+	ParallelPartitionCoarsening coarsening(Gw, random);
+	coarsening.run();
+	Graph Gcon = coarsening.getCoarseGraph();
+	std::vector<node> toCoarse = coarsening.getFineToCoarseNodeMapping();
+
+	// the weight of a coarse edge is the total weight of the edges between its supernodes
+	std::map<std::pair<node, node>, edgeweight> expected;
+	Gw.forEdges([&](node u, node v, edgeweight ew) {
+		node su = std::min(toCoarse[u], toCoarse[v]);
+		node sv = std::max(toCoarse[u], toCoarse[v]);
+		expected[std::make_pair(su, sv)] += ew;
+	});
+	EXPECT_EQ(expected.size(), Gcon.numberOfEdges());
+	for (auto& e : expected) {
+		EXPECT_NEAR(e.second, Gcon.weight(e.first.first, e.first.second), 1e-9);
+	}
+	EXPECT_NEAR(Gw.totalEdgeWeight(), Gcon.totalEdgeWeight(), 1e-9);
+	EXPECT_TRUE(Gcon.checkConsistency());
+}
+
 TEST_F(CoarseningGTest, testMatchingContractor) {
 	METISGraphReader reader;
 	Graph G = reader.read("input/celegans_metabolic.graph");
@@ -8,6 +8,7 @@
 #include "PLP.h"
 
 #include <omp.h>
+#include <limits>
 #include "../Globals.h"
 #include "../auxiliary/Log.h"
 #include "../auxiliary/Timer.h"
@@ -19,7 +20,7 @@ PLP::PLP(const Graph& G, count theta, count maxIterations) : CommunityDetectionA
 }
 
 
-PLP::PLP(const Graph& G, const Partition baseClustering, count theta) : CommunityDetectionAlgorithm(G, baseClustering), updateThreshold(theta) {
+PLP::PLP(const Graph& G, const Partition baseClustering, count theta) : CommunityDetectionAlgorithm(G, baseClustering), updateThreshold(theta), maxIterations(none) {
 }
 
 void PLP::run() {
@@ -60,8 +61,22 @@ void PLP::run() {
 	 * In general this does not work. It was changed to: No label was changed in last iteration.
 	 */
 
-	std::vector<bool> activeNodes(z); // record if node must be processed
-	activeNodes.assign(z, true);
+	// the frontier holds the nodes to be processed in the next iteration, initially all non-isolated nodes
+	std::vector<node> frontier;
+	frontier.reserve(n);
+	G.forNodes([&](node v) {
+		if (G.degree(v) > 0) {
+			frontier.push_back(v);
+		}
+	});
+	std::vector<uint8_t> activeNodes(z, 0); // record if node is in the next frontier
+	const count maxThreads = omp_get_max_threads();
+	std::vector<std::vector<node>> nextPerThread(maxThreads);
+
+	// label weights of the neighborhood in a dense array per thread, only the touched labels are reset
+	const count labelBound = result.upperBound();
+	const edgeweight unused = -std::numeric_limits<edgeweight>::infinity();
+	std::vector<std::vector<edgeweight>> labelWeightsPerThread(maxThreads);
 
 	Aux::Timer runtime;
 
@@ -69,42 +84,83 @@ void PLP::run() {
 	while ((nUpdated > this->updateThreshold)  && (nIterations < maxIterations)) { // as long as a label has changed... or maximum iterations reached
 		runtime.start();
 		nIterations += 1;
-		DEBUG("[BEGIN] LabelPropagation: iteration #" , nIterations);
+		DEBUG("[BEGIN] LabelPropagation: iteration #" , nIterations, ", ", frontier.size(), " active nodes");
 
 		// reset updated
 		nUpdated = 0;
 
-		G.balancedParallelForNodes([&](node v){
-			if ((activeNodes[v]) && (G.degree(v) > 0)) {
+		#pragma omp parallel
+		{
+			const index t = omp_get_thread_num();
+			std::vector<edgeweight>& labelWeights = labelWeightsPerThread[t];
+			if (labelWeights.empty()) {
+				labelWeights.assign(labelBound, unused);
+			}
+			std::vector<label> touched;
+			std::vector<node>& next = nextPerThread[t];
+
+			#pragma omp for
+			for (index i = 0; i < frontier.size(); ++i) {
+				activeNodes[frontier[i]] = 0;
+			}
 
-				std::map<label, double> labelWeights; // neighborLabelCounts maps label -> frequency in the neighbors
+			auto activate = [&](node u) {
+				if (__atomic_exchange_n(&activeNodes[u], 1, __ATOMIC_RELAXED) == 0) {
+					next.push_back(u);
+				}
+			};
+
+			#pragma omp for schedule(guided) reduction(+:nUpdated)
+			for (index i = 0; i < frontier.size(); ++i) {
+				node v = frontier[i];
 
 				// weigh the labels in the neighborhood of v
+				touched.clear();
 				G.forNeighborsOf(v, [&](node w, edgeweight weight) {
 					label lw = result.subsetOf(w);
+					if (lw >= labelBound) {
+						return; // unassigned neighbor
+					}
+					if (labelWeights[lw] == unused) {
+						labelWeights[lw] = 0;
+						touched.push_back(lw);
+					}
 					labelWeights[lw] += weight; // add weight of edge {v, w}
 				});
 
-				// get heaviest label
-				label heaviest = std::max_element(labelWeights.begin(),
-								labelWeights.end(),
-								[](const std::pair<label, edgeweight>& p1, const std::pair<label, edgeweight>& p2) {
-									return p1.second < p2.second;})->first;
+				// get heaviest label, the smallest one in case of ties
+				label heaviest = none;
+				edgeweight heaviestWeight = unused;
+				for (label l : touched) {
+					if (labelWeights[l] > heaviestWeight || (labelWeights[l] == heaviestWeight && l < heaviest)) {
+						heaviest = l;
+						heaviestWeight = labelWeights[l];
+					}
+					labelWeights[l] = unused;
+				}
 
-				if (result.subsetOf(v) != heaviest) { // UPDATE
+				if (heaviest != none && result.subsetOf(v) != heaviest) { // UPDATE
 					result.moveToSubset(heaviest,v); //result[v] = heaviest;
-					nUpdated += 1; // TODO: atomic update?
+					nUpdated += 1;
+					activate(v);
 					G.forNeighborsOf(v, [&](node u) {
-						activeNodes[u] = true;
+						activate(u);
 					});
-				} else {
-					activeNodes[v] = false;
 				}
-
-			} else {
-				// node is isolated
 			}
-		});
+		}
+
+		// the nodes activated by all threads form the next frontier
+		std::vector<index> offset(maxThreads + 1, 0);
+		for (index t = 0; t < maxThreads; ++t) {
+			offset[t + 1] = offset[t] + nextPerThread[t].size();
+		}
+		frontier.resize(offset[maxThreads]);
+		#pragma omp parallel for schedule(static, 1)
+		for (index t = 0; t < maxThreads; ++t) {
+			std::copy(nextPerThread[t].begin(), nextPerThread[t].end(), frontier.begin() + offset[t]);
+			nextPerThread[t].clear();
+		}
 
 		// for each while loop iteration...
 
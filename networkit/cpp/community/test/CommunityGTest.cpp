@@ -149,6 +149,30 @@ TEST_F(CommunityGTest, testLabelPropagationOnManySmallClusters) {
 
 
 
+TEST_F(CommunityGTest, testLabelPropagationWithStableBaseClustering) {
+	// two weighted triangles joined by a light edge, already clustered
+	Graph G(6, true);
+	G.addEdge(0, 1, 2.0);
+	G.addEdge(1, 2, 2.0);
+	G.addEdge(0, 2, 2.0);
+	G.addEdge(3, 4, 2.0);
+	G.addEdge(4, 5, 2.0);
+	G.addEdge(3, 5, 2.0);
+	G.addEdge(2, 3, 1.0);
+	Partition base(6);
+	base.setUpperBound(2);
+	for (node v = 0; v < 6; ++v) {
+		base.addToSubset(v / 3, v);
+	}
+
+	PLP lp(G, base, 0);
+	lp.run();
+	Partition zeta = lp.getPartition();
+
+	EXPECT_EQ(1u, lp.numberOfIterations()) << "no label changes, so the frontier is empty after the first iteration";
+	EXPECT_TRUE(GraphClusteringTools::equalClusterings(zeta, base, G));
+}
+
 /*
 TEST_F(CommunityGTest, testLouvainParallel2Naive) {
 	count n = 1000;
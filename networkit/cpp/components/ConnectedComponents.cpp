@@ -6,13 +6,18 @@
  */
 
 #include <set>
+#include <unordered_map>
 
 #include "ConnectedComponents.h"
+#include "../structures/ConcurrentUnionFind.h"
 #include "../structures/Partition.h"
 #include "../auxiliary/Log.h"
 
 namespace NetworKit {
 
+const count ConnectedComponents::neighborRounds = 2;
+const count ConnectedComponents::giantSamples = 1024;
+
 ConnectedComponents::ConnectedComponents(const Graph& G) : G(G), hasRun(false) {
 	if (G.isDirected()) {
 		throw std::runtime_error("Error, connected components of directed graphs cannot be computed, use StronglyConnectedComponents for them.");
@@ -21,35 +26,70 @@ ConnectedComponents::ConnectedComponents(const Graph& G) : G(G), hasRun(false) {
 
 void ConnectedComponents::run() {
 	DEBUG("initializing labels");
-	component = Partition(G.upperNodeIdBound(), none);
+	const count z = G.upperNodeIdBound();
+	component = Partition(z, none);
 	numComponents = 0;
 
-	std::queue<node> q;
+	if (G.numberOfNodes() == 0) {
+		hasRun = true;
+		return;
+	}
+
+	// Afforest (Sutton et al., IPDPS 2018): link every node to a few of its neighbors first,
+	// which already connects most of the giant component, then only the nodes outside of it
+	// have to process their remaining edges
+	ConcurrentUnionFind uf(z);
+	for (index r = 0; r < neighborRounds; ++r) {
+		G.balancedParallelForNodes([&](node u) {
+			if (r < G.degree(u)) {
+				// removed edges leave holes in the adjacency array, these samples are skipped
+				node v = G.getIthNeighbor<true>(u, r);
+				if (v != none) {
+					uf.merge(u, v);
+				}
+			}
+		});
+		uf.compress();
+	}
+
+	// the most frequent representative among evenly spaced nodes is most likely the giant component
+	std::unordered_map<index, count> frequency;
+	index giant = none;
+	for (count i = 0; i < giantSamples; ++i) {
+		node u = (node) ((double) i * z / giantSamples);
+		if (!G.hasNode(u)) {
+			continue;
+		}
+		index c = uf.parentOf(u);
+		count f = ++frequency[c];
+		if (giant == none || f > frequency[giant]) {
+			giant = c;
+		}
+	}
+
+	// every edge with an endpoint outside of the giant component is linked from that endpoint,
+	// as the adjacency of undirected graphs is symmetric; the sampled neighbors are linked again
+	G.balancedParallelForNodes([&](node u) {
+		if (uf.find(u) != giant) {
+			G.forNeighborsOf(u, [&](node v) {
+				uf.merge(u, v);
+			});
+		}
+	});
+	uf.compress();
 
-	// perform breadth-first searches
+	// the representative of a component is its smallest node, so numbering the representatives
+	// in node order yields the ids a sequential sweep over the nodes would assign
+	std::vector<index> componentOfRoot(z, none);
 	G.forNodes([&](node u) {
-		if (component[u] == none) {
-			component.setUpperBound(numComponents+1);
-			index c = numComponents;
-
-			q.push(u);
-			component[u] = c;
-
-			do {
-				node u = q.front();
-				q.pop();
-				// enqueue neighbors, set component
-				G.forNeighborsOf(u, [&](node v) {
-					if (component[v] == none) {
-						q.push(v);
-						component[v] = c;
-					}
-				});
-			} while (!q.empty());
-
-			++numComponents;
+		if (uf.parentOf(u) == u) {
+			componentOfRoot[u] = numComponents++;
 		}
 	});
+	component.setUpperBound(numComponents);
+	G.parallelForNodes([&](node u) {
+		component[u] = componentOfRoot[uf.parentOf(u)];
+	});
 
 	hasRun = true;
 }
@@ -19,6 +19,11 @@ namespace NetworKit {
 /**
  * @ingroup components
  * Determines the connected components of an undirected graph.
+ *
+ * Uses the Afforest algorithm on a lock-free ConcurrentUnionFind: nodes are first linked to
+ * a few sampled neighbors, afterwards only the nodes outside of the largest component link
+ * their remaining neighbors. Component ids are numbered in the order of the smallest node of
+ * every component.
  */
 class ConnectedComponents : public Algorithm {
 public:
@@ -68,6 +73,9 @@ public:
 
 
 private:
+	static const count neighborRounds;
+	static const count giantSamples;
+
 	const Graph& G;
 	Partition component;
 	count numComponents;
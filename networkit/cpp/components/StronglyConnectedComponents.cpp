@@ -13,6 +13,7 @@
 #include <tuple>
 
 #include "StronglyConnectedComponents.h"
+#include "../graph/StaticGraph.h"
 #include "../structures/Partition.h"
 #include "../auxiliary/Log.h"
 
@@ -164,6 +165,255 @@ void StronglyConnectedComponents::runIteratively() {
 	//DEBUG("max_stack_size = ", max_stack_size, ", node count = ", z);
 }
 
+/**
+ * Calls @a expand(u, next) for all nodes u of @a frontier in parallel, where next is a thread-local vector,
+ * and returns the concatenation of these vectors.
+ */
+template<typename F>
+static std::vector<node> expandFrontier(const std::vector<node>& frontier, F expand) {
+	std::vector<node> next;
+	#pragma omp parallel
+	{
+		std::vector<node> local;
+		#pragma omp for schedule(dynamic, 64) nowait
+		for (index i = 0; i < frontier.size(); ++i) {
+			expand(frontier[i], local);
+		}
+		#pragma omp critical (SCCExpandFrontier)
+		next.insert(next.end(), local.begin(), local.end());
+	}
+	return next;
+}
+
+void StronglyConnectedComponents::runParallel() {
+	const count z = G.upperNodeIdBound();
+	const StaticGraph S(G, true);
+
+	// label[u] is the component id of u, i.e. one of its nodes; none while u is unassigned and for deleted nodes
+	std::vector<index> label(z, none);
+	auto assigned = [&](node v) {
+		return __atomic_load_n(&label[v], __ATOMIC_RELAXED) != none;
+	};
+	auto claim = [&](node v, index c) {
+		index expected = none;
+		return __atomic_compare_exchange_n(&label[v], &expected, c, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+	};
+
+	std::vector<node> remaining;
+	G.forNodes([&](node u) {
+		remaining.push_back(u);
+	});
+	auto dropAssigned = [&]() {
+		remaining = expandFrontier(remaining, [&](node u, std::vector<node>& next) {
+			if (!assigned(u)) {
+				next.push_back(u);
+			}
+		});
+	};
+
+	// number of unassigned in- and out-neighbors of the unassigned nodes, self-loops excluded
+	std::vector<count> inDeg(z, 0);
+	std::vector<count> outDeg(z, 0);
+	auto countDegrees = [&]() {
+		#pragma omp parallel for schedule(dynamic, 256)
+		for (index i = 0; i < remaining.size(); ++i) {
+			node u = remaining[i];
+			count in = 0;
+			count out = 0;
+			S.forNeighborsOf(u, [&](node v) {
+				out += (v != u && !assigned(v));
+			});
+			S.forInNeighborsOf(u, [&](node v) {
+				in += (v != u && !assigned(v));
+			});
+			inDeg[u] = in;
+			outDeg[u] = out;
+		}
+	};
+
+	// trim-1: a node without unassigned in- or out-neighbors is a component on its own,
+	// removing it may leave its neighbors without in- or out-neighbors, and so on
+	auto trimSingletons = [&]() {
+		countDegrees();
+		std::vector<node> frontier = expandFrontier(remaining, [&](node u, std::vector<node>& next) {
+			if ((inDeg[u] == 0 || outDeg[u] == 0) && claim(u, u)) {
+				next.push_back(u);
+			}
+		});
+		count trimmed = 0;
+		while (!frontier.empty()) {
+			trimmed += frontier.size();
+			frontier = expandFrontier(frontier, [&](node u, std::vector<node>& next) {
+				S.forNeighborsOf(u, [&](node v) {
+					if (v != u && !assigned(v) && __atomic_sub_fetch(&inDeg[v], 1, __ATOMIC_RELAXED) == 0 && claim(v, v)) {
+						next.push_back(v);
+					}
+				});
+				S.forInNeighborsOf(u, [&](node v) {
+					if (v != u && !assigned(v) && __atomic_sub_fetch(&outDeg[v], 1, __ATOMIC_RELAXED) == 0 && claim(v, v)) {
+						next.push_back(v);
+					}
+				});
+			});
+		}
+		dropAssigned();
+		DEBUG("trimmed ", trimmed, " singleton components, ", remaining.size(), " nodes remain");
+	};
+
+	// forward-backward: the nodes reachable from the pivot that also reach the pivot form its component;
+	// the pivot with the most unassigned in- and out-neighbors most likely lies in the giant component
+	auto forwardBackward = [&]() {
+		if (remaining.empty()) {
+			return;
+		}
+		node pivot = remaining[0];
+		for (node u : remaining) {
+			if ((double) inDeg[u] * outDeg[u] > (double) inDeg[pivot] * outDeg[pivot]) {
+				pivot = u;
+			}
+		}
+
+		std::vector<char> forward(z, 0);
+		forward[pivot] = 1;
+		std::vector<node> frontier(1, pivot);
+		while (!frontier.empty()) {
+			frontier = expandFrontier(frontier, [&](node u, std::vector<node>& next) {
+				S.forNeighborsOf(u, [&](node v) {
+					if (!assigned(v) && !__atomic_load_n(&forward[v], __ATOMIC_RELAXED) && !__atomic_exchange_n(&forward[v], 1, __ATOMIC_RELAXED)) {
+						next.push_back(v);
+					}
+				});
+			});
+		}
+
+		// the backward search only visits forward reachable nodes and assigns them right away
+		claim(pivot, pivot);
+		frontier.assign(1, pivot);
+		count size = 0;
+		while (!frontier.empty()) {
+			size += frontier.size();
+			frontier = expandFrontier(frontier, [&](node u, std::vector<node>& next) {
+				S.forInNeighborsOf(u, [&](node v) {
+					if (forward[v] && claim(v, pivot)) {
+						next.push_back(v);
+					}
+				});
+			});
+		}
+		dropAssigned();
+		DEBUG("component of pivot ", pivot, " has ", size, " nodes, ", remaining.size(), " nodes remain");
+	};
+
+	// trim-2: two nodes that are each other's only unassigned in-neighbor (or out-neighbor) form a component
+	auto trimPairs = [&]() {
+		std::vector<node> partner(z, none);
+		auto onlyNeighbor = [&](node u, bool in) {
+			node only = none;
+			auto check = [&](node v) {
+				if (v != u && !assigned(v)) {
+					only = v;
+				}
+			};
+			if (in) {
+				S.forInNeighborsOf(u, check);
+			} else {
+				S.forNeighborsOf(u, check);
+			}
+			return only;
+		};
+		#pragma omp parallel for schedule(dynamic, 256)
+		for (index i = 0; i < remaining.size(); ++i) {
+			node u = remaining[i];
+			for (bool in : {true, false}) {
+				if ((in ? inDeg[u] : outDeg[u]) != 1) {
+					continue;
+				}
+				node v = onlyNeighbor(u, in);
+				if (v != none && (in ? inDeg[v] : outDeg[v]) == 1 && onlyNeighbor(v, in) == u) {
+					partner[u] = v;
+				}
+			}
+		}
+		count pairs = 0;
+		#pragma omp parallel for reduction(+:pairs)
+		for (index i = 0; i < remaining.size(); ++i) {
+			node u = remaining[i];
+			node v = partner[u];
+			if (v != none && u < v) {
+				label[u] = u;
+				label[v] = u;
+				++pairs;
+			}
+		}
+		dropAssigned();
+		DEBUG("trimmed ", pairs, " components of size two, ", remaining.size(), " nodes remain");
+	};
+
+	trimSingletons();
+	forwardBackward();
+	trimSingletons();
+	trimPairs();
+	trimSingletons();
+
+	// the remaining components are small, they are found by Tarjan's algorithm on the unassigned nodes
+	std::vector<index> nodeIndex(z, none);
+	std::vector<index> lowLink(z, none);
+	std::vector<char> onStack(z, 0);
+	std::vector<node> stx;
+	std::vector<std::pair<node, index>> dfs; // node and position of its next out-edge
+	const StaticArray<node>& targets = S.getOutTargets();
+	index nextIndex = 0;
+	for (node root : remaining) {
+		if (nodeIndex[root] != none) {
+			continue;
+		}
+		auto visit = [&](node u) {
+			nodeIndex[u] = lowLink[u] = nextIndex++;
+			stx.push_back(u);
+			onStack[u] = 1;
+			dfs.emplace_back(u, S.getOutOffset(u));
+		};
+		visit(root);
+		while (!dfs.empty()) {
+			node u = dfs.back().first;
+			index next = dfs.back().second;
+			if (next < S.getOutOffset(u) + S.degreeOut(u)) {
+				++dfs.back().second;
+				node v = targets[next];
+				if (assigned(v)) {
+					continue;
+				}
+				if (nodeIndex[v] == none) {
+					visit(v);
+				} else if (onStack[v]) {
+					lowLink[u] = std::min(lowLink[u], nodeIndex[v]);
+				}
+			} else {
+				dfs.pop_back();
+				if (lowLink[u] == nodeIndex[u]) {
+					node w;
+					do {
+						w = stx.back();
+						stx.pop_back();
+						onStack[w] = 0;
+						label[w] = u;
+					} while (w != u);
+				}
+				if (!dfs.empty()) {
+					node parent = dfs.back().first;
+					lowLink[parent] = std::min(lowLink[parent], lowLink[u]);
+				}
+			}
+		}
+	}
+
+	component = Partition(z);
+	component.setUpperBound(z);
+	G.parallelForNodes([&](node u) {
+		component[u] = label[u];
+	});
+}
+
 Partition StronglyConnectedComponents::getPartition() {
 	return this->component;
 }
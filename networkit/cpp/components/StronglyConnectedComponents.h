@@ -39,6 +39,16 @@ public:
 	 */
 	void runRecursively();
 
+	/**
+	 * This method determines the connected components for the graph g
+	 * (parallel implementation). Nodes without in- or out-neighbors and pairs of nodes that
+	 * are each other's only neighbor are trimmed off repeatedly, and the component of a pivot
+	 * is found by a forward and a backward search from it. The few nodes left after that are
+	 * handled by Tarjan's algorithm. The subsets are the same as for the other implementations,
+	 * the id of every component is one of its nodes.
+	 */
+	void runParallel();
+
 	/**
 	 * This method returns the number of connected components.
 	 */
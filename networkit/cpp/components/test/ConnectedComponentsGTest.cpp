@@ -19,6 +19,8 @@
 #include "../../generators/HavelHakimiGenerator.h"
 #include "../../auxiliary/Log.h"
 #include "../../generators/DorogovtsevMendesGenerator.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+#include "../../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -69,6 +71,42 @@ namespace NetworKit {
         EXPECT_EQ(1029u, cc.numberOfComponents());
     }
 
+    TEST_F(ConnectedComponentsGTest, testConnectedComponentsAgainstLabelPropagation) {
+        Aux::Random::setSeed(42, false);
+        // below and above the threshold of a giant component
+        for (double p : {0.5 / 20000, 2.0 / 20000}) {
+            Graph G = ErdosRenyiGenerator(20000, p).generate();
+            for (node u = 0; u < 20000; u += 97) {
+                std::vector<node> neighbors = G.neighbors(u);
+                for (node v : neighbors) {
+                    G.removeEdge(u, v);
+                }
+                G.removeNode(u);
+            }
+
+            ConnectedComponents cc(G);
+            cc.run();
+            ParallelConnectedComponents pcc(G);
+            pcc.runSequential();
+            EXPECT_EQ(pcc.numberOfComponents(), cc.numberOfComponents());
+
+            // same components, numbered in the order of their first node
+            std::vector<index> otherId(cc.numberOfComponents(), none);
+            index next = 0;
+            G.forNodes([&](node u) {
+                index c = cc.componentOfNode(u);
+                if (otherId[c] == none) {
+                    EXPECT_EQ(next++, c);
+                    otherId[c] = pcc.componentOfNode(u);
+                }
+                EXPECT_EQ(otherId[c], pcc.componentOfNode(u));
+            });
+            G.forEdges([&](node u, node v) {
+                EXPECT_EQ(cc.componentOfNode(u), cc.componentOfNode(v));
+            });
+        }
+    }
+
     TEST_F(ConnectedComponentsGTest, testParallelConnectedComponents) {
         METISGraphReader reader;
         std::vector<std::string> graphs = {"astro-ph", "PGPgiantcompo",
@@ -185,6 +223,57 @@ namespace NetworKit {
         p_actual.compact();
 
         comparePartitions(p_expected, p_actual);
+
+        scc.runParallel();
+        p_actual = scc.getPartition();
+        p_actual.compact();
+        comparePartitions(p_expected, p_actual);
+    }
+
+    TEST_F(ConnectedComponentsGTest, testParallelStronglyConnectedComponents) {
+        Aux::Random::setSeed(42, false);
+        // a giant component, many trivial and some small ones
+        for (double p : {1.5 / 5000, 4.0 / 5000}) {
+            Graph G = ErdosRenyiGenerator(5000, p, true).generate();
+            for (node u = 0; u < 5000; u += 101) {
+                std::vector<node> neighbors = G.neighbors(u);
+                for (node v : neighbors) {
+                    G.removeEdge(u, v);
+                }
+                std::vector<node> inNeighbors;
+                G.forInNeighborsOf(u, [&](node v) {
+                    inNeighbors.push_back(v);
+                });
+                for (node v : inNeighbors) {
+                    G.removeEdge(v, u);
+                }
+                G.removeNode(u);
+            }
+            for (node u = 1; u < 5000; u += 53) {
+                if (G.hasNode(u) && G.hasNode(u - 1) && !G.hasEdge(u, u - 1)) {
+                    G.addEdge(u, u - 1);
+                }
+                if (G.hasNode(u - 1) && G.hasNode(u) && !G.hasEdge(u - 1, u)) {
+                    G.addEdge(u - 1, u);
+                }
+            }
+
+            StronglyConnectedComponents scc(G);
+            scc.runRecursively();
+            Partition expected = scc.getPartition();
+            scc.runParallel();
+            Partition actual = scc.getPartition();
+            EXPECT_EQ(expected.numberOfSubsets(), actual.numberOfSubsets());
+
+            std::vector<index> mapped(expected.upperBound(), none);
+            G.forNodes([&](node u) {
+                ASSERT_NE(none, actual[u]);
+                if (mapped[expected[u]] == none) {
+                    mapped[expected[u]] = actual[u];
+                }
+                EXPECT_EQ(mapped[expected[u]], actual[u]);
+            });
+        }
     }
 
     TEST_F(ConnectedComponentsGTest, testDynConnectedComponentsTiny) {
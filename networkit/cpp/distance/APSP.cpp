@@ -8,27 +8,56 @@
 #include "APSP.h"
 #include "../auxiliary/Log.h"
 #include "Dijkstra.h"
-#include "BFS.h"
+#include "DeltaSteppingSSSP.h"
+#include "MultiSourceBFS.h"
 
 namespace NetworKit {
 
-APSP::APSP(const Graph& G) : Algorithm(), G(G) {}
+APSP::APSP(const Graph& G, SSSP::WeightedAlgorithm weightedAlgorithm) : Algorithm(), G(G), weightedAlgorithm(weightedAlgorithm) {}
 
 void APSP::run() {
 	std::vector<edgeweight> distanceVector(G.upperNodeIdBound(), 0.0);
 	distances.resize(G.upperNodeIdBound(), distanceVector);
-	if (G.isWeighted()) {
+	if (G.isWeighted() && weightedAlgorithm == SSSP::DELTA_STEPPING) {
+		StaticGraph S(G, false);
+		G.forNodes([&](node u) {
+			DeltaSteppingSSSP sssp(G, S, u, false);
+			sssp.run();
+			distances[u] = sssp.getDistances();
+		});
+	} else if (G.isWeighted()) {
 		G.parallelForNodes([&](node u){
 			Dijkstra dijk(G, u);
 			dijk.run();
 			distances[u] = dijk.getDistances();
 		});
 	} else {
-		G.parallelForNodes([&](node u){
-			BFS bfs(G, u);
-			bfs.run();
-			distances[u] = bfs.getDistances();
+		// bit-parallel BFS from batches of sources on a shared snapshot
+		StaticGraph S(G, false);
+		edgeweight infDist = std::numeric_limits<edgeweight>::max();
+		std::vector<node> nodes;
+		G.forNodes([&](node u) {
+			nodes.push_back(u);
+			distances[u].assign(G.upperNodeIdBound(), infDist);
 		});
+		const count batches = (nodes.size() + MultiSourceBFS::batchSize - 1) / MultiSourceBFS::batchSize;
+
+		#pragma omp parallel
+		{
+			MultiSourceBFS msbfs(S);
+			std::vector<node> sources;
+
+			#pragma omp for schedule(dynamic, 1)
+			for (index b = 0; b < batches; ++b) {
+				auto first = nodes.begin() + b * MultiSourceBFS::batchSize;
+				sources.assign(first, first + std::min<count>(MultiSourceBFS::batchSize, nodes.end() - first));
+				msbfs.run(sources, [&](node v, uint64_t mask, count dist) {
+					MultiSourceBFS::forBits(mask, [&](index i) {
+						distances[sources[i]][v] = dist;
+					});
+				});
+			}
+		}
 	}
 	hasRun = true;
 }
@@ -10,6 +10,7 @@
 
 #include "../graph/Graph.h"
 #include "../base/Algorithm.h"
+#include "SSSP.h"
 
 namespace NetworKit {
 
@@ -25,8 +26,9 @@ public:
 	 * Creates the APSP class for @a G.
 	 *
 	 * @param G The graph.
+	 * @param weightedAlgorithm The shortest path algorithm used if @a G is weighted.
 	 */
-	APSP(const Graph& G);
+	APSP(const Graph& G, SSSP::WeightedAlgorithm weightedAlgorithm = SSSP::DIJKSTRA);
 
 	virtual ~APSP() = default;
 
@@ -61,6 +63,7 @@ public:
 protected:
 
 	const Graph& G;
+	SSSP::WeightedAlgorithm weightedAlgorithm;
 	std::vector<std::vector<edgeweight> > distances;
 };
 
@@ -0,0 +1,297 @@
+/*
+ * DeltaSteppingSSSP.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <algorithm>
+#include <functional>
+#include <omp.h>
+
+#include "DeltaSteppingSSSP.h"
+#include "../auxiliary/Log.h"
+
+namespace NetworKit {
+
+DeltaSteppingSSSP::DeltaSteppingSSSP(const Graph& G, node source, bool storePaths, bool storeNodesSortedByDistance, node target, edgeweight delta) :
+	SSSP(G, source, storePaths, storeNodesSortedByDistance, target), S(nullptr), delta(delta), usedDelta(0), buckets(0) {
+}
+
+DeltaSteppingSSSP::DeltaSteppingSSSP(const Graph& G, const StaticGraph& S, node source, bool storePaths, bool storeNodesSortedByDistance, node target, edgeweight delta) :
+	SSSP(G, source, storePaths, storeNodesSortedByDistance, target), S(&S), delta(delta), usedDelta(0), buckets(0) {
+	if (storePaths && !S.hasInEdges()) {
+		throw std::runtime_error("DeltaSteppingSSSP needs a snapshot with incoming edges to store paths");
+	}
+}
+
+void DeltaSteppingSSSP::run() {
+	// a snapshot passed in is reused, an own one is rebuilt since G may have changed since the last run
+	if (S == nullptr || ownSnapshot) {
+		ownSnapshot.reset(new StaticGraph(G, storePaths));
+		S = ownSnapshot.get();
+	}
+	const StaticGraph& H = *S;
+	const count z = H.upperNodeIdBound();
+	const count maxThreads = omp_get_max_threads();
+	const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+
+	edgeweight minWeight = infDist;
+	edgeweight maxWeight = 0;
+	#pragma omp parallel for reduction(min:minWeight) reduction(max:maxWeight) schedule(guided)
+	for (node u = 0; u < z; ++u) {
+		H.forEdgesOf(u, [&](node, node, edgeweight w) {
+			minWeight = std::min(minWeight, w);
+			maxWeight = std::max(maxWeight, w);
+		});
+	}
+	if (minWeight < 0) {
+		throw std::runtime_error("DeltaSteppingSSSP: negative edge weights are not supported");
+	}
+	usedDelta = delta;
+	if (usedDelta <= 0) {
+		const double averageDegree = H.numberOfNodes() == 0 ? 0.0 : (double) H.getOutTargets().size() / H.numberOfNodes();
+		usedDelta = maxWeight > 0 ? maxWeight / std::max(1.0, averageDegree) : 1.0;
+	}
+	auto bucketOf = [&](edgeweight d) {
+		return static_cast<index>(d / usedDelta);
+	};
+
+	distances.clear();
+	distances.resize(z, infDist);
+	distances[source] = 0;
+
+	// bins[t][b] holds the nodes thread t has moved to bucket b, all bins of t below lowest[t] are empty
+	std::vector<std::vector<std::vector<node>>> bins(maxThreads);
+	std::vector<index> lowest(maxThreads, 0);
+	std::vector<std::vector<node>> localSettled(maxThreads);
+	// the bucket in which a node has been settled, none if it has not been settled
+	std::vector<index> settledIn(z, none);
+	std::vector<node> frontier(1, source);
+	std::vector<node> settled;
+	std::vector<node> order;
+
+	// lowers the distance of v to d if this is an improvement, and files v in the bucket of d
+	auto relax = [&](node v, edgeweight d, index t) {
+		edgeweight old;
+		__atomic_load(&distances[v], &old, __ATOMIC_RELAXED);
+		while (d < old) {
+			if (__atomic_compare_exchange(&distances[v], &old, &d, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+				const index b = bucketOf(d);
+				if (b >= bins[t].size()) {
+					bins[t].resize(b + 1);
+				}
+				bins[t][b].push_back(v);
+				lowest[t] = std::min(lowest[t], b);
+				return;
+			}
+		}
+	};
+
+	// concatenates the vectors partOf(t) of all threads into result and clears them
+	auto gather = [&](std::vector<node>& result, std::function<std::vector<node>*(index)> partOf) {
+		std::vector<index> offset(maxThreads + 1, 0);
+		for (index t = 0; t < maxThreads; ++t) {
+			std::vector<node>* part = partOf(t);
+			offset[t + 1] = offset[t] + (part == nullptr ? 0 : part->size());
+		}
+		result.resize(offset[maxThreads]);
+		#pragma omp parallel for schedule(static, 1)
+		for (index t = 0; t < maxThreads; ++t) {
+			std::vector<node>* part = partOf(t);
+			if (part != nullptr) {
+				std::copy(part->begin(), part->end(), result.begin() + offset[t]);
+				part->clear();
+			}
+		}
+	};
+
+	index bucket = 0;
+	auto currentBins = [&](index t) {
+		return bucket < bins[t].size() ? &bins[t][bucket] : nullptr;
+	};
+	buckets = 0;
+	while (true) {
+		++buckets;
+		const index firstOfBucket = order.size();
+		do {
+			// light edges, repeated until no node is moved into the current bucket any more
+			while (!frontier.empty()) {
+				#pragma omp parallel for schedule(dynamic, 64)
+				for (index i = 0; i < frontier.size(); ++i) {
+					const index t = omp_get_thread_num();
+					const node u = frontier[i];
+					edgeweight du;
+					__atomic_load(&distances[u], &du, __ATOMIC_RELAXED);
+					if (bucketOf(du) != bucket) {
+						continue; // moved to a lower bucket after it was filed here
+					}
+					if (__atomic_load_n(&settledIn[u], __ATOMIC_RELAXED) != bucket
+							&& __atomic_exchange_n(&settledIn[u], bucket, __ATOMIC_RELAXED) != bucket) {
+						localSettled[t].push_back(u);
+					}
+					H.forEdgesOf(u, [&](node, node v, edgeweight w) {
+						if (w <= usedDelta) {
+							relax(v, du + w, t);
+						}
+					});
+				}
+				gather(frontier, currentBins);
+			}
+
+			// the distances of the settled nodes are final, relax their heavy edges once
+			gather(settled, [&](index t) {
+				return &localSettled[t];
+			});
+			#pragma omp parallel for schedule(dynamic, 64)
+			for (index i = 0; i < settled.size(); ++i) {
+				const index t = omp_get_thread_num();
+				const node u = settled[i];
+				const edgeweight du = distances[u];
+				H.forEdgesOf(u, [&](node, node v, edgeweight w) {
+					if (w > usedDelta) {
+						relax(v, du + w, t);
+					}
+				});
+			}
+			if (storePaths || storeNodesSortedByDistance) {
+				order.insert(order.end(), settled.begin(), settled.end());
+			}
+			// a heavy edge only lands in the current bucket if du + w is rounded down
+			gather(frontier, currentBins);
+		} while (!frontier.empty());
+		for (index t = 0; t < maxThreads; ++t) {
+			if (bucket < bins[t].size()) {
+				std::vector<node>().swap(bins[t][bucket]);
+			}
+		}
+		std::sort(order.begin() + firstOfBucket, order.end(), [&](node u, node v) {
+			return distances[u] < distances[v];
+		});
+
+		if (target != none && settledIn[target] != none) {
+			break;
+		}
+
+		// the next bucket is the lowest nonempty bin of any thread
+		index next = none;
+		for (index t = 0; t < maxThreads; ++t) {
+			index b = std::max(lowest[t], bucket + 1);
+			while (b < bins[t].size() && bins[t][b].empty()) {
+				++b;
+			}
+			lowest[t] = b;
+			if (b < bins[t].size()) {
+				next = std::min(next, b);
+			}
+		}
+		if (next == none) {
+			break;
+		}
+		bucket = next;
+		gather(frontier, currentBins);
+	}
+	DEBUG("delta-stepping with delta ", usedDelta, " processed ", buckets, " buckets");
+
+	if (storePaths) {
+		storeShortestPathDag(order);
+	}
+	if (storeNodesSortedByDistance) {
+		nodesSortedByDistance = std::move(order);
+	}
+	hasRun = true;
+}
+
+void DeltaSteppingSSSP::storeShortestPathDag(const std::vector<node>& order) {
+	const StaticGraph& H = *S;
+	previous.clear();
+	previous.resize(H.upperNodeIdBound());
+	npaths.clear();
+	npaths.resize(H.upperNodeIdBound(), 0);
+
+	#pragma omp parallel for schedule(guided)
+	for (index i = 0; i < order.size(); ++i) {
+		const node v = order[i];
+		if (v == source) continue;
+		H.forInEdgesOf(v, [&](node, node u, edgeweight w) {
+			if (u != v && distances[u] + w == distances[v]) {
+				previous[v].push_back(u);
+			}
+		});
+	}
+
+	auto countPaths = [&](node v) {
+		for (node u : previous[v]) {
+			npaths[v] += npaths[u];
+		}
+	};
+
+	// order is sorted by distance, so only predecessors joined by a zero-weight edge may come after a node. Within
+	// each run of equal distances, nodes are counted in topological order of these edges (Kahn's algorithm).
+	npaths[source] = 1;
+	std::vector<count> pending;
+	std::vector<std::vector<node>> zeroSuccessors;
+	std::vector<node> ready;
+	for (index begin = 0; begin < order.size();) {
+		index end = begin + 1;
+		while (end < order.size() && distances[order[end]] == distances[order[begin]]) {
+			++end;
+		}
+		if (end == begin + 1) {
+			countPaths(order[begin]);
+			begin = end;
+			continue;
+		}
+
+		if (pending.empty()) {
+			pending.resize(H.upperNodeIdBound(), 0);
+			zeroSuccessors.resize(H.upperNodeIdBound());
+		}
+		for (index i = begin; i < end; ++i) {
+			const node v = order[i];
+			for (node u : previous[v]) {
+				if (distances[u] == distances[v]) {
+					++pending[v];
+					zeroSuccessors[u].push_back(v);
+				}
+			}
+		}
+		for (index i = begin; i < end; ++i) {
+			if (pending[order[i]] == 0) {
+				ready.push_back(order[i]);
+			}
+		}
+		while (!ready.empty()) {
+			const node u = ready.back();
+			ready.pop_back();
+			countPaths(u);
+			for (node v : zeroSuccessors[u]) {
+				if (--pending[v] == 0) {
+					ready.push_back(v);
+				}
+			}
+		}
+		// nodes on a zero-weight cycle are left over, count them in any order
+		for (index i = begin; i < end; ++i) {
+			const node v = order[i];
+			if (pending[v] > 0) {
+				countPaths(v);
+				pending[v] = 0;
+			}
+			zeroSuccessors[v].clear();
+		}
+		begin = end;
+	}
+}
+
+edgeweight DeltaSteppingSSSP::getDelta() const {
+	assureFinished();
+	return usedDelta;
+}
+
+count DeltaSteppingSSSP::numberOfBuckets() const {
+	assureFinished();
+	return buckets;
+}
+
+} /* namespace NetworKit */
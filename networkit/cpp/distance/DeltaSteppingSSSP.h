@@ -0,0 +1,103 @@
+/*
+ * DeltaSteppingSSSP.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef DELTASTEPPINGSSSP_H_
+#define DELTASTEPPINGSSSP_H_
+
+#include <memory>
+
+#include "SSSP.h"
+#include "../graph/StaticGraph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Parallel single-source shortest paths for graphs with nonnegative edge weights, using the
+ * Delta-stepping algorithm of Meyer and Sanders, "Delta-stepping: a parallelizable shortest path
+ * algorithm", J. Algorithms 49(1), 2003.
+ *
+ * Tentative distances are kept in buckets of width delta. Edges of weight at most delta are light,
+ * all others are heavy. The lowest nonempty bucket is emptied by relaxing the light edges of all its
+ * nodes in parallel, repeatedly, since light edges can insert nodes into the same bucket again. Once
+ * the bucket stays empty, the distances of its nodes are final and their heavy edges are relaxed once.
+ * Distances are lowered by compare-and-swap, every thread files the nodes it improved in its own
+ * buckets. The search runs on a StaticGraph snapshot, which can be passed in to amortize its
+ * construction over several searches.
+ *
+ * A small delta does little redundant work but needs many synchronized phases, a large delta the
+ * opposite. By default delta is the maximum edge weight divided by the average degree, the choice
+ * Meyer and Sanders analyze for random edge weights.
+ *
+ * Predecessors and numbers of shortest paths are computed after the search from the final distances.
+ * Nodes at the same distance are counted in topological order of the zero-weight edges between them,
+ * hence the numbers of paths are exact as long as the zero-weight edges form no cycle.
+ */
+class DeltaSteppingSSSP : public SSSP {
+
+public:
+	/**
+	 * Creates a Delta-stepping search from @a source. A StaticGraph snapshot of @a G is created on every
+	 * run(), so later runs see the changes made to @a G in between.
+	 *
+	 * @param G The graph.
+	 * @param source The source node.
+	 * @param storePaths Paths are reconstructable and the number of paths is stored.
+	 * @param storeNodesSortedByDistance Store a vector of nodes ordered in increasing distance from the source.
+	 * @param target The target node, the search stops after the bucket that contains it.
+	 * @param delta The bucket width, a value <= 0 selects it automatically.
+	 */
+	DeltaSteppingSSSP(const Graph& G, node source, bool storePaths=true, bool storeNodesSortedByDistance=false, node target = none, edgeweight delta = 0);
+
+	/**
+	 * Creates a Delta-stepping search from @a source on the snapshot @a S of @a G. If @a storePaths is
+	 * set and @a G is directed, @a S has to store the incoming edges. Every run() searches @a S, which
+	 * is not updated when @a G changes.
+	 *
+	 * @param G The graph.
+	 * @param S A snapshot of @a G, it must outlive this object.
+	 * @param source The source node.
+	 * @param storePaths Paths are reconstructable and the number of paths is stored.
+	 * @param storeNodesSortedByDistance Store a vector of nodes ordered in increasing distance from the source.
+	 * @param target The target node, the search stops after the bucket that contains it.
+	 * @param delta The bucket width, a value <= 0 selects it automatically.
+	 */
+	DeltaSteppingSSSP(const Graph& G, const StaticGraph& S, node source, bool storePaths=true, bool storeNodesSortedByDistance=false, node target = none, edgeweight delta = 0);
+
+	/**
+	 * Computes the shortest paths from the source. Throws if the graph has negative edge weights.
+	 */
+	void run() override;
+
+	/**
+	 * @return The bucket width used by the last run.
+	 */
+	edgeweight getDelta() const;
+
+	/**
+	 * @return The number of nonempty buckets processed by the last run.
+	 */
+	count numberOfBuckets() const;
+
+	/**
+	 * @return True if algorithm can run multi-threaded.
+	 */
+	bool isParallel() const override { return true; }
+
+private:
+	std::unique_ptr<StaticGraph> ownSnapshot;
+	const StaticGraph* S;
+	edgeweight delta;
+
+	edgeweight usedDelta;
+	count buckets;
+
+	void storeShortestPathDag(const std::vector<node>& order);
+};
+
+} /* namespace NetworKit */
+#endif /* DELTASTEPPINGSSSP_H_ */
@@ -5,18 +5,21 @@
  *      Author: Daniel Hoske, Christian Staudt
  */
 
+#include <memory>
 #include <numeric>
 
 #include "Diameter.h"
 #include "Eccentricity.h"
 #include "../distance/BFS.h"
+#include "../distance/ParallelBFS.h"
 #include "../distance/Dijkstra.h"
+#include "../distance/DeltaSteppingSSSP.h"
 #include "../components/ConnectedComponents.h"
 #include "../structures/Partition.h"
 
 namespace NetworKit {
 
-Diameter::Diameter(const Graph& G, DiameterAlgo algo, double error, count nSamples) : Algorithm(), G(G), error(error), nSamples(nSamples) {
+Diameter::Diameter(const Graph& G, DiameterAlgo algo, double error, count nSamples, SSSP::WeightedAlgorithm weightedAlgorithm) : Algorithm(), G(G), error(error), nSamples(nSamples), weightedAlgorithm(weightedAlgorithm) {
 	if (algo == DiameterAlgo::automatic) {
 		this->algo = DiameterAlgo::exact;
 	} else {
@@ -59,11 +62,20 @@ edgeweight Diameter::exactDiameter(const Graph& G) {
 	if (! G.isWeighted()) {
 		std::tie(diameter, std::ignore) = estimatedDiameterRange(G, 0);
 	} else {
+		std::unique_ptr<StaticGraph> S;
+		if (weightedAlgorithm == SSSP::DELTA_STEPPING) {
+			S.reset(new StaticGraph(G, false));
+		}
 		G.forNodes([&](node v) {
 			handler.assureRunning();
-			Dijkstra dijkstra(G, v);
-			dijkstra.run();
-			auto distances = dijkstra.getDistances();
+			std::unique_ptr<SSSP> sssp;
+			if (weightedAlgorithm == SSSP::DELTA_STEPPING) {
+				sssp.reset(new DeltaSteppingSSSP(G, *S, v, false));
+			} else {
+				sssp.reset(new Dijkstra(G, v, false));
+			}
+			sssp->run();
+			auto distances = sssp->getDistances();
 			G.forNodes([&](node u) {
 				if (diameter < distances[u]) {
 					diameter = distances[u];
@@ -110,6 +122,7 @@ std::pair<edgeweight, edgeweight> Diameter::estimatedDiameterRange(const NetworK
 	std::vector<count> distances(G.upperNodeIdBound(), 0);
 
 	count numBFS = 0;
+	StaticGraph S(G);
 
 	auto runBFS = [&](const std::vector<node> &startNodes) {
 		++numBFS;
@@ -117,13 +130,19 @@ std::pair<edgeweight, edgeweight> Diameter::estimatedDiameterRange(const NetworK
 		distFirst.resize(numberOfComponents, 0);
 		std::vector<bool> foundFirstDeg2Node(numberOfComponents, false);
 
-		G.BFSfrom(startNodes, [&](node v, count dist) {
+		ParallelBFS bfs(G, S, startNodes);
+		bfs.run();
+		std::vector<edgeweight> bfsDist = bfs.getDistances();
+
+		G.forNodes([&](node v) {
+			count dist = bfsDist[v];
 			distances[v] = dist;
 
 			index c = comp.componentOfNode(v);
 			ecc[c] = std::max(dist, ecc[c]);
 
-			if (!foundFirstDeg2Node[c] && G.degree(v) > 1) {
+			// distance of the closest node of degree > 1
+			if (G.degree(v) > 1 && (!foundFirstDeg2Node[c] || dist < distFirst[c])) {
 				foundFirstDeg2Node[c] = true;
 				distFirst[c] = dist;
 			}
@@ -234,8 +253,10 @@ edgeweight Diameter::estimatedVertexDiameter(const Graph& G, count samples) {
 
 	// TODO: consider weights
 
+	StaticGraph S(G);
+
 	auto estimateFrom = [&](node v) -> count {
-		BFS bfs(G, v);
+		ParallelBFS bfs(G, S, {v});
 		bfs.run();
 		auto distances = bfs.getDistances();
 
@@ -11,6 +11,7 @@
 #include "../base/Algorithm.h"
 #include "../graph/Graph.h"
 #include "../auxiliary/SignalHandling.h"
+#include "SSSP.h"
 
 
 namespace NetworKit {
@@ -23,7 +24,14 @@ class Diameter : public Algorithm {
 
 public:
 	
-	Diameter(const Graph& G, DiameterAlgo algo = DiameterAlgo::automatic, double error = -1.f, count nSamples = 0);
+	/**
+	 * @param G The graph.
+	 * @param algo The algorithm, exact or one of the estimations.
+	 * @param error The maximum relative error of estimatedRange.
+	 * @param nSamples The number of samples of estimatedSamples.
+	 * @param weightedAlgorithm The shortest path algorithm used by exact on weighted graphs.
+	 */
+	Diameter(const Graph& G, DiameterAlgo algo = DiameterAlgo::automatic, double error = -1.f, count nSamples = 0, SSSP::WeightedAlgorithm weightedAlgorithm = SSSP::DIJKSTRA);
 
 	void run() override;
 
@@ -37,6 +45,7 @@ private:
 	DiameterAlgo algo;
 	double error;
 	count nSamples;
+	SSSP::WeightedAlgorithm weightedAlgorithm;
 	std::pair<count, count> diameterBounds;
 
 	/**
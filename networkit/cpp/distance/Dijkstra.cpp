@@ -11,11 +11,32 @@
 
 namespace NetworKit {
 
-Dijkstra::Dijkstra(const Graph& G, node source, bool storePaths, bool storeNodesSortedByDistance, node target) : SSSP(G, source, storePaths, storeNodesSortedByDistance, target) {
+Dijkstra::Dijkstra(const Graph& G, node source, bool storePaths, bool storeNodesSortedByDistance, node target, QueueType queueType) : SSSP(G, source, storePaths, storeNodesSortedByDistance, target), queueType(queueType) {
 
 }
 
 void Dijkstra::run() {
+	switch (queueType) {
+	case DARY_HEAP: {
+		Aux::DAryHeap<edgeweight, node> pq(G.upperNodeIdBound());
+		runWithQueue(pq);
+		break;
+	}
+	case RADIX_HEAP: {
+		Aux::RadixHeap<edgeweight, node> pq(G.upperNodeIdBound());
+		runWithQueue(pq);
+		break;
+	}
+	case TREE: {
+		Aux::PrioQueue<edgeweight, node> pq(G.upperNodeIdBound());
+		runWithQueue(pq);
+		break;
+	}
+	}
+}
+
+template<class PQ>
+void Dijkstra::runWithQueue(PQ& pq) {
 
 	TRACE("initializing Dijkstra data structures");
 	// init distances
@@ -34,11 +55,9 @@ void Dijkstra::run() {
 		std::vector<node> empty;
 		std::swap(nodesSortedByDistance, empty);
 	}
+	// priority queue with distance-node pairs, only reached nodes are inserted
 	distances[source] = 0;
-	// priority queue with distance-node pairs
-	distances[source] = 0;
-	Aux::PrioQueue<edgeweight, node> pq(distances);
-
+	pq.insert(0, source);
 
 	auto relax([&](node u, node v, edgeweight w) {
 		if (distances[v] > distances[u] + w) {
@@ -11,6 +11,8 @@
 #include "../graph/Graph.h"
 #include "SSSP.h"
 #include "../auxiliary/PrioQueue.h"
+#include "../auxiliary/DAryHeap.h"
+#include "../auxiliary/RadixHeap.h"
 
 namespace NetworKit {
 
@@ -25,6 +27,18 @@ friend class DynDijkstra2;
 
 public:
 
+	/**
+	 * Priority queues that can be used by the search.
+	 * DARY_HEAP: addressable 4-ary heap (default).
+	 * RADIX_HEAP: monotone radix heap, fastest for integer-like weights; nodes with equal distance are settled in arbitrary order.
+	 * TREE: the std::set based Aux::PrioQueue.
+	 */
+	enum QueueType {
+		DARY_HEAP,
+		RADIX_HEAP,
+		TREE
+	};
+
 	/**
 	 * Creates the Dijkstra class for @a G and the source node @a source.
 	 *
@@ -33,13 +47,21 @@ public:
 	 * @param storePaths Paths are reconstructable and the number of paths is stored.
 	 * @param storeNodesSortedByDistance Store a vector of nodes ordered in increasing distance from the source.
 	 * @param target The target node.
+	 * @param queueType The priority queue used to select the next node.
 	 */
-	Dijkstra(const Graph& G, node source, bool storePaths=true, bool storeNodesSortedByDistance=false, node target = none);
+	Dijkstra(const Graph& G, node source, bool storePaths=true, bool storeNodesSortedByDistance=false, node target = none, QueueType queueType = DARY_HEAP);
 
 	/**
 	 * Performs the Dijkstra SSSP algorithm on the graph given in the constructor.
 	 */
 	virtual void run();
+
+private:
+
+	QueueType queueType;
+
+	template<class PQ>
+	void runWithQueue(PQ& pq);
 };
 
 } /* namespace NetworKit */
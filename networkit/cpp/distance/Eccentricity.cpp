@@ -6,7 +6,7 @@
  */
 
 #include "Eccentricity.h"
-#include "BFS.h"
+#include "ParallelBFS.h"
 
 namespace NetworKit {
 
@@ -20,5 +20,12 @@ std::pair<node, count> Eccentricity::getValue(const Graph& G, node u) {
 	return {res, ecc}; // pair.first is argmax node
 }
 
+std::pair<node, count> Eccentricity::getValue(const Graph& G, const StaticGraph& S, node u) {
+	ParallelBFS bfs(G, S, {u}, true);
+	bfs.run();
+	// the last node in BFS order is at maximum distance
+	return {bfs.getNodesSortedByDistance().back(), bfs.getMaxDistance()}; // pair.first is argmax node
+}
+
 
 } /* namespace NetworKit */
@@ -9,6 +9,7 @@
 #define ECCENTRICITY_H_
 
 #include "../graph/Graph.h"
+#include "../graph/StaticGraph.h"
 
 namespace NetworKit {
 
@@ -20,9 +21,19 @@ class Eccentricity {
 public:
 
 	/**
-	 * TODO: documentation
+	 * Computes the eccentricity of @a u with a sequential BFS on @a G, which needs no snapshot.
+	 *
+	 * @return A node at maximum distance from @a u and the eccentricity of @a u.
 	 */
 	static std::pair<node, count> getValue(const Graph& G, node u);
+
+	/**
+	 * Computes the eccentricity of @a u with a parallel BFS on the snapshot @a S of @a G. Use this
+	 * for many queries on the same graph, so the snapshot is only built once.
+	 *
+	 * @return A node at maximum distance from @a u and the eccentricity of @a u.
+	 */
+	static std::pair<node, count> getValue(const Graph& G, const StaticGraph& S, node u);
 };
 
 } /* namespace NetworKit */
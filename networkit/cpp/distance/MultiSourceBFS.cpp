@@ -0,0 +1,17 @@
+/*
+ * MultiSourceBFS.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include "MultiSourceBFS.h"
+
+namespace NetworKit {
+
+const count MultiSourceBFS::batchSize;
+
+MultiSourceBFS::MultiSourceBFS(const StaticGraph& S) : S(S), seen(S.upperNodeIdBound(), 0), visit(S.upperNodeIdBound(), 0), visitNext(S.upperNodeIdBound(), 0) {
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,129 @@
+/*
+ * MultiSourceBFS.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef MULTISOURCEBFS_H_
+#define MULTISOURCEBFS_H_
+
+#include <vector>
+#include <cstdint>
+
+#include "../graph/StaticGraph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Bit-parallel breadth-first search from up to 64 sources at once, as described in
+ * Then et al., "The More the Merrier: Efficient Multi-Source Graph Traversal", VLDB 2014.
+ *
+ * Every node holds one bit per source in a machine word for the sets seen, visit and
+ * visitNext, so a single scan of the adjacency of a node advances all searches that reach
+ * it in the same level. The object owns O(n) words of workspace which are reused by every
+ * call of run(), i.e. no memory is allocated per source. Since the workspace is modified,
+ * every thread needs its own object; the snapshot can be shared.
+ * Only distances are computed, the number of shortest paths is not tracked.
+ */
+class MultiSourceBFS final {
+
+public:
+	/** Maximum number of sources per call of run(). */
+	static const count batchSize = 64;
+
+	/**
+	 * Creates the workspace for searches on the snapshot @a S, which must outlive this object.
+	 */
+	MultiSourceBFS(const StaticGraph& S);
+
+	/**
+	 * Runs a breadth-first search from each of the (at most batchSize) nodes in @a sources.
+	 * For every node v and level d, @a handle(v, mask, d) is called once with the bit mask of
+	 * the sources (bit i stands for sources[i]) that reach v at distance d, starting with the
+	 * sources themselves at distance 0. Within a level, nodes are reported in no particular order.
+	 */
+	template<typename L> void run(const std::vector<node>& sources, L handle);
+
+	/**
+	 * Calls @a handle(i) for every set bit i of @a mask.
+	 */
+	template<typename L> static void forBits(uint64_t mask, L handle);
+
+private:
+	const StaticGraph& S;
+	std::vector<uint64_t> seen;
+	std::vector<uint64_t> visit;
+	std::vector<uint64_t> visitNext;
+	std::vector<node> frontier;
+	std::vector<node> next;
+	std::vector<node> reached;
+};
+
+template<typename L>
+void MultiSourceBFS::forBits(uint64_t mask, L handle) {
+	while (mask != 0) {
+		handle(static_cast<index>(__builtin_ctzll(mask)));
+		mask &= mask - 1;
+	}
+}
+
+template<typename L>
+void MultiSourceBFS::run(const std::vector<node>& sources, L handle) {
+	if (sources.size() > batchSize) {
+		throw std::runtime_error("MultiSourceBFS handles at most 64 sources at once");
+	}
+
+	frontier.clear();
+	for (index i = 0; i < sources.size(); ++i) {
+		node s = sources[i];
+		const uint64_t bit = uint64_t(1) << i;
+		if (visit[s] == 0) {
+			frontier.push_back(s);
+		}
+		seen[s] |= bit;
+		visit[s] |= bit;
+	}
+	reached = frontier;
+	for (node s : frontier) {
+		handle(s, visit[s], count(0));
+	}
+
+	count level = 0;
+	while (!frontier.empty()) {
+		++level;
+		next.clear();
+		for (node u : frontier) {
+			const uint64_t active = visit[u];
+			S.forNeighborsOf(u, [&](node v) {
+				const uint64_t d = active & ~seen[v];
+				if (d != 0) {
+					if (visitNext[v] == 0) {
+						next.push_back(v);
+					}
+					visitNext[v] |= d;
+				}
+			});
+		}
+		for (node u : frontier) {
+			visit[u] = 0;
+		}
+		for (node v : next) {
+			seen[v] |= visitNext[v];
+			visit[v] = visitNext[v];
+			visitNext[v] = 0;
+			handle(v, visit[v], level);
+		}
+		reached.insert(reached.end(), next.begin(), next.end());
+		std::swap(frontier, next);
+	}
+
+	// only reached nodes have bits set, reset them for the next batch
+	for (node v : reached) {
+		seen[v] = 0;
+	}
+}
+
+} /* namespace NetworKit */
+#endif /* MULTISOURCEBFS_H_ */
@@ -0,0 +1,203 @@
+/*
+ * ParallelBFS.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <atomic>
+#include <omp.h>
+
+#include "ParallelBFS.h"
+#include "../auxiliary/Log.h"
+
+namespace NetworKit {
+
+ParallelBFS::ParallelBFS(const Graph& G, node source, bool storeNodesSortedByDistance, node target) :
+	SSSP(G, source, false, storeNodesSortedByDistance, target), S(nullptr), sources(1, source), alpha(15.0), beta(18.0),
+	maxDistance(0), reached(0), bottomUpSteps(0) {
+}
+
+ParallelBFS::ParallelBFS(const Graph& G, const StaticGraph& S, const std::vector<node>& sources, bool storeNodesSortedByDistance, node target) :
+	SSSP(G, sources.empty() ? none : sources.front(), false, storeNodesSortedByDistance, target), S(&S), sources(sources), alpha(15.0), beta(18.0),
+	maxDistance(0), reached(0), bottomUpSteps(0) {
+	if (sources.empty()) {
+		throw std::runtime_error("ParallelBFS needs at least one source node");
+	}
+}
+
+void ParallelBFS::setSwitchingParameters(double alpha, double beta) {
+	if (alpha <= 0 || beta <= 0) {
+		throw std::runtime_error("switching parameters have to be positive");
+	}
+	this->alpha = alpha;
+	this->beta = beta;
+}
+
+void ParallelBFS::run() {
+	if (S == nullptr) {
+		ownSnapshot.reset(new StaticGraph(G));
+		S = ownSnapshot.get();
+	}
+	const StaticGraph& H = *S;
+	const count z = H.upperNodeIdBound();
+	const count words = (z + 63) / 64;
+	const count maxThreads = omp_get_max_threads();
+	const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+
+	distances.clear();
+	distances.resize(z, infDist);
+	if (storeNodesSortedByDistance) {
+		std::vector<node> empty;
+		std::swap(nodesSortedByDistance, empty);
+	}
+
+	// visited[v / 64] has bit v % 64 set iff v has been reached
+	std::vector<std::atomic<uint64_t>> visited(words);
+	for (auto& word : visited) {
+		word.store(0, std::memory_order_relaxed);
+	}
+	std::vector<uint64_t> frontierBits;
+	std::vector<std::vector<node>> localNext(maxThreads);
+
+	std::vector<node> frontier;
+	for (node s : sources) {
+		if ((visited[s / 64].fetch_or(uint64_t(1) << (s % 64)) & (uint64_t(1) << (s % 64))) == 0) {
+			frontier.push_back(s);
+			distances[s] = 0;
+		}
+	}
+
+	auto isVisited = [&](node v) {
+		return (visited[v / 64].load(std::memory_order_relaxed) >> (v % 64)) & 1;
+	};
+
+	// concatenates the thread-local buffers into frontier
+	auto gatherNext = [&]() {
+		std::vector<index> offset(maxThreads + 1, 0);
+		for (index t = 0; t < maxThreads; ++t) {
+			offset[t + 1] = offset[t] + localNext[t].size();
+		}
+		frontier.resize(offset[maxThreads]);
+		#pragma omp parallel for schedule(static, 1)
+		for (index t = 0; t < maxThreads; ++t) {
+			std::copy(localNext[t].begin(), localNext[t].end(), frontier.begin() + offset[t]);
+			localNext[t].clear();
+		}
+	};
+
+	auto frontierDegree = [&]() {
+		count sum = 0;
+		#pragma omp parallel for reduction(+:sum)
+		for (index i = 0; i < frontier.size(); ++i) {
+			sum += H.degreeOut(frontier[i]);
+		}
+		return sum;
+	};
+
+	count unexploredEdges = H.getOutTargets().size();
+	count frontierEdges = frontierDegree();
+	count level = 0;
+	count previousFrontierSize = 0;
+	bool bottomUp = false;
+	bool foundTarget = false;
+	reached = 0;
+	bottomUpSteps = 0;
+
+	while (!frontier.empty()) {
+		reached += frontier.size();
+		if (storeNodesSortedByDistance) {
+			nodesSortedByDistance.insert(nodesSortedByDistance.end(), frontier.begin(), frontier.end());
+		}
+		if (target != none && !foundTarget) {
+			foundTarget = isVisited(target);
+		}
+		maxDistance = level;
+		if (foundTarget) {
+			break;
+		}
+
+		// direction-optimizing heuristic
+		unexploredEdges -= std::min(unexploredEdges, frontierEdges);
+		if (!bottomUp && frontierEdges > unexploredEdges / alpha && H.hasInEdges()) {
+			bottomUp = true;
+		} else if (bottomUp && frontier.size() < previousFrontierSize && frontier.size() < H.numberOfNodes() / beta) {
+			bottomUp = false;
+		}
+		previousFrontierSize = frontier.size();
+		const edgeweight nextDist = level + 1;
+
+		if (bottomUp) {
+			++bottomUpSteps;
+			frontierBits.assign(words, 0);
+			#pragma omp parallel for
+			for (index i = 0; i < frontier.size(); ++i) {
+				node u = frontier[i];
+				__atomic_fetch_or(&frontierBits[u / 64], uint64_t(1) << (u % 64), __ATOMIC_RELAXED);
+			}
+
+			// every word of the visited bitmap is owned by a single thread
+			#pragma omp parallel for schedule(guided)
+			for (index w = 0; w < words; ++w) {
+				uint64_t seen = visited[w].load(std::memory_order_relaxed);
+				if (~seen == 0) continue;
+				uint64_t found = 0;
+				std::vector<node>& next = localNext[omp_get_thread_num()];
+				const node first = w * 64;
+				const node last = std::min<node>(first + 64, z);
+				for (node v = first; v < last; ++v) {
+					if (((seen >> (v % 64)) & 1) || !H.hasNode(v)) continue;
+					H.forInNeighborsOfWhile(v, [&](node u) {
+						if ((frontierBits[u / 64] >> (u % 64)) & 1) {
+							found |= uint64_t(1) << (v % 64);
+							distances[v] = nextDist;
+							next.push_back(v);
+							return false;
+						}
+						return true;
+					});
+				}
+				if (found != 0) {
+					visited[w].store(seen | found, std::memory_order_relaxed);
+				}
+			}
+		} else {
+			#pragma omp parallel for schedule(guided)
+			for (index i = 0; i < frontier.size(); ++i) {
+				std::vector<node>& next = localNext[omp_get_thread_num()];
+				H.forNeighborsOf(frontier[i], [&](node v) {
+					const uint64_t bit = uint64_t(1) << (v % 64);
+					if ((visited[v / 64].load(std::memory_order_relaxed) & bit) == 0
+							&& (visited[v / 64].fetch_or(bit, std::memory_order_relaxed) & bit) == 0) {
+						distances[v] = nextDist;
+						next.push_back(v);
+					}
+				});
+			}
+		}
+
+		gatherNext();
+		frontierEdges = frontierDegree();
+		++level;
+	}
+
+	DEBUG("parallel BFS reached ", reached, " nodes in ", maxDistance + 1, " levels, ", bottomUpSteps, " of them bottom-up");
+	hasRun = true;
+}
+
+count ParallelBFS::getMaxDistance() const {
+	assureFinished();
+	return maxDistance;
+}
+
+count ParallelBFS::numberOfReachedNodes() const {
+	assureFinished();
+	return reached;
+}
+
+count ParallelBFS::numberOfBottomUpSteps() const {
+	assureFinished();
+	return bottomUpSteps;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,94 @@
+/*
+ * ParallelBFS.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef PARALLELBFS_H_
+#define PARALLELBFS_H_
+
+#include <memory>
+
+#include "SSSP.h"
+#include "../graph/StaticGraph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Level-synchronous parallel breadth-first search with direction optimization.
+ *
+ * Each level is expanded either top-down (the frontier scans its outgoing edges) or
+ * bottom-up (every unvisited node scans its incoming edges until it finds a parent in
+ * the frontier), switching between the two with the heuristic of Beamer et al.,
+ * "Direction-Optimizing Breadth-First Search", SC 2012. The search runs on a StaticGraph
+ * snapshot, which can be passed in to amortize its construction over several searches.
+ * Only distances (and optionally the nodes sorted by distance) are computed; the number of
+ * shortest paths and the predecessors are not stored.
+ */
+class ParallelBFS : public SSSP {
+
+public:
+	/**
+	 * Constructs a parallel BFS from @a source. A StaticGraph snapshot of @a G is created on run().
+	 *
+	 * @param G The graph.
+	 * @param source The source node of the breadth-first search.
+	 * @param storeNodesSortedByDistance Store a vector of nodes ordered in increasing distance from the source.
+	 * @param target The target node, the search stops after the level in which it is reached.
+	 */
+	ParallelBFS(const Graph& G, node source, bool storeNodesSortedByDistance=false, node target = none);
+
+	/**
+	 * Constructs a parallel BFS from all nodes in @a sources (at distance 0) on the snapshot @a S of @a G.
+	 *
+	 * @param G The graph.
+	 * @param S A snapshot of @a G, it must outlive this object.
+	 * @param sources The source nodes of the breadth-first search.
+	 * @param storeNodesSortedByDistance Store a vector of nodes ordered in increasing distance from the sources.
+	 * @param target The target node, the search stops after the level in which it is reached.
+	 */
+	ParallelBFS(const Graph& G, const StaticGraph& S, const std::vector<node>& sources, bool storeNodesSortedByDistance=false, node target = none);
+
+	/**
+	 * Breadth-first search from the source node(s).
+	 */
+	void run() override;
+
+	/**
+	 * Sets the parameters of the switching heuristic. The search switches to bottom-up when the
+	 * frontier has more than (unexplored edges) / @a alpha outgoing edges, and back to top-down
+	 * when the frontier shrinks below n / @a beta nodes. Defaults are alpha = 15, beta = 18.
+	 */
+	void setSwitchingParameters(double alpha, double beta);
+
+	/**
+	 * @return The largest finite distance from the source(s), i.e. the eccentricity for a single source.
+	 */
+	count getMaxDistance() const;
+
+	/**
+	 * @return The number of nodes reached from the source(s), including the source(s).
+	 */
+	count numberOfReachedNodes() const;
+
+	/**
+	 * @return The number of levels that were expanded bottom-up.
+	 */
+	count numberOfBottomUpSteps() const;
+
+private:
+	std::unique_ptr<StaticGraph> ownSnapshot;
+	const StaticGraph* S;
+	std::vector<node> sources;
+	double alpha;
+	double beta;
+
+	count maxDistance;
+	count reached;
+	count bottomUpSteps;
+};
+
+} /* namespace NetworKit */
+#endif /* PARALLELBFS_H_ */
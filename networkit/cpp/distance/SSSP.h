@@ -24,6 +24,16 @@ class SSSP: public Algorithm {
 
 public:
 
+	/**
+	 * Shortest path algorithms for weighted graphs, for classes that run many searches internally.
+	 * DIJKSTRA: Dijkstra's algorithm, independent searches run in parallel (default).
+	 * DELTA_STEPPING: DeltaSteppingSSSP, one search at a time with all threads, which needs memory for one search only.
+	 */
+	enum WeightedAlgorithm {
+		DIJKSTRA,
+		DELTA_STEPPING
+	};
+
 	/**
 	 * Creates the SSSP class for @a G and source @a s.
 	 *
@@ -116,6 +126,9 @@ public:
 	*
 	*	For this functionality to be available, storeNodesSortedByDistance has to be set to true in the constructor.
 	*	There are no guarantees regarding the ordering of two nodes with the same distance to the source.
+	*	Only the nodes settled by the search are contained, i.e. unreachable nodes and, if a target is set, the nodes
+	*	not settled when the search stopped are left out. This also holds for Dijkstra, which used to list the
+	*	unreachable nodes last.
 	*
 	* @param moveOut If set to true, the container will be moved out of the class instead of copying it; default=true.
 	* @return vector of nodes ordered in increasing distance from the source
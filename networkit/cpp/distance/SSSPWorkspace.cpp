@@ -0,0 +1,100 @@
+/*
+ * SSSPWorkspace.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <limits>
+
+#include "SSSPWorkspace.h"
+
+namespace NetworKit {
+
+template<class PathCount>
+SSSPWorkspace<PathCount>::SSSPWorkspace(const StaticGraph& S) : S(S), dist(S.upperNodeIdBound(), std::numeric_limits<edgeweight>::max()),
+	sigma(S.upperNodeIdBound(), 0), heap(S.isWeighted() ? S.upperNodeIdBound() : 0) {
+	order.reserve(S.numberOfNodes());
+	succOffset.reserve(S.numberOfNodes() + 1);
+}
+
+template<class PathCount>
+void SSSPWorkspace<PathCount>::run(node source) {
+	const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+	// only the nodes reached by the previous search have to be reset
+	for (node v : order) {
+		dist[v] = infDist;
+		sigma[v] = 0;
+	}
+	order.clear();
+
+	if (S.isWeighted()) {
+		searchDijkstra(source);
+	} else {
+		searchBFS(source);
+	}
+	buildDAG();
+}
+
+template<class PathCount>
+void SSSPWorkspace<PathCount>::searchBFS(node source) {
+	const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+	dist[source] = 0;
+	order.push_back(source);
+	// order doubles as the queue
+	for (index head = 0; head < order.size(); ++head) {
+		node u = order[head];
+		S.forNeighborsOf(u, [&](node v) {
+			if (dist[v] == infDist) {
+				dist[v] = dist[u] + 1;
+				order.push_back(v);
+			}
+		});
+	}
+}
+
+template<class PathCount>
+void SSSPWorkspace<PathCount>::searchDijkstra(node source) {
+	heap.clear();
+	dist[source] = 0;
+	heap.insert(0, source);
+	while (!heap.empty()) {
+		node u = heap.extractMin().second;
+		order.push_back(u);
+		S.forEdgesOf(u, [&](node, node v, edgeweight w) {
+			if (dist[u] + w < dist[v]) {
+				dist[v] = dist[u] + w;
+				heap.changeKey(dist[v], v);
+			}
+		});
+	}
+}
+
+template<class PathCount>
+void SSSPWorkspace<PathCount>::buildDAG() {
+	const bool indexed = S.hasEdgeIds();
+	succOffset.resize(order.size() + 1);
+	succ.clear();
+	succEdge.clear();
+	sigma[order.front()] = 1;
+	// all predecessors of a node precede it in order, so its number of paths is final when it is reached
+	for (index i = 0; i < order.size(); ++i) {
+		node u = order[i];
+		succOffset[i] = succ.size();
+		S.forEdgesOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+			if (dist[v] == dist[u] + w) {
+				succ.push_back(v);
+				if (indexed) {
+					succEdge.push_back(eid);
+				}
+				sigma[v] += sigma[u];
+			}
+		});
+	}
+	succOffset[order.size()] = succ.size();
+}
+
+template class SSSPWorkspace<bigfloat>;
+template class SSSPWorkspace<Aux::ScaledDouble>;
+
+} /* namespace NetworKit */
@@ -0,0 +1,125 @@
+/*
+ * SSSPWorkspace.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef SSSPWORKSPACE_H_
+#define SSSPWORKSPACE_H_
+
+#include <vector>
+
+#include "../Globals.h"
+#include "../graph/StaticGraph.h"
+#include "../auxiliary/DAryHeap.h"
+#include "../auxiliary/ScaledDouble.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Reusable state for many single-source shortest path computations on the same graph,
+ * e.g. one per source in Brandes' betweenness algorithm.
+ *
+ * All arrays are allocated once in the constructor. A call of run() only resets the entries
+ * of the nodes reached by the previous call, so repeated searches do not allocate or clear
+ * O(n) memory. After run(), the shortest path DAG is available in CSR form: the nodes reached
+ * are stored in order of nondecreasing distance, and the successors of the i-th node of that
+ * order are stored contiguously. Unweighted graphs are searched with BFS, weighted graphs
+ * with Dijkstra's algorithm. Each thread needs its own workspace, the snapshot can be shared.
+ *
+ * The numbers of shortest paths are stored as PathCount, which is either bigfloat or
+ * Aux::ScaledDouble. The latter keeps counts that exceed the range of a double, but all of its
+ * operations are plain floating point arithmetic, which is much faster than bigfloat.
+ */
+template<class PathCount>
+class SSSPWorkspace final {
+
+public:
+	/**
+	 * Creates a workspace for searches on the snapshot @a S, which must outlive this object.
+	 */
+	SSSPWorkspace(const StaticGraph& S);
+
+	/**
+	 * Computes shortest paths from @a source, their number and the shortest path DAG.
+	 */
+	void run(node source);
+
+	/**
+	 * @return The nodes reached by the last search in order of nondecreasing distance.
+	 */
+	const std::vector<node>& getOrder() const {
+		return order;
+	}
+
+	/**
+	 * @return The distance of @a v from the last source, infinity if @a v has not been reached.
+	 */
+	edgeweight distance(node v) const {
+		return dist[v];
+	}
+
+	/**
+	 * @return The number of shortest paths from the last source to @a v.
+	 */
+	const PathCount& numberOfPaths(node v) const {
+		return sigma[v];
+	}
+
+	/**
+	 * @return The ratio of the numbers of shortest paths to @a u and to @a v.
+	 */
+	double pathRatio(node u, node v) const {
+		return ratio(sigma[u], sigma[v]);
+	}
+
+	/**
+	 * Calls @a handle(w, eid) for every successor w of the @a i-th node of getOrder() in the
+	 * shortest path DAG. @a eid is the id of the edge, or none if the graph has no edge ids.
+	 */
+	template<typename L> void forSuccessorsOf(index i, L handle) const;
+
+private:
+	const StaticGraph& S;
+	std::vector<edgeweight> dist;
+	std::vector<PathCount> sigma;
+	std::vector<node> order;
+	std::vector<index> succOffset;
+	std::vector<node> succ;
+	std::vector<edgeid> succEdge;
+	Aux::DAryHeap<edgeweight, node> heap;
+
+	static double ratio(const bigfloat& a, const bigfloat& b) {
+		// workaround for integer overflow in large graphs
+		bigfloat tmp = a / b;
+		double result;
+		tmp.ToDouble(result);
+		return result;
+	}
+
+	static double ratio(const Aux::ScaledDouble& a, const Aux::ScaledDouble& b) {
+		return a / b;
+	}
+
+	void searchBFS(node source);
+	void searchDijkstra(node source);
+
+	/**
+	 * Counts the shortest paths and stores the DAG edges, the nodes in order are final.
+	 */
+	void buildDAG();
+};
+
+template<class PathCount>
+template<typename L>
+void SSSPWorkspace<PathCount>::forSuccessorsOf(index i, L handle) const {
+	const bool indexed = S.hasEdgeIds();
+	for (index j = succOffset[i]; j < succOffset[i + 1]; ++j) {
+		handle(succ[j], indexed ? succEdge[j] : none);
+	}
+}
+
+} /* namespace NetworKit */
+#endif /* SSSPWORKSPACE_H_ */
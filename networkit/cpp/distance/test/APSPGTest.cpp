@@ -10,6 +10,8 @@
 #include "APSPGTest.h"
 #include "../APSP.h"
 #include "../DynAPSP.h"
+#include "../Diameter.h"
+#include "../../generators/ErdosRenyiGenerator.h"
 #include "../../io/METISGraphReader.h"
 #include <string>
 #include "../../auxiliary/Random.h"
@@ -64,6 +66,27 @@ TEST_F(APSPGTest, tryAPSP) {
 	apsp.run();
 }
 
+TEST_F(APSPGTest, testAPSPDeltaStepping) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(200, 0.05).generate();
+	Graph Gw(G, true, false);
+	Gw.forEdges([&](node u, node v) {
+		Gw.setWeight(u, v, Aux::Random::real(0.5, 5.0));
+	});
+
+	APSP dijkstra(Gw);
+	dijkstra.run();
+	APSP deltaStepping(Gw, SSSP::DELTA_STEPPING);
+	deltaStepping.run();
+	EXPECT_EQ(dijkstra.getDistances(), deltaStepping.getDistances());
+
+	Diameter exact(Gw, DiameterAlgo::exact);
+	exact.run();
+	Diameter exactDeltaStepping(Gw, DiameterAlgo::exact, -1.f, 0, SSSP::DELTA_STEPPING);
+	exactDeltaStepping.run();
+	EXPECT_EQ(exact.getDiameter(), exactDeltaStepping.getDiameter());
+}
+
 TEST_F(APSPGTest, testDynAPSPRealGraph) {
 	METISGraphReader reader;
 	Graph G = reader.read("input/karate.graph");
@@ -9,6 +9,7 @@
 #include "DistanceGTest.h"
 
 #include "../Diameter.h"
+#include "../Eccentricity.h"
 #include "../EffectiveDiameter.h"
 #include "../EffectiveDiameterApproximation.h"
 #include "../HopPlotApproximation.h"
@@ -82,6 +83,20 @@ TEST_F(DistanceGTest, testPedanticDiameterErdos) {
 }
 
 
+TEST_F(DistanceGTest, testEccentricity) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/jazz.graph");
+	StaticGraph S(G);
+	count diameter = 0;
+	G.forNodes([&](node u) {
+		std::pair<node, count> single = Eccentricity::getValue(G, u);
+		std::pair<node, count> shared = Eccentricity::getValue(G, S, u);
+		EXPECT_EQ(single.second, shared.second);
+		diameter = std::max(diameter, single.second);
+	});
+	EXPECT_EQ(6u, diameter);
+}
+
 TEST_F(DistanceGTest, testEffectiveDiameterMinimal) {
 	// Minimal example from the paper
 	Graph G(5);
@@ -8,12 +8,19 @@
 #include "SSSPGTest.h"
 #include "../DynBFS.h"
 #include "../BFS.h"
+#include "../ParallelBFS.h"
+#include "../MultiSourceBFS.h"
+#include "../SSSPWorkspace.h"
 #include "../DynDijkstra.h"
 #include "../Dijkstra.h"
+#include "../DeltaSteppingSSSP.h"
 #include "../../io/METISGraphReader.h"
+#include "../../generators/ErdosRenyiGenerator.h"
 #include "../../auxiliary/Log.h"
 
 #include <stack>
+#include <memory>
+#include <algorithm>
 
 
 namespace NetworKit {
@@ -53,6 +60,199 @@ TEST_F(SSSPGTest, testDijkstra) {
 #endif
 }
 
+TEST_F(SSSPGTest, testDijkstraQueueTypes) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(300, 0.02).generate();
+	Graph Gw(G, true, false);
+	Gw.forEdges([&](node u, node v) {
+		Gw.setWeight(u, v, (double) Aux::Random::integer(1, 10));
+	});
+
+	Gw.forNodes([&](node s) {
+		if (s % 30 != 0) return;
+		Dijkstra tree(Gw, s, true, true, none, Dijkstra::TREE);
+		Dijkstra dary(Gw, s, true, true, none, Dijkstra::DARY_HEAP);
+		Dijkstra radix(Gw, s, true, true, none, Dijkstra::RADIX_HEAP);
+		tree.run();
+		dary.run();
+		radix.run();
+		EXPECT_EQ(tree.getDistances(false), dary.getDistances(false));
+		EXPECT_EQ(tree.getDistances(false), radix.getDistances(false));
+		// ties are broken by node id in both tree and heap
+		EXPECT_EQ(tree.getNodesSortedByDistance(false), dary.getNodesSortedByDistance(false));
+		std::vector<node> radixOrder = radix.getNodesSortedByDistance(false);
+		EXPECT_EQ(tree.getNodesSortedByDistance(false).size(), radixOrder.size());
+		for (index i = 1; i < radixOrder.size(); ++i) {
+			EXPECT_LE(radix.distance(radixOrder[i - 1]), radix.distance(radixOrder[i]));
+		}
+		Gw.forNodes([&](node t) {
+			EXPECT_EQ(tree.numberOfPaths(t), radix.numberOfPaths(t));
+		});
+	});
+}
+
+TEST_F(SSSPGTest, testParallelBFS) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+	Aux::Random::setSeed(42, false);
+	Graph D = ErdosRenyiGenerator(500, 0.01, true).generate();
+
+	for (Graph* H : {&G, &D}) {
+		StaticGraph S(*H);
+		for (node s : {node(0), node(17), node(250)}) {
+			BFS bfs(*H, s, false, true);
+			bfs.run();
+			ParallelBFS defaultBFS(*H, s, true);
+			defaultBFS.run();
+			// switch to bottom-up as early as possible and never back
+			ParallelBFS bottomUp(*H, S, {s}, true);
+			bottomUp.setSwitchingParameters(1e9, 1e9);
+			bottomUp.run();
+			if (H->degreeOut(s) > 0) {
+				// every level including the last, unproductive one is expanded bottom-up
+				EXPECT_EQ(bottomUp.getMaxDistance() + 1, bottomUp.numberOfBottomUpSteps());
+			}
+			EXPECT_EQ(bfs.getDistances(false), defaultBFS.getDistances(false));
+			EXPECT_EQ(bfs.getDistances(false), bottomUp.getDistances(false));
+			EXPECT_EQ(bfs.getNodesSortedByDistance(false).size(), bottomUp.numberOfReachedNodes());
+			std::vector<node> order = bottomUp.getNodesSortedByDistance(false);
+			EXPECT_EQ(bfs.getNodesSortedByDistance(false).size(), order.size());
+			for (index i = 1; i < order.size(); ++i) {
+				EXPECT_LE(bottomUp.distance(order[i - 1]), bottomUp.distance(order[i]));
+			}
+		}
+
+		// multi-source search equals the minimum over single-source searches
+		std::vector<node> sources = {3, 42, 99};
+		ParallelBFS multi(*H, S, sources);
+		multi.run();
+		std::vector<edgeweight> expected(H->upperNodeIdBound(), std::numeric_limits<edgeweight>::max());
+		for (node s : sources) {
+			BFS bfs(*H, s, false);
+			bfs.run();
+			H->forNodes([&](node v) {
+				expected[v] = std::min(expected[v], bfs.distance(v));
+			});
+		}
+		EXPECT_EQ(expected, multi.getDistances(false));
+	}
+}
+
+TEST_F(SSSPGTest, testMultiSourceBFS) {
+	Aux::Random::setSeed(42, false);
+	Graph U = ErdosRenyiGenerator(400, 0.005).generate();
+	Graph D = ErdosRenyiGenerator(400, 0.01, true).generate();
+	edgeweight infDist = std::numeric_limits<edgeweight>::max();
+
+	for (Graph* H : {&U, &D}) {
+		StaticGraph S(*H, false);
+		MultiSourceBFS msbfs(S);
+		// consecutive batches reuse the workspace, the last one is not full
+		for (node first = 0; first < 400; first += 70) {
+			std::vector<node> sources;
+			for (node s = first; s < std::min<node>(first + 64, 400); ++s) {
+				sources.push_back(s);
+			}
+			std::vector<std::vector<edgeweight>> dist(sources.size(), std::vector<edgeweight>(400, infDist));
+			msbfs.run(sources, [&](node v, uint64_t mask, count d) {
+				MultiSourceBFS::forBits(mask, [&](index i) {
+					EXPECT_EQ(infDist, dist[i][v]);
+					dist[i][v] = d;
+				});
+			});
+			for (index i = 0; i < sources.size(); ++i) {
+				BFS bfs(*H, sources[i], false);
+				bfs.run();
+				EXPECT_EQ(bfs.getDistances(false), dist[i]);
+			}
+		}
+	}
+}
+
+TEST_F(SSSPGTest, testSSSPWorkspace) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(300, 0.02).generate();
+	Graph Gw(G, true, true);
+	Gw.forEdges([&](node u, node v) {
+		Gw.setWeight(u, v, (double) Aux::Random::integer(1, 3));
+	});
+
+	for (Graph* H : {&G, &Gw}) {
+		StaticGraph S(*H, false);
+		SSSPWorkspace<bigfloat> workspace(S);
+		// the same workspace is reused for all sources
+		H->forNodes([&](node s) {
+			if (s % 20 != 0) return;
+			std::unique_ptr<SSSP> sssp;
+			if (H->isWeighted()) {
+				sssp.reset(new Dijkstra(*H, s, true, true));
+			} else {
+				sssp.reset(new BFS(*H, s, true, true));
+			}
+			sssp->run();
+			workspace.run(s);
+
+			const std::vector<node>& order = workspace.getOrder();
+			EXPECT_EQ(sssp->getNodesSortedByDistance(false).size(), order.size());
+			count dagEdges = 0;
+			for (index i = 0; i < order.size(); ++i) {
+				node u = order[i];
+				EXPECT_EQ(sssp->distance(u), workspace.distance(u));
+				EXPECT_EQ(sssp->numberOfPaths(u), workspace.numberOfPaths(u));
+				if (i > 0) {
+					EXPECT_LE(workspace.distance(order[i - 1]), workspace.distance(u));
+				}
+				workspace.forSuccessorsOf(i, [&](node w, edgeid) {
+					std::vector<node> pred = sssp->getPredecessors(w);
+					EXPECT_NE(pred.end(), std::find(pred.begin(), pred.end(), u));
+					++dagEdges;
+				});
+			}
+			count predecessors = 0;
+			for (node u : order) {
+				predecessors += sssp->getPredecessors(u).size();
+			}
+			EXPECT_EQ(predecessors, dagEdges);
+			H->forNodes([&](node v) {
+				EXPECT_EQ(sssp->distance(v), workspace.distance(v));
+			});
+		});
+	}
+}
+
+TEST_F(SSSPGTest, testScaledPathCounts) {
+	// a chain of k diamonds has 2^k shortest paths between its ends, more than a double can hold
+	const count k = 1100;
+	Graph G(3 * k + 1);
+	for (index i = 0; i < k; ++i) {
+		node a = 3 * i;
+		G.addEdge(a, a + 1);
+		G.addEdge(a, a + 2);
+		G.addEdge(a + 1, a + 3);
+		G.addEdge(a + 2, a + 3);
+	}
+	StaticGraph S(G);
+
+	SSSPWorkspace<bigfloat> exact(S);
+	SSSPWorkspace<Aux::ScaledDouble> scaled(S);
+	for (node s : {node(0), node(3 * k)}) {
+		exact.run(s);
+		scaled.run(s);
+		EXPECT_EQ(exact.getOrder(), scaled.getOrder());
+		const std::vector<node>& order = exact.getOrder();
+		for (index i = 0; i < order.size(); ++i) {
+			node u = order[i];
+			exact.forSuccessorsOf(i, [&](node w, edgeid) {
+				double expected = exact.pathRatio(u, w);
+				EXPECT_NEAR(expected, scaled.pathRatio(u, w), 1e-12 * expected);
+			});
+		}
+		node t = (s == 0) ? 3 * k : 0;
+		EXPECT_NEAR((double) k, scaled.numberOfPaths(t).log2(), 1e-9);
+	}
+	EXPECT_EQ(std::numeric_limits<double>::infinity(), scaled.numberOfPaths(0).toDouble());
+}
+
 TEST_F(SSSPGTest, testShortestPaths) {
 	METISGraphReader reader;
 	Graph G = reader.read("input/PGPgiantcompo.graph");
@@ -155,6 +355,100 @@ TEST_F(SSSPGTest, testDirectedBFS) {
 	EXPECT_EQ(sssp.distance(7), 3);
 }
 
+TEST_F(SSSPGTest, testDeltaStepping) {
+	Aux::Random::setSeed(42, false);
+	for (bool directed : {false, true}) {
+		Graph G = ErdosRenyiGenerator(500, 0.01, directed).generate();
+		Graph Gw(G, true, directed);
+		Gw.forEdges([&](node u, node v) {
+			Gw.setWeight(u, v, (double) Aux::Random::integer(1, 20));
+		});
+
+		Gw.forNodes([&](node s) {
+			if (s % 50 != 0) return;
+			Dijkstra dijkstra(Gw, s, true, true);
+			dijkstra.run();
+			// automatic delta, and deltas below the smallest and above the largest weight
+			for (edgeweight delta : {0.0, 0.5, 25.0}) {
+				DeltaSteppingSSSP delta_stepping(Gw, s, true, true, none, delta);
+				delta_stepping.run();
+				EXPECT_EQ(dijkstra.getDistances(false), delta_stepping.getDistances(false));
+				std::vector<node> order = delta_stepping.getNodesSortedByDistance(false);
+				EXPECT_EQ(dijkstra.getNodesSortedByDistance(false).size(), order.size());
+				for (index i = 1; i < order.size(); ++i) {
+					EXPECT_LE(delta_stepping.distance(order[i - 1]), delta_stepping.distance(order[i]));
+				}
+				Gw.forNodes([&](node t) {
+					EXPECT_EQ(dijkstra.numberOfPaths(t), delta_stepping.numberOfPaths(t));
+					std::vector<node> expected = dijkstra.getPredecessors(t);
+					std::vector<node> actual = delta_stepping.getPredecessors(t);
+					std::sort(expected.begin(), expected.end());
+					std::sort(actual.begin(), actual.end());
+					EXPECT_EQ(expected, actual);
+				});
+			}
+		});
+	}
+}
+
+TEST_F(SSSPGTest, testDeltaSteppingTargetAndErrors) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(300, 0.02).generate();
+	Graph Gw(G, true, false);
+	Gw.forEdges([&](node u, node v) {
+		Gw.setWeight(u, v, Aux::Random::real(0.1, 10.0));
+	});
+	StaticGraph S(Gw);
+
+	Dijkstra dijkstra(Gw, 0, false);
+	dijkstra.run();
+	node target = 0;
+	Gw.forNodes([&](node v) {
+		if (dijkstra.distance(v) != std::numeric_limits<edgeweight>::max() && dijkstra.distance(v) > dijkstra.distance(target)) {
+			target = v;
+		}
+	});
+	DeltaSteppingSSSP sssp(Gw, S, 0, true, false, target, 1.0);
+	sssp.run();
+	EXPECT_EQ(dijkstra.distance(target), sssp.distance(target));
+	EXPECT_FALSE(sssp.getPath(target).empty());
+	EXPECT_LE(sssp.numberOfBuckets(), (count) (dijkstra.distance(target) / sssp.getDelta()) + 1);
+
+	Gw.forEdges([&](node u, node v) {
+		if (u == 0 || v == 0) {
+			Gw.setWeight(u, v, -1.0);
+		}
+	});
+	DeltaSteppingSSSP negative(Gw, 0);
+	EXPECT_THROW(negative.run(), std::runtime_error);
+}
+
+TEST_F(SSSPGTest, testDeltaSteppingZeroWeightsAndRerun) {
+	// the two shortest paths to 3 continue over zero-weight edges to 4 and 5, which have the same distance
+	Graph G(6, true, true);
+	G.addEdge(0, 1, 1.0);
+	G.addEdge(0, 2, 1.0);
+	G.addEdge(1, 3, 1.0);
+	G.addEdge(2, 3, 1.0);
+	G.addEdge(5, 4, 0.0);
+	G.addEdge(3, 5, 0.0);
+	DeltaSteppingSSSP sssp(G, 0, true, true);
+	sssp.run();
+	Dijkstra dijkstra(G, 0, true, true);
+	dijkstra.run();
+	G.forNodes([&](node v) {
+		EXPECT_EQ(dijkstra.distance(v), sssp.distance(v));
+		EXPECT_EQ(dijkstra.numberOfPaths(v), sssp.numberOfPaths(v));
+	});
+	EXPECT_EQ(2.0, sssp._numberOfPaths(4));
+
+	// an own snapshot is rebuilt, so the next run sees the new edge
+	G.addEdge(0, 4, 1.0);
+	sssp.run();
+	EXPECT_EQ(1.0, sssp.distance(4));
+	EXPECT_EQ(1.0, sssp._numberOfPaths(4));
+}
+
 TEST_F(SSSPGTest, testDirectedDijkstra) {
 /* Graph:
          ________
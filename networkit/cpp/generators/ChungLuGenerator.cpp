@@ -11,49 +11,73 @@
 #include "ChungLuGenerator.h"
 #include "../graph/GraphBuilder.h"
 #include "../auxiliary/Parallel.h"
+#include "../auxiliary/SignalHandling.h"
 
 namespace NetworKit {
 
 ChungLuGenerator::ChungLuGenerator(const std::vector< NetworKit::count > &degreeSequence) :
 		StaticDegreeSequenceGenerator(degreeSequence) {
-	sum_deg = std::accumulate(seq.begin(), seq.end(), 0);
+	sum_deg = std::accumulate(seq.begin(), seq.end(), count(0));
 	n = (count) seq.size();
 }
 
-	Graph ChungLuGenerator::generate() {
-		GraphBuilder gB(n);
+template<typename L>
+void ChungLuGenerator::forEdges(uint64_t seed, L handle) {
+	Aux::SignalHandler handler;
 
-		/* We need a sorted list in descending order for this algorithm */
-		Aux::Parallel::sort(seq.begin(), seq.end(), [](count a, count b){ return a > b;});
+	/* We need a sorted list in descending order for this algorithm */
+	Aux::Parallel::sort(seq.begin(), seq.end(), [](count a, count b){ return a > b;});
 
-		for (node u = 0; u <= n - 2; u++) {
-			node v = u + 1;
-			/* Apparently it is necessary to include all these casts for
-             * the probability to be properly calculated */
-			double p = std::min(((double) seq[u]) * ((double) seq[v]) / sum_deg, 1.0);
+	/* the rows of high degree nodes are longer, so they are distributed dynamically */
+	#pragma omp parallel for schedule(dynamic, 16)
+	for (node u = 0; u < n; u++) {
+		if (!handler.isRunning()) continue;
+		Aux::Philox urng(seed, u);
+		node v = u + 1;
+		if (v >= n) continue;
+		/* Apparently it is necessary to include all these casts for
+		 * the probability to be properly calculated */
+		double p = std::min(((double) seq[u]) * ((double) seq[v]) / sum_deg, 1.0);
 
-			while (v < n && p > 0) {
-				if (p != 1.0) {
-					double randVal = Aux::Random::probability();
-					/* Calculate the distance to the next potential neighbour*/
-					v = v + (node) std::floor(log(randVal)/log(1 - p));
-				}
-				if ((count) v < n) {
-					double q = std::min(((double) seq[u]) * ((double) seq[v]) / sum_deg, 1.0);
-					double randVal2 = Aux::Random::probability();
-					/* The potential neighbour was selected with the probability p.
-                     * In order to see if this neighbour should be rejected or accepted
-                     * we correct the probability using q */
-					if (randVal2 < q / p) {
-						gB.addHalfOutEdge(u, v);
-					}
-					p = q;
-					v++;
+		while (v < n && p > 0) {
+			if (p != 1.0) {
+				double randVal = urng.probability();
+				/* Calculate the distance to the next potential neighbour*/
+				double skip = std::floor(log(randVal)/log(1 - p));
+				if (skip >= (double) (n - v)) break;
+				v = v + (node) skip;
+			}
+			if ((count) v < n) {
+				double q = std::min(((double) seq[u]) * ((double) seq[v]) / sum_deg, 1.0);
+				double randVal2 = urng.probability();
+				/* The potential neighbour was selected with the probability p.
+				 * In order to see if this neighbour should be rejected or accepted
+				 * we correct the probability using q */
+				if (randVal2 < q / p) {
+					handle(u, v);
 				}
+				p = q;
+				v++;
 			}
 		}
-
-		return gB.toGraph(true,true);
 	}
+	handler.assureRunning();
+}
+
+Graph ChungLuGenerator::generate() {
+	const uint64_t seed = Aux::Random::integer();
+	GraphBuilder gB(n);
+	forEdges(seed, [&](node u, node v) {
+		gB.addHalfOutEdge(u, v);
+	});
+	return gB.toGraph(true,true);
+}
+
+void ChungLuGenerator::generate(EdgeStreamWriter& writer) {
+	const uint64_t seed = Aux::Random::integer();
+	forEdges(seed, [&](node u, node v) {
+		writer.addEdge(u, v);
+	});
+}
 
 } /* namespace NetworKit */
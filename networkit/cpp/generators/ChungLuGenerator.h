@@ -10,6 +10,7 @@
 
 #include "StaticDegreeSequenceGenerator.h"
 #include "../auxiliary/Random.h"
+#include "../io/EdgeStreamWriter.h"
 
 namespace NetworKit {
 
@@ -27,6 +28,8 @@ namespace NetworKit {
  * "Efficient Generation of Networks with Given Expected Degrees" (2011)
  * http://aric.hagberg.org/papers/miller-2011-efficient.pdf .
  * It gives a complexity of O(n+m) as opposed to quadratic.
+ * The candidate neighbors of every node are skipped through independently and in
+ * parallel, the result does not depend on the number of threads.
  *
  */
 
@@ -35,6 +38,12 @@ protected:
 	count sum_deg;
 	count n;
 
+	/**
+	 * Calls @a handle(u, v) for every sampled edge (u, v) with u < v, in parallel. Node u is
+	 * handled by a single thread and draws from its own random stream of @a seed.
+	 */
+	template<typename L> void forEdges(uint64_t seed, L handle);
+
 public:
 	ChungLuGenerator(const std::vector<count>& degreeSequence);
 
@@ -42,6 +51,11 @@ public:
 	 * Generates graph with expected degree sequence seq.
 	 */
 	virtual Graph generate();
+
+	/**
+	 * Writes the edges of a graph with expected degree sequence seq to @a writer instead of building a Graph.
+	 */
+	void generate(EdgeStreamWriter& writer);
 };
 
 } /* namespace NetworKit */
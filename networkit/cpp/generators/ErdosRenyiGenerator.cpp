@@ -8,6 +8,7 @@
 #include "ErdosRenyiGenerator.h"
 #include "../auxiliary/Random.h"
 #include "../auxiliary/SignalHandling.h"
+#include "../graph/GraphBuilder.h"
 
 namespace NetworKit {
 
@@ -15,42 +16,49 @@ ErdosRenyiGenerator::ErdosRenyiGenerator(count nNodes, double prob, bool directe
 
 }
 
-
-/**
- * Returns number of steps you need to wait until the next success (edge) occurs.
- */
-static inline count get_next_edge_distance(const double log_cp) {
-	return (count) 1 + floor(log(1.0 - Aux::Random::probability()) / log_cp);
-}
-
-Graph ErdosRenyiGenerator::generate() {
+template<typename L>
+void ErdosRenyiGenerator::forEdges(uint64_t seed, L handle) const {
 	Aux::SignalHandler handler;
-	Graph G(n, false, directed);
 	const double log_cp = log(1.0 - p); // log of counter probability
 
-	// create edges
-	node curr = 1;
-	node next = -1; // according to Batagelj/Brandes
-	while (curr < n) {
-		handler.assureRunning();
-		// compute new step length
-		next += get_next_edge_distance(log_cp);
-
-		// check if at end of row
-		while ((next >= curr) && (curr < n)) {
-			// adapt to next row
-			next = next - curr;
-			curr++;
-		}
-
-		// insert edge
-		if (curr < n) {
-			G.addEdge(curr, next);
+	// node u chooses among the nodes below it, or among all other nodes if the graph is directed
+	#pragma omp parallel for schedule(dynamic, 256)
+	for (index u = 0; u < n; ++u) {
+		if (!handler.isRunning()) continue;
+		const count candidates = directed ? n - 1 : u;
+		if (p <= 0.0 || candidates == 0) continue;
+		Aux::Philox urng(seed, u);
+		// according to Batagelj/Brandes, the distance to the next edge is geometrically distributed
+		count next = 0;
+		while (true) {
+			if (p < 1.0) {
+				double skip = floor(log(1.0 - urng.real()) / log_cp);
+				if (skip >= (double) (candidates - next)) break;
+				next += (count) skip;
+			}
+			if (next >= candidates) break;
+			node v = (directed && next >= u) ? next + 1 : next;
+			handle(u, v);
+			++next;
 		}
 	}
+	handler.assureRunning();
+}
+
+Graph ErdosRenyiGenerator::generate() {
+	const uint64_t seed = Aux::Random::integer();
+	GraphBuilder builder(n, false, directed);
+	forEdges(seed, [&](node u, node v) {
+		builder.addHalfOutEdge(u, v);
+	});
+	return builder.toGraph(true, true);
+}
 
-	G.shrinkToFit();
-	return G;
+void ErdosRenyiGenerator::generate(EdgeStreamWriter& writer) {
+	const uint64_t seed = Aux::Random::integer();
+	forEdges(seed, [&](node u, node v) {
+		writer.addEdge(u, v);
+	});
 }
 
 } /* namespace NetworKit */
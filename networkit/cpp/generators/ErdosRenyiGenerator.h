@@ -9,6 +9,7 @@
 #define ERDOSRENYIGENERATOR_H_
 
 #include "StaticGraphGenerator.h"
+#include "../io/EdgeStreamWriter.h"
 #include <cmath>
 
 namespace NetworKit {
@@ -23,11 +24,19 @@ protected:
 	double p;
 	bool directed;
 
+	/**
+	 * Calls @a handle(u, v) for every sampled edge (u, v), in parallel. Node u is
+	 * handled by a single thread and draws from its own random stream of @a seed.
+	 */
+	template<typename L> void forEdges(uint64_t seed, L handle) const;
+
 public:
 	/**
 	 * Creates random graphs in the G(n,p) model.
 	 * The generation follows Vladimir Batagelj and Ulrik Brandes: "Efficient
 	 * generation of large random networks", Phys Rev E 71, 036113 (2005).
+	 * The candidate neighbors of every node are skipped through independently and
+	 * in parallel, the result does not depend on the number of threads.
 	 *
 	 * @param nNodes Number of nodes n in the graph.
 	 * @param prob Probability of existence for each edge p.
@@ -36,6 +45,11 @@ public:
 	ErdosRenyiGenerator(count nNodes, double prob, bool directed=false);
 
 	virtual Graph generate();
+
+	/**
+	 * Writes the edges of a random graph to @a writer instead of building a Graph.
+	 */
+	void generate(EdgeStreamWriter& writer);
 };
 
 } /* namespace NetworKit */
@@ -9,6 +9,11 @@
 #include "../auxiliary/Random.h"
 #include "../auxiliary/NumericTools.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/Parallel.h"
+#include "../graph/GraphBuilder.h"
+
+#include <algorithm>
+#include <tuple>
 
 namespace NetworKit {
 
@@ -22,52 +27,53 @@ RmatGenerator::RmatGenerator(count scale, count edgeFactor, double a, double b,
 	defaultEdgeWeight = 1.0;
 }
 
-Graph RmatGenerator::generate() {
-	count n = (1 << scale);
-	if (n <= reduceNodes) {
-		throw std::runtime_error("Error, shall delete more nodes than the graph originally has");
-	}
-	// when nodes are deleted, all nodes have less neighbors
-	count numEdges = n * edgeFactor * n * 1.0 / (n - reduceNodes);
-	count wantedEdges = (n - reduceNodes) * edgeFactor;
-	Graph G(n - reduceNodes, weighted);
-	double ab = a+b;
-	double abc = ab+c;
+namespace {
 
-	auto quadrant([&]() {
-		double r = Aux::Random::probability();
-		TRACE("r: ", r);
+struct SampledEdge {
+	node u;
+	node v;
+	index e; // position in the stream of edges
+};
 
-		if (r <= a) {
-			return 0;
-		}
-		else if (r <= ab) {
-			return 1;
-		}
-		else if (r <= abc) {
-			return 2;
-		}
-		else return 3;
-	});
-
-	auto drawEdge([&]() {
-		node u = 0;
-		node v = 0;
-		for (index i = 0; i < scale; ++i) {
-			count q = quadrant();
-//			TRACE("q: ", q);
-			u = u << 1;
-			v = v << 1;
-			u = u | (q >> 1);
-			v = v | (q & 1);
-		}
+bool lessByEndpoints(const SampledEdge& x, const SampledEdge& y) {
+	return x.u < y.u || (x.u == y.u && (x.v < y.v || (x.v == y.v && x.e < y.e)));
+}
+
+bool sameEndpoints(const SampledEdge& x, const SampledEdge& y) {
+	return x.u == y.u && x.v == y.v;
+}
 
-		return std::make_pair(u, v);
-	});
+} // namespace
 
-	if (reduceNodes > 0) {
-		std::vector<node> nodemap(n, 0);
+std::pair<node, node> RmatGenerator::drawEdge(uint64_t seed, index e) const {
+	Aux::Philox urng(seed, e);
+	const double ab = a + b;
+	const double abc = ab + c;
+	node u = 0;
+	node v = 0;
+	for (index i = 0; i < scale; ++i) {
+		double r = urng.probability();
+		count q = (r <= a) ? 0 : (r <= ab) ? 1 : (r <= abc) ? 2 : 3;
+		u = u << 1;
+		v = v << 1;
+		u = u | (q >> 1);
+		v = v | (q & 1);
+	}
+	return std::make_pair(u, v);
+}
+
+count RmatGenerator::numberOfDraws(count n) const {
+	// when nodes are deleted, all nodes have less neighbors
+	return n * edgeFactor * n * 1.0 / (n - reduceNodes);
+}
 
+std::vector<node> RmatGenerator::drawNodeMap(count n) const {
+	if (n <= reduceNodes) {
+		throw std::runtime_error("Error, shall delete more nodes than the graph originally has");
+	}
+	std::vector<node> nodemap;
+	if (reduceNodes > 0) {
+		nodemap.assign(n, 0);
 		for (count deletedNodes = 0; deletedNodes < reduceNodes;) {
 			node u = Aux::Random::index(n);
 			if (nodemap[u] == 0) {
@@ -82,47 +88,127 @@ Graph RmatGenerator::generate() {
 				++u;
 			}
 		}
+	}
+	return nodemap;
+}
 
-		node u, v;
-		if (weighted) {
-			for (index e = 0; e < numEdges; ++e) {
-				std::tie(u, v) = drawEdge();
-				u = nodemap[u];
-				v = nodemap[v];
-				if (u != none && v != none) {
-					G.increaseWeight(u, v, defaultEdgeWeight);
+count RmatGenerator::sampleEdges(std::vector<std::pair<node, node>>& edges, std::vector<edgeweight>& weights) {
+	count n = count(1) << scale;
+	std::vector<node> nodemap = drawNodeMap(n);
+	count numEdges = numberOfDraws(n);
+	count wantedEdges = (n - reduceNodes) * edgeFactor;
+
+	const uint64_t seed = Aux::Random::integer();
+	// draws the edges [first, first + k) into samples, rejected edges get u = none
+	std::vector<SampledEdge> samples;
+	auto draw = [&](index first, count k) {
+		const index offset = samples.size();
+		samples.resize(offset + k);
+		#pragma omp parallel for
+		for (index i = 0; i < k; ++i) {
+			SampledEdge& s = samples[offset + i];
+			s.e = first + i;
+			std::tie(s.u, s.v) = drawEdge(seed, s.e);
+			if (reduceNodes > 0) {
+				s.u = nodemap[s.u];
+				s.v = nodemap[s.v];
+				if (s.u == none || s.v == none || (!weighted && s.u == s.v)) {
+					s.u = none;
+					continue;
 				}
 			}
-		} else {
-			while (G.numberOfEdges() < wantedEdges) {
-				std::tie(u, v) = drawEdge();
-				u = nodemap[u];
-				v = nodemap[v];
-				if (u != none && v != none && u != v && !G.hasEdge(u, v)) {
-					G.addEdge(u, v);
-				}
+			if (s.u > s.v) {
+				std::swap(s.u, s.v);
 			}
 		}
-	} else {
-		if (weighted) {
-			for (index e = 0; e < numEdges; ++e) {
-				std::pair<node, node> drawnEdge = drawEdge();
-				//			TRACE("edge drawn: ", drawnEdge.first, " - ", drawnEdge.second);
-				G.increaseWeight(drawnEdge.first, drawnEdge.second, defaultEdgeWeight);
+		samples.erase(std::remove_if(samples.begin() + offset, samples.end(), [](const SampledEdge& s) {
+			return s.u == none;
+		}), samples.end());
+		Aux::Parallel::sort(samples.begin(), samples.end(), lessByEndpoints);
+	};
+
+	edges.clear();
+	weights.clear();
+	if (weighted) {
+		// every drawn edge increases the weight of its edge by the default weight
+		draw(0, numEdges);
+		for (index i = 0; i < samples.size(); ++i) {
+			if (i == 0 || !sameEndpoints(samples[i - 1], samples[i])) {
+				edges.emplace_back(samples[i].u, samples[i].v);
+				weights.push_back(0.0);
 			}
-		} else {
-			while (G.numberOfEdges() < wantedEdges) {
-				std::pair<node, node> drawnEdge = drawEdge();
-				//			TRACE("edge drawn: ", drawnEdge.first, " - ", drawnEdge.second);
-				if (!G.hasEdge(drawnEdge.first, drawnEdge.second)) {
-					G.addEdge(drawnEdge.first, drawnEdge.second);
+			weights.back() += defaultEdgeWeight;
+		}
+	} else {
+		// the result are the first wantedEdges distinct edges of the stream, as if they were drawn one by one
+		index drawn = 0;
+		while (samples.size() < wantedEdges) {
+			count missing = wantedEdges - samples.size();
+			draw(drawn, missing + missing / 8 + 64);
+			drawn += missing + missing / 8 + 64;
+			samples.erase(std::unique(samples.begin(), samples.end(), sameEndpoints), samples.end());
+		}
+		Aux::Parallel::sort(samples.begin(), samples.end(), [](const SampledEdge& x, const SampledEdge& y) {
+			return x.e < y.e;
+		});
+		samples.resize(wantedEdges);
+		Aux::Parallel::sort(samples.begin(), samples.end(), lessByEndpoints);
+		edges.resize(wantedEdges);
+		#pragma omp parallel for
+		for (index i = 0; i < wantedEdges; ++i) {
+			edges[i] = std::make_pair(samples[i].u, samples[i].v);
+		}
+	}
+	return n - reduceNodes;
+}
+
+Graph RmatGenerator::generate() {
+	std::vector<std::pair<node, node>> edges;
+	std::vector<edgeweight> weights;
+	count n = sampleEdges(edges, weights);
+
+	// the edges are sorted by their first node, so every node adds its own edges
+	GraphBuilder builder(n, weighted);
+	#pragma omp parallel for schedule(dynamic, 1024)
+	for (node u = 0; u < n; ++u) {
+		auto it = std::lower_bound(edges.begin(), edges.end(), std::make_pair(u, node(0)));
+		for (; it != edges.end() && it->first == u; ++it) {
+			builder.addHalfOutEdge(u, it->second, weighted ? weights[it - edges.begin()] : defaultEdgeWeight);
+		}
+	}
+	return builder.toGraph(true, true);
+}
+
+void RmatGenerator::generate(EdgeStreamWriter& writer, bool removeDuplicates) {
+	if (!removeDuplicates) {
+		// the same draws as for a weighted graph, written one by one
+		const count n = count(1) << scale;
+		std::vector<node> nodemap = drawNodeMap(n);
+		const count numEdges = numberOfDraws(n);
+		const uint64_t seed = Aux::Random::integer();
+		#pragma omp parallel for schedule(static, 4096)
+		for (index e = 0; e < numEdges; ++e) {
+			node u, v;
+			std::tie(u, v) = drawEdge(seed, e);
+			if (reduceNodes > 0) {
+				u = nodemap[u];
+				v = nodemap[v];
+				if (u == none || v == none || (!weighted && u == v)) {
+					continue;
 				}
 			}
+			writer.addEdge(std::min(u, v), std::max(u, v), defaultEdgeWeight);
 		}
+		return;
 	}
 
-	G.shrinkToFit();
-	return G;
+	std::vector<std::pair<node, node>> edges;
+	std::vector<edgeweight> weights;
+	sampleEdges(edges, weights);
+	#pragma omp parallel for
+	for (index i = 0; i < edges.size(); ++i) {
+		writer.addEdge(edges[i].first, edges[i].second, weighted ? weights[i] : defaultEdgeWeight);
+	}
 }
 
 } /* namespace NetworKit */
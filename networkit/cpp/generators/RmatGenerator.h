@@ -8,8 +8,12 @@
 #ifndef RMATGENERATOR_H_
 #define RMATGENERATOR_H_
 
+#include <utility>
+#include <vector>
+
 #include "StaticGraphGenerator.h"
 #include "../graph/Graph.h"
+#include "../io/EdgeStreamWriter.h"
 
 namespace NetworKit {
 
@@ -20,6 +24,9 @@ namespace NetworKit {
  * More details at http://www.graph500.org or in the original paper:
  * Deepayan Chakrabarti, Yiping Zhan, Christos Faloutsos:
  * R-MAT: A Recursive Model for Graph Mining. SDM 2004: 442-446.
+ *
+ * The i-th edge is drawn from its own random stream, so all edges are drawn in parallel and
+ * the result does not depend on the number of threads.
  */
 class RmatGenerator: public NetworKit::StaticGraphGenerator {
 protected:
@@ -30,6 +37,29 @@ protected:
 	bool weighted;
 	count reduceNodes;
 
+	/**
+	 * @return The @a e-th edge drawn with @a seed, before nodes are deleted.
+	 */
+	std::pair<node, node> drawEdge(uint64_t seed, index e) const;
+
+	/**
+	 * @return The number of edges to draw for a graph with @a n nodes before nodes are deleted.
+	 */
+	count numberOfDraws(count n) const;
+
+	/**
+	 * Chooses the reduceNodes nodes to delete from @a n nodes at random.
+	 * @return The new id of every node, none for deleted nodes, empty if no nodes are deleted.
+	 */
+	std::vector<node> drawNodeMap(count n) const;
+
+	/**
+	 * Draws the edges of the graph. The edges are stored with u <= v, sorted by u and v. If the
+	 * graph is weighted, @a weights receives the number of times each edge has been drawn.
+	 * @return The number of nodes of the graph.
+	 */
+	count sampleEdges(std::vector<std::pair<node, node>>& edges, std::vector<edgeweight>& weights);
+
 public:
 
 	/**
@@ -48,6 +78,17 @@ public:
 	 * @return Graph to be generated according to parameters specified in constructor.
 	 */
 	Graph generate() override;
+
+	/**
+	 * Writes the edges of an R-MAT graph to @a writer instead of building a Graph.
+	 *
+	 * If @a removeDuplicates is set, the same edges as by generate() are written, each once with its
+	 * weight. To remove the duplicates, all drawn edges are collected in memory first, so the memory
+	 * is not bounded. Otherwise, every drawn edge is written as soon as it is drawn with the default
+	 * weight, in bounded memory: the output is a multigraph with about n * edgeFactor edges, which
+	 * yields the weighted R-MAT graph if duplicates are merged by adding up their weights.
+	 */
+	void generate(EdgeStreamWriter& writer, bool removeDuplicates = true);
 };
 
 } /* namespace NetworKit */
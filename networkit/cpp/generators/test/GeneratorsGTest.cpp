@@ -10,8 +10,11 @@ Dy * GeneratorsTest.cpp
 
 #include "GeneratorsGTest.h"
 
+#include <cstring>
 #include <numeric>
 #include <cmath>
+#include <fstream>
+#include <omp.h>
 
 #include "../DynamicGraphSource.h"
 #include "../DynamicBarabasiAlbertGenerator.h"
@@ -41,6 +44,8 @@ Dy * GeneratorsTest.cpp
 #include "../../io/DotGraphWriter.h"
 #include "../../io/GraphIO.h"
 #include "../../io/METISGraphReader.h"
+#include "../../io/EdgeListReader.h"
+#include "../../io/EdgeStreamWriter.h"
 #include "../../community/Modularity.h"
 #include "../../dynamics/GraphUpdater.h"
 #include "../../auxiliary/MissingMath.h"
@@ -452,6 +457,176 @@ TEST_F(GeneratorsGTest, testErdosRenyiGenerator) {
 	EXPECT_TRUE(G.checkConsistency());
 }
 
+TEST_F(GeneratorsGTest, testParallelGeneratorsThreadIndependent) {
+	std::vector<count> sequence(1000);
+	for (index i = 0; i < sequence.size(); ++i) {
+		sequence[i] = 1 + (i * 7919) % 100;
+	}
+
+	auto generateWith = [&](int threads, int model) {
+		int maxThreads = omp_get_max_threads();
+		omp_set_num_threads(threads);
+		Aux::Random::setSeed(42, true);
+		Graph G;
+		if (model == 0) {
+			G = ErdosRenyiGenerator(1000, 0.01).generate();
+		} else if (model == 1) {
+			G = ErdosRenyiGenerator(1000, 0.01, true).generate();
+		} else if (model == 2) {
+			G = ChungLuGenerator(sequence).generate();
+		} else {
+			G = RmatGenerator(10, 8, 0.57, 0.19, 0.19, 0.05, model == 4).generate();
+		}
+		omp_set_num_threads(maxThreads);
+		return G;
+	};
+
+	for (int model = 0; model < 5; ++model) {
+		Graph G = generateWith(1, model);
+		Graph H = generateWith(4, model);
+		EXPECT_TRUE(G.checkConsistency());
+		ASSERT_EQ(G.numberOfNodes(), H.numberOfNodes());
+		ASSERT_EQ(G.numberOfEdges(), H.numberOfEdges());
+		G.forEdges([&](node u, node v, edgeweight w) {
+			EXPECT_TRUE(H.hasEdge(u, v));
+			EXPECT_EQ(w, H.weight(u, v));
+		});
+	}
+
+	// a directed G(n, p) graph has edges in both directions
+	Graph D = generateWith(4, 1);
+	count upward = 0;
+	D.forEdges([&](node u, node v) {
+		if (u < v) ++upward;
+	});
+	EXPECT_GT(upward, 0u);
+	EXPECT_LT(upward, D.numberOfEdges());
+
+	// R-MAT gives exactly the requested number of edges
+	EXPECT_EQ(1024u * 8u, generateWith(4, 3).numberOfEdges());
+}
+
+TEST_F(GeneratorsGTest, testGeneratorsToEdgeStream) {
+	std::string path = "output/generated.edgelist";
+	for (int model = 0; model < 3; ++model) {
+		Aux::Random::setSeed(7, false);
+		Graph G;
+		if (model == 0) {
+			G = ErdosRenyiGenerator(500, 0.02).generate();
+		} else if (model == 1) {
+			G = ChungLuGenerator(std::vector<count>(500, 10)).generate();
+		} else {
+			G = RmatGenerator(9, 4, 0.57, 0.19, 0.19, 0.05).generate();
+		}
+
+		Aux::Random::setSeed(7, false);
+		{
+			EdgeStreamWriter writer(path);
+			if (model == 0) {
+				ErdosRenyiGenerator(500, 0.02).generate(writer);
+			} else if (model == 1) {
+				ChungLuGenerator(std::vector<count>(500, 10)).generate(writer);
+			} else {
+				RmatGenerator(9, 4, 0.57, 0.19, 0.19, 0.05).generate(writer);
+			}
+			writer.close();
+			EXPECT_EQ(G.numberOfEdges(), writer.numberOfEdges());
+		}
+
+		Graph H = EdgeListReader(' ', 0).read(path);
+		EXPECT_EQ(G.numberOfEdges(), H.numberOfEdges());
+		H.forEdges([&](node u, node v) {
+			EXPECT_TRUE(G.hasEdge(u, v));
+		});
+	}
+
+	// binary format: two 64 bit ids per edge
+	Aux::Random::setSeed(7, false);
+	Graph G = ErdosRenyiGenerator(500, 0.02).generate();
+	Aux::Random::setSeed(7, false);
+	{
+		EdgeStreamWriter writer(path, EdgeStreamWriter::BINARY);
+		ErdosRenyiGenerator(500, 0.02).generate(writer);
+	}
+	// reads the next little-endian 64 bit word
+	auto readWord = [](std::ifstream& file, uint64_t& word) {
+		unsigned char bytes[8];
+		if (!file.read(reinterpret_cast<char*>(bytes), sizeof(bytes))) {
+			return false;
+		}
+		word = 0;
+		for (int i = 7; i >= 0; --i) {
+			word = (word << 8) | bytes[i];
+		}
+		return true;
+	};
+	std::ifstream file(path, std::ios::binary);
+	uint64_t u, v;
+	count edges = 0;
+	while (readWord(file, u) && readWord(file, v)) {
+		EXPECT_TRUE(G.hasEdge(u, v));
+		++edges;
+	}
+	EXPECT_EQ(G.numberOfEdges(), edges);
+	file.close();
+
+	// weights that have no short decimal representation are written exactly
+	const std::vector<edgeweight> weights = {1e-7, 0.1234567, 1.0 / 3.0, 12345.678901234567};
+	{
+		EdgeStreamWriter writer(path, EdgeStreamWriter::EDGELIST, true);
+		for (index i = 0; i < weights.size(); ++i) {
+			writer.addEdge(i, i + 1, weights[i]);
+		}
+		writer.close();
+	}
+	std::ifstream text(path);
+	edgeweight w;
+	for (index i = 0; i < weights.size(); ++i) {
+		ASSERT_TRUE(text >> u >> v >> w);
+		EXPECT_EQ(i, u);
+		EXPECT_EQ(weights[i], w);
+	}
+	{
+		EdgeStreamWriter writer(path, EdgeStreamWriter::BINARY, true);
+		writer.addEdge(1, 2, weights[0]);
+	}
+	file.open(path, std::ios::binary);
+	uint64_t bits;
+	ASSERT_TRUE(readWord(file, u) && readWord(file, v) && readWord(file, bits));
+	std::memcpy(&w, &bits, sizeof(w));
+	EXPECT_EQ(1u, u);
+	EXPECT_EQ(2u, v);
+	EXPECT_EQ(weights[0], w);
+}
+
+TEST_F(GeneratorsGTest, testRmatGeneratorStreamWithDuplicates) {
+	// merging the duplicates of the stream by adding up their weights yields the weighted graph
+	Aux::Random::setSeed(11, false);
+	Graph G = RmatGenerator(8, 6, 0.57, 0.19, 0.19, 0.05, true).generate();
+	Aux::Random::setSeed(11, false);
+	std::string path = "output/rmat-duplicates.edgelist";
+	{
+		EdgeStreamWriter writer(path);
+		RmatGenerator(8, 6, 0.57, 0.19, 0.19, 0.05, true).generate(writer, false);
+		writer.close();
+		EXPECT_EQ((count) (1 << 8) * 6, writer.numberOfEdges());
+	}
+	Graph H(G.upperNodeIdBound(), true);
+	std::ifstream file(path);
+	node u, v;
+	while (file >> u >> v) {
+		if (H.hasEdge(u, v)) {
+			H.increaseWeight(u, v, 1.0);
+		} else {
+			H.addEdge(u, v, 1.0);
+		}
+	}
+	EXPECT_EQ(G.numberOfEdges(), H.numberOfEdges());
+	G.forEdges([&](node u, node v, edgeweight w) {
+		EXPECT_EQ(w, H.weight(u, v));
+	});
+}
+
 TEST_F(GeneratorsGTest, testRmatGeneratorException) {
 	count scale = 9;
 	count edgeFactor = 12;
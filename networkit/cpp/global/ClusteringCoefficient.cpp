@@ -11,6 +11,7 @@
 #include "../centrality/LocalClusteringCoefficient.h"
 #include "../auxiliary/Random.h"
 #include "../auxiliary/Log.h"
+#include "../graph/StaticGraph.h"
 #include <omp.h>
 
 namespace NetworKit {
@@ -174,25 +175,28 @@ double ClusteringCoefficient::exactGlobal(Graph& G) {
 		nm.resize(z, false);
 	}
 
-	G.balancedParallelForNodes([&](node u){
+	// wedge checking touches the neighborhoods of all neighbors, use the contiguous CSR layout
+	StaticGraph S(G, false);
+
+	S.balancedParallelForNodes([&](node u){
 
 		size_t tid = omp_get_thread_num();
 		count tr = 0;
 
-		if (G.degree(u) > 1) {
-			G.forEdgesOf(u, [&](node u, node v) {
+		if (S.degree(u) > 1) {
+			S.forEdgesOf(u, [&](node u, node v) {
 				nodeMarker[tid][v] = true;
 			});
 
-			G.forEdgesOf(u, [&](node u, node v) {
-				G.forEdgesOf(v, [&](node v, node w) {
+			S.forEdgesOf(u, [&](node u, node v) {
+				S.forEdgesOf(v, [&](node v, node w) {
 					if (nodeMarker[tid][w]) {
 						tr += 1;
 					}
 				});
 			});
 
-			G.forEdgesOf(u, [&](node u, node v) {
+			S.forEdgesOf(u, [&](node u, node v) {
 				nodeMarker[tid][v] = false;
 			});
 		}
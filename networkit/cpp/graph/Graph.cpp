@@ -44,7 +44,8 @@ Graph::Graph(count n, bool weighted, bool directed) :
 	inEdgeWeights(weighted && directed ? n : 0),
 	outEdgeWeights(weighted ? n : 0),
 	inEdgeIds(),
-	outEdgeIds() {
+	outEdgeIds(),
+	lookupMinSlots(none) {
 
 	// set name from global id
 	id = getNextGraphId();
@@ -88,7 +89,8 @@ Graph::Graph(const Graph& G, bool weighted, bool directed) :
 	inEdges(0),
 	outEdges(0),
 	inEdgeWeights(0),
-	outEdgeWeights(0) {
+	outEdgeWeights(0),
+	lookupMinSlots(none) {
 
 	// set name from global id
 	id = getNextGraphId();
@@ -187,10 +189,34 @@ count Graph::getNextGraphId() {
 	return nextGraphId++;
 }
 
+/**
+ * Returns the first position of @a v in the adjacency array indexed by @a table, none if there is none.
+ */
+static index firstPosition(const std::unordered_multimap<node, index>& table, node v) {
+	index first = none;
+	auto range = table.equal_range(v);
+	for (auto it = range.first; it != range.second; ++it) {
+		first = std::min(first, it->second);
+	}
+	return first;
+}
+
+static void fillLookup(std::unordered_multimap<node, index>& table, const std::vector<node>& adjacency) {
+	table.reserve(adjacency.size());
+	for (index i = 0; i < adjacency.size(); ++i) {
+		if (adjacency[i] != none) {
+			table.emplace(adjacency[i], i);
+		}
+	}
+}
+
 index Graph::indexInInEdgeArray(node v, node u) const {
 	if (!directed) {
 		return indexInOutEdgeArray(v, u);
 	}
+	if (lookupMinSlots != none && inLookupSlot[v] != none) {
+		return firstPosition(inLookup[inLookupSlot[v]], u);
+	}
 	for (index i = 0; i < inEdges[v].size(); i++) {
 		node x = inEdges[v][i];
 		if (x == u) {
@@ -201,6 +227,9 @@ index Graph::indexInInEdgeArray(node v, node u) const {
 }
 
 index Graph::indexInOutEdgeArray(node u, node v) const {
+	if (lookupMinSlots != none && outLookupSlot[u] != none) {
+		return firstPosition(outLookup[outLookupSlot[u]], v);
+	}
 	for (index i = 0; i < outEdges[u].size(); i++) {
 		node x = outEdges[u][i];
 		if (x == v) {
@@ -210,6 +239,35 @@ index Graph::indexInOutEdgeArray(node u, node v) const {
 	return none;
 }
 
+void Graph::lookupInsert(bool incoming, node u, node v, index i) {
+	if (lookupMinSlots == none) return;
+	std::vector<index>& slots = incoming ? inLookupSlot : outLookupSlot;
+	std::vector< std::unordered_multimap<node, index> >& tables = incoming ? inLookup : outLookup;
+	const std::vector<node>& adjacency = incoming ? inEdges[u] : outEdges[u];
+	if (slots[u] != none) {
+		tables[slots[u]].emplace(v, i);
+	} else if (adjacency.size() >= lookupMinSlots) {
+		// u has just become large enough, the new table includes position i
+		slots[u] = tables.size();
+		tables.emplace_back();
+		fillLookup(tables.back(), adjacency);
+	}
+}
+
+void Graph::lookupErase(bool incoming, node u, node v, index i) {
+	if (lookupMinSlots == none) return;
+	const std::vector<index>& slots = incoming ? inLookupSlot : outLookupSlot;
+	if (slots[u] == none) return;
+	std::unordered_multimap<node, index>& table = (incoming ? inLookup : outLookup)[slots[u]];
+	auto range = table.equal_range(v);
+	for (auto it = range.first; it != range.second; ++it) {
+		if (it->second == i) {
+			table.erase(it);
+			return;
+		}
+	}
+}
+
 
 /** EDGE IDS **/
 
@@ -285,6 +343,46 @@ edgeid Graph::edgeId(node u, node v) const {
 }
 
 
+/** EDGE LOOKUP **/
+
+void Graph::indexEdgeLookup(count minSlots) {
+	lookupMinSlots = std::max<count>(minSlots, 1);
+	outLookupSlot.assign(z, none);
+	inLookupSlot.assign(directed ? z : 0, none);
+	outLookup.clear();
+	inLookup.clear();
+	for (node u = 0; u < z; ++u) {
+		if (outEdges[u].size() >= lookupMinSlots) {
+			outLookupSlot[u] = outLookup.size();
+			outLookup.emplace_back();
+		}
+		if (directed && inEdges[u].size() >= lookupMinSlots) {
+			inLookupSlot[u] = inLookup.size();
+			inLookup.emplace_back();
+		}
+	}
+
+	// every table belongs to a single node
+	#pragma omp parallel for schedule(guided)
+	for (node u = 0; u < z; ++u) {
+		if (outLookupSlot[u] != none) {
+			fillLookup(outLookup[outLookupSlot[u]], outEdges[u]);
+		}
+		if (directed && inLookupSlot[u] != none) {
+			fillLookup(inLookup[inLookupSlot[u]], inEdges[u]);
+		}
+	}
+}
+
+void Graph::removeEdgeLookup() {
+	lookupMinSlots = none;
+	std::vector<index>().swap(outLookupSlot);
+	std::vector<index>().swap(inLookupSlot);
+	std::vector< std::unordered_multimap<node, index> >().swap(outLookup);
+	std::vector< std::unordered_multimap<node, index> >().swap(inLookup);
+}
+
+
 /** GRAPH INFORMATION **/
 
 std::string Graph::typ() const {
@@ -299,28 +397,28 @@ void Graph::shrinkToFit() {
 	exists.shrink_to_fit();
 
 	inEdgeWeights.shrink_to_fit();
-	for (auto& w : inEdgeWeights) {
-		w.shrink_to_fit();
-	}
-
 	outEdgeWeights.shrink_to_fit();
-	for (auto& w : outEdgeWeights) {
-		w.shrink_to_fit();
-	}
 
 	inDeg.shrink_to_fit();
 	outDeg.shrink_to_fit();
 
 	inEdges.shrink_to_fit();
-	for (auto& a : inEdges) {
-		a.shrink_to_fit();
-	}
-
 	outEdges.shrink_to_fit();
-	for (auto& a : outEdges) {
-		a.shrink_to_fit();
-	}
 
+	// the adjacency arrays of different nodes are independent
+	#pragma omp parallel for schedule(dynamic, 1000)
+	for (node u = 0; u < outEdges.size(); ++u) {
+		if (u < inEdgeWeights.size()) {
+			inEdgeWeights[u].shrink_to_fit();
+		}
+		if (u < outEdgeWeights.size()) {
+			outEdgeWeights[u].shrink_to_fit();
+		}
+		if (u < inEdges.size()) {
+			inEdges[u].shrink_to_fit();
+		}
+		outEdges[u].shrink_to_fit();
+	}
 }
 
 void Graph::compactEdges() {
@@ -376,6 +474,11 @@ void Graph::compactEdges() {
 
 		}
 	});
+
+	// the positions of the remaining edges have changed
+	if (hasEdgeLookup()) {
+		indexEdgeLookup(lookupMinSlots);
+	}
 }
 
 void Graph::sortEdges() {
@@ -447,6 +550,10 @@ void Graph::sortEdges() {
 		inEdgeWeights.swap(targetWeight);
 		inEdgeIds.swap(targetEdgeIds);
 	}
+
+	if (hasEdgeLookup()) {
+		indexEdgeLookup(lookupMinSlots);
+	}
 }
 
 
@@ -495,6 +602,20 @@ node Graph::addNode() {
 		inEdges.push_back(std::vector<node>{});
 	}
 
+	if (edgesIndexed) {
+		outEdgeIds.push_back(std::vector<edgeid>{});
+		if (directed) {
+			inEdgeIds.push_back(std::vector<edgeid>{});
+		}
+	}
+
+	if (hasEdgeLookup()) {
+		outLookupSlot.push_back(none);
+		if (directed) {
+			inLookupSlot.push_back(none);
+		}
+	}
+
 
 	return v;
 }
@@ -618,7 +739,7 @@ void Graph::addEdge(node u, node v, edgeweight ew) {
 		inEdges[v].push_back(u);
 
 		if (edgesIndexed) {
-			inEdgeIds[v].push_back(id);
+			inEdgeIds[v].push_back(omega - 1);
 		}
 
 		if (weighted) {
@@ -648,6 +769,13 @@ void Graph::addEdge(node u, node v, edgeweight ew) {
 	if (u == v) { //count self loop
 		storedNumberOfSelfLoops++;
 	}
+
+	lookupInsert(false, u, v, outEdges[u].size() - 1);
+	if (directed) {
+		lookupInsert(true, v, u, inEdges[v].size() - 1);
+	} else if (u != v) {
+		lookupInsert(false, v, u, outEdges[v].size() - 1);
+	}
 }
 
 void Graph::removeEdge(node u, node v) {
@@ -668,6 +796,7 @@ void Graph::removeEdge(node u, node v) {
 	m--; // decrease number of edges
 	outDeg[u]--;
 	outEdges[u][vi] = none;
+	lookupErase(false, u, v, vi);
 	if (weighted) {
 		outEdgeWeights[u][vi] = nullWeight;
 	}
@@ -677,6 +806,7 @@ void Graph::removeEdge(node u, node v) {
 
 		inDeg[v]--;
 		inEdges[v][ui] = none;
+		lookupErase(true, v, u, ui);
 		if (weighted) {
 			inEdgeWeights[v][ui] = nullWeight;
 		}
@@ -684,6 +814,7 @@ void Graph::removeEdge(node u, node v) {
 		// undirected, not self-loop
 		outDeg[v]--;
 		outEdges[v][ui] = none;
+		lookupErase(false, v, u, ui);
 		if (weighted) {
 			outEdgeWeights[v][ui] = nullWeight;
 		}
@@ -717,10 +848,21 @@ void Graph::swapEdge(node s1, node t1, node s2, node t2) {
 	if (s2t2 == none) throw std::runtime_error("The second edge does not exist");
 	index t2s2 = indexInInEdgeArray(t2, s2);
 
-	std::swap(outEdges[s1][s1t1], outEdges[s2][s2t2]);
+	// swaps two adjacency array entries and keeps the edge lookup in sync
+	auto swapTargets = [&](bool incoming, node a, index i, node b, index j) {
+		std::vector< std::vector<node> >& edges = incoming ? inEdges : outEdges;
+		if (a == b && i == j) return;
+		lookupErase(incoming, a, edges[a][i], i);
+		lookupErase(incoming, b, edges[b][j], j);
+		std::swap(edges[a][i], edges[b][j]);
+		lookupInsert(incoming, a, edges[a][i], i);
+		lookupInsert(incoming, b, edges[b][j], j);
+	};
+
+	swapTargets(false, s1, s1t1, s2, s2t2);
 
 	if (directed) {
-		std::swap(inEdges[t1][t1s1], inEdges[t2][t2s2]);
+		swapTargets(true, t1, t1s1, t2, t2s2);
 
 		if (weighted) {
 			std::swap(inEdgeWeights[t1][t1s1], inEdgeWeights[t2][t2s2]);
@@ -730,7 +872,7 @@ void Graph::swapEdge(node s1, node t1, node s2, node t2) {
 			std::swap(inEdgeIds[t1][t1s1], inEdgeIds[t2][t2s2]);
 		}
 	} else {
-		std::swap(outEdges[t1][t1s1], outEdges[t2][t2s2]);
+		swapTargets(false, t1, t1s1, t2, t2s2);
 
 		if (weighted) {
 			std::swap(outEdgeWeights[t1][t1s1], outEdgeWeights[t2][t2s2]);
@@ -16,6 +16,7 @@
 #include <stdexcept>
 #include <functional>
 #include <unordered_set>
+#include <unordered_map>
 
 #include "../Globals.h"
 #include "Coordinates.h"
@@ -114,6 +115,13 @@ private:
 	std::vector< std::vector<edgeid> > inEdgeIds; //!< only used for directed graphs, same schema as inEdges
 	std::vector< std::vector<edgeid> > outEdgeIds; //!< same schema (and same order!) as outEdges
 
+	// edge lookup, hash tables for the adjacency arrays of high degree nodes
+	count lookupMinSlots; //!< adjacency arrays with at least this many slots get a lookup table, none if there is no edge lookup
+	std::vector<index> outLookupSlot; //!< position of the table of outEdges[u] in outLookup, none if outEdges[u] is scanned
+	std::vector<index> inLookupSlot; //!< only used for directed graphs, same schema as outLookupSlot
+	std::vector< std::unordered_multimap<node, index> > outLookup; //!< maps every neighbor to its positions in the adjacency array
+	std::vector< std::unordered_multimap<node, index> > inLookup; //!< only used for directed graphs, same schema as outLookup
+
 	/**
 	 * Returns the next unique graph id.
 	 */
@@ -129,6 +137,17 @@ private:
 	 */
 	index indexInOutEdgeArray(node u, node v) const;
 
+	/**
+	 * Records that node v has been stored at position i of the adjacency array of u,
+	 * the array of incoming edges if @a incoming is set. No-op without edge lookup.
+	 */
+	void lookupInsert(bool incoming, node u, node v, index i);
+
+	/**
+	 * Records that node v is no longer stored at position i of the adjacency array of u.
+	 */
+	void lookupErase(bool incoming, node u, node v, index i);
+
 	/**
 	 * Returns the edge weight of the outgoing edge of index i in the outgoing edges of node u
 	 * @param u The node
@@ -421,6 +440,31 @@ public:
 	index upperEdgeIdBound() const { return omega; }
 
 
+	/** EDGE LOOKUP **/
+
+	/**
+	 * Builds hash tables that map the neighbors of a node to their positions in its adjacency
+	 * arrays, for all nodes with at least @a minSlots slots in an adjacency array (deleted edges
+	 * included). Afterwards hasEdge, edgeId, weight, setWeight and removeEdge take expected
+	 * constant time instead of time linear in the degree. The tables are kept up to date by all
+	 * modifiers, nodes get a table as soon as they reach @a minSlots slots. Copies of the graph
+	 * keep the edge lookup, conversions between graph types do not.
+	 *
+	 * @param minSlots Smaller adjacency arrays are scanned, which is faster for a few entries.
+	 */
+	void indexEdgeLookup(count minSlots = 32);
+
+	/**
+	 * Checks if the edge lookup has been built.
+	 */
+	bool hasEdgeLookup() const { return lookupMinSlots != none; }
+
+	/**
+	 * Removes the edge lookup and frees its memory.
+	 */
+	void removeEdgeLookup();
+
+
 	/** GRAPH INFORMATION **/
 
 	/**
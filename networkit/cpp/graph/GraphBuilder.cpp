@@ -6,6 +6,7 @@
  */
 
 #include <stdexcept>
+#include <algorithm>
 #include <omp.h>
 
 #include "GraphBuilder.h"
@@ -202,97 +203,100 @@ void GraphBuilder::toGraphDirectSwap(Graph& G) {
 
 void GraphBuilder::toGraphParallel(Graph& G) {
 	// basic idea of the parallelization:
-	// 1) each threads collects its own data
-	// 2) each node collects all its data from all threads
+	// 1) count the missing half edges of each node and allocate its final adjacency array once
+	// 2) scatter the missing half edges to their free positions
+	// 3) sort them by their source node, which is the order in which toGraphSequential adds them
 
-	int maxThreads = omp_get_max_threads();
-
-	using Adjacencylists = std::vector< std::vector<node> >;
-	using Weightlists = std::vector< std::vector<edgeweight> >;
+	std::vector<count> missingEdgesCounts(n, 0);
+	count numberOfSelfLoops = 0;
 
-	std::vector<Adjacencylists> inEdgesPerThread(maxThreads, Adjacencylists(n));
-	std::vector<Weightlists> inWeightsPerThread(weighted ? maxThreads : 0, Weightlists(n));
-	std::vector<count> numberOfSelfLoopsPerThread(maxThreads, 0);
+	// 'first' half of the edges
+	G.outEdges.swap(outEdges);
+	G.outEdgeWeights.swap(outEdgeWeights);
 
 	// step 1
-	parallelForNodes([&](node v) {
-		int tid = omp_get_thread_num();
-		for (index i = 0; i < outEdges[v].size(); i++) {
-			node u = outEdges[v][i];
+	#pragma omp parallel for schedule(dynamic, 100) reduction(+:numberOfSelfLoops)
+	for (node v = 0; v < n; v++) {
+		G.outDeg[v] = G.outEdges[v].size();
+		for (node u : G.outEdges[v]) {
 			if (directed || u != v) { // self loops don't need to be added twice in undirected graphs
-				inEdgesPerThread[tid][u].push_back(v);
-				if (weighted) {
-					edgeweight ew = outEdgeWeights[v][i];
-					inWeightsPerThread[tid][u].push_back(ew);
-				}
+				#pragma omp atomic
+				missingEdgesCounts[u]++;
 			}
 			if (u == v) {
-				numberOfSelfLoopsPerThread[tid]++;
+				numberOfSelfLoops++;
 			}
 		}
-	});
-
-	// we have already half of the edges
-	G.outEdges.swap(outEdges);
-	G.outEdgeWeights.swap(outEdgeWeights);
-
-	// step 2
-	parallelForNodes([&](node v) {
-		count inDeg = 0;
-		count outDeg = G.outEdges[v].size();
-		for (int tid = 0; tid < maxThreads; tid++) {
-			inDeg += inEdgesPerThread[tid][v].size();
-		}
+	}
 
-		assert(inDeg <= n);
-		assert(outDeg <= n);
-		// allocate enough memory for all edges/weights
+	// directed: the missing half edges are the inEdges, undirected: they are appended to outEdges
+	std::vector< std::vector<node> >& halfEdges = directed ? G.inEdges : G.outEdges;
+	std::vector< std::vector<edgeweight> >& halfEdgeWeights = directed ? G.inEdgeWeights : G.outEdgeWeights;
+	std::vector<index> position(n);
+	#pragma omp parallel for schedule(dynamic, 100)
+	for (node u = 0; u < n; u++) {
+		position[u] = directed ? 0 : G.outDeg[u];
+		const count size = position[u] + missingEdgesCounts[u];
 		if (directed) {
-			G.inEdges[v].reserve(inDeg);
-			if (weighted) {
-				G.inEdgeWeights[v].reserve(inDeg);
-			}
-		} else {
-			G.outEdges[v].reserve(outDeg + inDeg);
-			if (weighted) {
-				G.outEdgeWeights[v].reserve(outDeg + inDeg);
+			G.outEdges[u].shrink_to_fit();
+		}
+		// reserve the exact amount of space needed
+		halfEdges[u].reserve(size);
+		halfEdges[u].resize(size);
+		if (weighted) {
+			if (directed) {
+				G.outEdgeWeights[u].shrink_to_fit();
 			}
+			halfEdgeWeights[u].reserve(size);
+			halfEdgeWeights[u].resize(size);
 		}
+	}
 
-		// collect 'second' half of the edges
-		if (directed) {
-			G.inDeg[v] = inDeg;
-			G.outDeg[v] = outDeg;
-			for (int tid = 0; tid < maxThreads; tid++) {
-				copyAndClear(inEdgesPerThread[tid][v], G.inEdges[v]);
-			}
-			assert(G.inDeg[v] == G.inEdges[v].size());
-			if (weighted) {
-				for (int tid = 0; tid < maxThreads; tid++) {
-					copyAndClear(inWeightsPerThread[tid][v], G.inEdgeWeights[v]);
+	// step 2, only the first G.outDeg[v] entries of a node are read, the appended ones are written
+	#pragma omp parallel for schedule(dynamic, 100)
+	for (node v = 0; v < n; v++) {
+		for (index i = 0; i < G.outDeg[v]; i++) {
+			node u = G.outEdges[v][i];
+			if (directed || u != v) {
+				index pos;
+				#pragma omp atomic capture
+				pos = position[u]++;
+				halfEdges[u][pos] = v;
+				if (weighted) {
+					halfEdgeWeights[u][pos] = G.outEdgeWeights[v][i];
 				}
-				assert(G.inDeg[v] == G.inEdgeWeights[v].size());
 			}
+		}
+	}
 
-		} else {
-			G.outDeg[v] = inDeg + outDeg;
-			assert(G.outDeg[v] <= n);
-			for (int tid = 0; tid < maxThreads; tid++) {
-				copyAndClear(inEdgesPerThread[tid][v], G.outEdges[v]);
+	// step 3, in a multigraph a node may have several half edges from the same source node. These are
+	// scattered by one thread in the order of the source's adjacency, so a stable sort by source keeps
+	// them in that order, like toGraphSequential. Sorting by weight as well would reorder them.
+	#pragma omp parallel
+	{
+		std::vector< std::pair<node, edgeweight> > buffer;
+		#pragma omp for schedule(dynamic, 100)
+		for (node u = 0; u < n; u++) {
+			const index first = directed ? 0 : G.outDeg[u];
+			if (!weighted) {
+				std::sort(halfEdges[u].begin() + first, halfEdges[u].end());
+				continue;
 			}
-			assert(G.outDeg[v] == G.outEdges[v].size());
-			if (weighted) {
-				for (int tid = 0; tid < maxThreads; tid++) {
-					copyAndClear(inWeightsPerThread[tid][v], G.outEdgeWeights[v]);
-				}
+			buffer.clear();
+			for (index i = first; i < halfEdges[u].size(); i++) {
+				buffer.emplace_back(halfEdges[u][i], halfEdgeWeights[u][i]);
+			}
+			std::stable_sort(buffer.begin(), buffer.end(), [](const std::pair<node, edgeweight>& x, const std::pair<node, edgeweight>& y) {
+				return x.first < y.first;
+			});
+			for (index i = first; i < halfEdges[u].size(); i++) {
+				halfEdges[u][i] = buffer[i - first].first;
+				halfEdgeWeights[u][i] = buffer[i - first].second;
 			}
 		}
-	});
-	count numSelfLoops = 0;
-	#pragma omp parallel for reduction(+:numSelfLoops)
-	for (int i = 0; i < maxThreads; ++i)
-		numSelfLoops += numberOfSelfLoopsPerThread[i];
-	G.storedNumberOfSelfLoops = numSelfLoops;
+	}
+
+	G.storedNumberOfSelfLoops = numberOfSelfLoops;
 }
 
 void GraphBuilder::toGraphSequential(Graph &G) {
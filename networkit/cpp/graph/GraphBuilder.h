@@ -21,7 +21,7 @@ namespace NetworKit {
  * As adding the first half edge of an edge u -> v only requires access to the adjacent array of u, other threads can add edges a -> b as long as a != u. Some goes for the methods setWeight and increaseWeight. Note: If you add the first half edge of u -> v, you can change the weight by calling setWeight(u, v, ew) or increaseWeight(u, v, ew), but calling setWeight(v, u, ew) or increaseWeight(v, u, ew) will add the second half edge.
  * GraphBuilder allows you to be lazy and only add one half of each edge. Calling toGraph with autoCompleteEdges set to true, will make each half Edge in GraphBuilder to one full edge in Graph.
  *
- * So far I didn't came up with a good parallelization for toGraph, so at some point I might omit the parallel parameter for toGraph.
+ * With parallel set to true, toGraph completes the half edges in parallel and produces exactly the same graph as the sequential path, including the order of the adjacency arrays.
  */
 
 class GraphBuilder {
@@ -174,9 +174,6 @@ private:
 	void toGraphDirectSwap(Graph &G);
 	void toGraphSequential(Graph &G);
 	void toGraphParallel(Graph &G);
-
-	template <typename T>
-	static void copyAndClear(std::vector<T>& source, std::vector<T>& target);
 	
 	void setDegrees(Graph& G);
 	count numberOfEdges(const Graph& G);
@@ -216,12 +213,6 @@ void GraphBuilder::parallelForNodePairs(L handle) const {
 	}
 }
 
-template <typename T>
-void GraphBuilder::copyAndClear(std::vector<T>& source, std::vector<T>& target) {
-	std::copy(source.begin(), source.end(), std::back_inserter(target));
-	source.clear();
-}
-
 } /* namespace NetworKit */
 
 #endif /* GRAPH_BUILDER_H */
@@ -7,7 +7,10 @@
 
 #include "KruskalMSF.h"
 #include "SpanningForest.h"
-#include "../structures/UnionFind.h"
+#include <algorithm>
+
+#include "../structures/ConcurrentUnionFind.h"
+#include "../auxiliary/Log.h"
 #include "../auxiliary/Parallel.h"
 
 namespace NetworKit {
@@ -35,6 +38,8 @@ struct MyEdge {
 };
 
 
+const count KruskalMSF::filterChunkSize = 1 << 16;
+
 NetworKit::KruskalMSF::KruskalMSF(const Graph& G): SpanningForest(G) {
 
 }
@@ -43,7 +48,7 @@ void NetworKit::KruskalMSF::run() {
 	if (true || G.isWeighted()) { // FIXME: remove true when SpanningForest is fixed!
 		count z = G.upperNodeIdBound();
 		forest = G.copyNodes();
-		UnionFind uf(z);
+		ConcurrentUnionFind uf(z);
 
 		// sort edges in decreasing weight order
 		std::vector<MyEdge> sortedEdges; // (m);
@@ -54,20 +59,37 @@ void NetworKit::KruskalMSF::run() {
 		});
 		Aux::Parallel::sort(sortedEdges.begin(), sortedEdges.end());
 
-		// process in decreasing weight order
-		for (auto e: sortedEdges) {
-			node u = e.from;
-			node v = e.to;
-			INFO("process edge (", u, ", ", v, ") with weight ", e.weight);
-			assert(u < z);
-			assert(v < z);
-			assert(u >= 0);
-			assert(v >= 0);
-
-			// if edge does not close cycle, add it to tree
-			if (uf.find(u) != uf.find(v)) {
-				forest.addEdge(u, v);
-				uf.merge(u, v);
+		// process in decreasing weight order, chunk by chunk (Filter-Kruskal style):
+		// edges within an already connected part are filtered out in parallel,
+		// only the remaining ones have to pass the sequential union step
+		const count maxForestEdges = G.numberOfNodes() - (G.numberOfNodes() > 0 ? 1 : 0);
+		count forestEdges = 0;
+		std::vector<char> closesCycle; // not vector<bool>, which cannot be written concurrently
+		for (index first = 0; first < sortedEdges.size() && forestEdges < maxForestEdges; first += filterChunkSize) {
+			const index last = std::min(first + filterChunkSize, (index) sortedEdges.size());
+			closesCycle.assign(last - first, false);
+			if (first > 0) {
+				#pragma omp parallel for schedule(guided)
+				for (index i = first; i < last; ++i) {
+					closesCycle[i - first] = uf.find(sortedEdges[i].from) == uf.find(sortedEdges[i].to);
+				}
+			}
+
+			for (index i = first; i < last; ++i) {
+				if (closesCycle[i - first]) {
+					continue;
+				}
+				node u = sortedEdges[i].from;
+				node v = sortedEdges[i].to;
+				TRACE("process edge (", u, ", ", v, ") with weight ", sortedEdges[i].weight);
+				assert(u < z);
+				assert(v < z);
+
+				// if edge does not close cycle, add it to tree
+				if (uf.merge(u, v)) {
+					forest.addEdge(u, v);
+					++forestEdges;
+				}
 			}
 		}
 	}
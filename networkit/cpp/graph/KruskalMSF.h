@@ -28,8 +28,13 @@ public:
 	 * (or simply a spanning tree in unweighted graphs).
 	 * Uses Kruskal's algorithm.
 	 * Time complexity: sort(n) + n * inverse Ackermann(n, m).
+	 * Edges are processed in chunks, the edges of a chunk that would close a cycle are
+	 * filtered out in parallel before the sequential union step.
 	 */
 	virtual void run() override;
+
+private:
+	static const count filterChunkSize;
 };
 
 } /* namespace NetworKit */
@@ -0,0 +1,129 @@
+/*
+ * StaticGraph.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include "StaticGraph.h"
+
+namespace NetworKit {
+
+/**
+ * Fills CSR arrays from the outgoing (or, if @a incoming is set, the incoming) adjacency
+ * of @a G. The order of the neighbors is preserved.
+ */
+static void buildCSR(const Graph& G, bool incoming, StaticArray<index>& offsets, StaticArray<node>& targets,
+		StaticArray<edgeweight>& weights, StaticArray<edgeid>& ids) {
+	const count z = G.upperNodeIdBound();
+	const bool weighted = G.isWeighted();
+	const bool indexed = G.hasEdgeIds();
+	offsets.assign(z + 1, 0);
+	G.parallelForNodes([&](node u) {
+		offsets[u + 1] = incoming ? G.degreeIn(u) : G.degreeOut(u);
+	});
+	for (index u = 0; u < z; ++u) {
+		offsets[u + 1] += offsets[u];
+	}
+
+	const count entries = offsets[z];
+	targets.resize(entries);
+	if (weighted) {
+		weights.resize(entries);
+	}
+	if (indexed) {
+		ids.resize(entries);
+	}
+
+	G.balancedParallelForNodes([&](node u) {
+		index i = offsets[u];
+		auto store = [&](node, node v, edgeweight w, edgeid eid) {
+			targets[i] = v;
+			if (weighted) {
+				weights[i] = w;
+			}
+			if (indexed) {
+				ids[i] = eid;
+			}
+			++i;
+		};
+		if (incoming) {
+			G.forInEdgesOf(u, store);
+		} else {
+			G.forEdgesOf(u, store);
+		}
+		assert(i == offsets[u + 1]);
+	});
+}
+
+StaticGraph::StaticGraph(const Graph& G, bool storeInEdges) :
+	n(G.numberOfNodes()),
+	m(G.numberOfEdges()),
+	z(G.upperNodeIdBound()),
+	omega(G.hasEdgeIds() ? G.upperEdgeIdBound() : 0),
+	weighted(G.isWeighted()),
+	directed(G.isDirected()),
+	edgesIndexed(G.hasEdgeIds()) {
+
+	existsBits.assign((z + 63) / 64, 0);
+	G.forNodes([&](node u) {
+		existsBits[u / 64] |= uint64_t(1) << (u % 64);
+	});
+
+	buildCSR(G, false, outOffsets, outTargets, outWeights, outEdgeIds);
+	if (directed && storeInEdges) {
+		buildCSR(G, true, inOffsets, inTargets, inWeights, inEdgeIds);
+	}
+}
+
+edgeweight StaticGraph::weightedDegree(node v) const {
+	if (!weighted) {
+		return defaultEdgeWeight * degree(v);
+	}
+	edgeweight sum = 0.0;
+	for (index i = outOffsets[v]; i < outOffsets[v + 1]; ++i) {
+		sum += outWeights[i];
+	}
+	return sum;
+}
+
+bool StaticGraph::hasEdge(node u, node v) const {
+	if (!hasNode(u)) {
+		return false;
+	}
+	for (index i = outOffsets[u]; i < outOffsets[u + 1]; ++i) {
+		if (outTargets[i] == v) {
+			return true;
+		}
+	}
+	return false;
+}
+
+edgeweight StaticGraph::weight(node u, node v) const {
+	for (index i = outOffsets[u]; i < outOffsets[u + 1]; ++i) {
+		if (outTargets[i] == v) {
+			return weighted ? outWeights[i] : defaultEdgeWeight;
+		}
+	}
+	return nullWeight;
+}
+
+edgeweight StaticGraph::totalEdgeWeight() const {
+	if (!weighted) {
+		return m * defaultEdgeWeight;
+	}
+	return parallelSumForEdges([&](node, node, edgeweight w) {
+		return w;
+	});
+}
+
+count StaticGraph::memoryUsage() const {
+	count bytes = (outOffsets.size() + inOffsets.size()) * sizeof(index);
+	bytes += (outTargets.size() + inTargets.size()) * sizeof(node);
+	bytes += (outWeights.size() + inWeights.size()) * sizeof(edgeweight);
+	bytes += (outEdgeIds.size() + inEdgeIds.size()) * sizeof(edgeid);
+	bytes += existsBits.size() * sizeof(uint64_t);
+	return bytes;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,540 @@
+/*
+ * StaticGraph.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef STATICGRAPH_H_
+#define STATICGRAPH_H_
+
+#include <vector>
+#include <memory>
+#include <type_traits>
+
+#include "Graph.h"
+#include "../Globals.h"
+#include "../auxiliary/FunctionTraits.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Contiguous array used by StaticGraph. It either owns its elements in a std::vector or
+ * refers to memory that is owned elsewhere, e.g. a memory-mapped file.
+ */
+template<class T>
+class StaticArray final {
+
+public:
+	StaticArray() = default;
+
+	StaticArray(const StaticArray& other) : owned(other.owned), ptr(other.own ? owned.data() : other.ptr), len(other.len), own(other.own) {
+	}
+
+	StaticArray(StaticArray&& other) = default;
+
+	StaticArray& operator=(const StaticArray& other) {
+		owned = other.owned;
+		ptr = other.own ? owned.data() : other.ptr;
+		len = other.len;
+		own = other.own;
+		return *this;
+	}
+
+	StaticArray& operator=(StaticArray&& other) = default;
+
+	/** Replaces the content with @a n copies of @a value. */
+	void assign(count n, const T& value) {
+		owned.assign(n, value);
+		sync();
+	}
+
+	/** Resizes the owned storage to @a n elements. */
+	void resize(count n) {
+		owned.resize(n);
+		sync();
+	}
+
+	/** Refers to @a n elements at @a data without copying them. */
+	void view(const T* data, count n) {
+		std::vector<T>().swap(owned);
+		ptr = data;
+		len = n;
+		own = false;
+	}
+
+	/**
+	 * Write access. A view is first copied into owned storage, so the first write access to a view
+	 * must not happen concurrently with other accesses.
+	 */
+	T& operator[](index i) {
+		if (!own) {
+			owned.assign(ptr, ptr + len);
+			sync();
+		}
+		return owned[i];
+	}
+
+	const T& operator[](index i) const { return ptr[i]; }
+
+	count size() const { return len; }
+	bool empty() const { return len == 0; }
+	const T* data() const { return ptr; }
+	const T* begin() const { return ptr; }
+	const T* end() const { return ptr + len; }
+
+private:
+	std::vector<T> owned;
+	const T* ptr = nullptr;
+	count len = 0;
+	bool own = true;
+
+	void sync() {
+		ptr = owned.data();
+		len = owned.size();
+		own = true;
+	}
+};
+
+/**
+ * @ingroup graph
+ * An immutable snapshot of a Graph in compressed sparse row (CSR) format.
+ *
+ * The adjacency of all nodes is stored in one contiguous array of targets (plus parallel
+ * arrays for weights and edge ids if present) which is addressed by an array of offsets.
+ * This avoids one heap allocation per node and the pointer chasing of the adjacency vectors
+ * in Graph. The snapshot offers the same lambda-based iterators as Graph (forNodes, forEdges,
+ * forNeighborsOf, ...), so read-only algorithms can be run on it without modification of
+ * their inner loops. Node ids, edge ids and the order of neighbors are the same as in the
+ * graph the snapshot was created from. Later changes of that graph are not reflected.
+ */
+class StaticGraph final {
+
+public:
+
+	/**
+	 * Creates a CSR snapshot of @a G.
+	 *
+	 * @param G The graph.
+	 * @param storeInEdges For directed graphs, also store the incoming edges (needed by forInEdgesOf).
+	 */
+	StaticGraph(const Graph& G, bool storeInEdges = true);
+
+	/** Default constructor, creates an empty snapshot. */
+	StaticGraph() = default;
+
+	/* GRAPH INFORMATION */
+
+	/**
+	 * Returns the number of nodes.
+	 */
+	count numberOfNodes() const { return n; }
+
+	/**
+	 * Returns the number of edges.
+	 */
+	count numberOfEdges() const { return m; }
+
+	/**
+	 * Returns the upper bound of node ids, i.e. the upper bound of the graph the snapshot was created from.
+	 */
+	index upperNodeIdBound() const { return z; }
+
+	/**
+	 * Returns the upper bound of edge ids of the graph the snapshot was created from.
+	 */
+	index upperEdgeIdBound() const { return omega; }
+
+	bool isWeighted() const { return weighted; }
+	bool isDirected() const { return directed; }
+	bool hasEdgeIds() const { return edgesIndexed; }
+	bool hasInEdges() const { return !directed || !inOffsets.empty(); }
+
+	/**
+	 * Returns true if node @a v exists.
+	 */
+	bool hasNode(node v) const { return (v < z) && ((existsBits[v / 64] >> (v % 64)) & 1); }
+
+	/**
+	 * Returns the (outgoing) degree of @a v.
+	 */
+	count degree(node v) const { return outOffsets[v + 1] - outOffsets[v]; }
+	count degreeOut(node v) const { return degree(v); }
+
+	/**
+	 * Returns the number of incoming edges of @a v (equal to degree for undirected graphs).
+	 */
+	count degreeIn(node v) const { return directed ? inOffsets[v + 1] - inOffsets[v] : degree(v); }
+
+	/**
+	 * Returns the sum of the weights of the outgoing edges of @a v.
+	 */
+	edgeweight weightedDegree(node v) const;
+
+	/**
+	 * Returns true if the edge (u, v) exists. Takes time linear in the degree of @a u.
+	 */
+	bool hasEdge(node u, node v) const;
+
+	/**
+	 * Returns the weight of edge (u, v) or nullWeight if the edge does not exist.
+	 */
+	edgeweight weight(node u, node v) const;
+
+	/**
+	 * Returns the total edge weight.
+	 */
+	edgeweight totalEdgeWeight() const;
+
+	/**
+	 * Returns the offset of the first outgoing edge of @a u in the target array.
+	 * Together with getOutOffset(u + 1) this delimits the neighborhood of @a u.
+	 */
+	index getOutOffset(node u) const { return outOffsets[u]; }
+
+	/**
+	 * Returns the contiguous array of edge targets.
+	 */
+	const StaticArray<node>& getOutTargets() const { return outTargets; }
+
+	/**
+	 * Returns the memory used by the adjacency structure in bytes.
+	 */
+	count memoryUsage() const;
+
+	/* NODE ITERATORS */
+
+	template<typename L> void forNodes(L handle) const;
+	template<typename L> void parallelForNodes(L handle) const;
+	template<typename L> void balancedParallelForNodes(L handle) const;
+	template<typename L> double parallelSumForNodes(L handle) const;
+
+	/* EDGE ITERATORS */
+
+	/**
+	 * Iterate over all edges and call @a handle. Each undirected edge is visited once.
+	 *
+	 * @param handle Takes parameters <code>(node, node)</code>, <code>(node, node, edgweight)</code>, <code>(node, node, edgeid)</code> or <code>(node, node, edgeweight, edgeid)</code>.
+	 */
+	template<typename L> void forEdges(L handle) const;
+	template<typename L> void parallelForEdges(L handle) const;
+	template<typename L> double parallelSumForEdges(L handle) const;
+
+	/* NEIGHBORHOOD ITERATORS */
+
+	/**
+	 * Iterate over all neighbors of @a u. For directed graphs only outgoing edges are considered.
+	 *
+	 * @param handle Takes parameter <code>(node)</code> or <code>(node, edgeweight)</code>.
+	 */
+	template<typename L> void forNeighborsOf(node u, L handle) const;
+
+	/**
+	 * Iterate over all outgoing edges of @a u.
+	 *
+	 * @param handle Takes parameters <code>(node, node)</code>, <code>(node, node, edgeweight)</code>, <code>(node, node, edgeid)</code> or <code>(node, node, edgeweight, edgeid)</code>.
+	 */
+	template<typename L> void forEdgesOf(node u, L handle) const;
+
+	/**
+	 * Iterate over all incoming neighbors of @a u. Requires the snapshot to be created with storeInEdges for directed graphs.
+	 */
+	template<typename L> void forInNeighborsOf(node u, L handle) const;
+
+	/**
+	 * Iterate over all incoming edges of @a u. The handle is called with (u, v, ...) where v is the source of the edge.
+	 */
+	template<typename L> void forInEdgesOf(node u, L handle) const;
+
+	/**
+	 * Iterate over the incoming neighbors of @a u as long as @a handle returns true.
+	 *
+	 * @param handle Takes parameter <code>(node)</code> and returns <code>bool</code>.
+	 */
+	template<typename L> void forInNeighborsOfWhile(node u, L handle) const;
+
+private:
+	friend class NetworKitBinaryReader;
+	friend class NetworKitBinaryWriter;
+
+	count n = 0;
+	count m = 0;
+	node z = 0;
+	edgeid omega = 0;
+	bool weighted = false;
+	bool directed = false;
+	bool edgesIndexed = false;
+
+	StaticArray<uint64_t> existsBits; //!< bit v % 64 of existsBits[v / 64] is set iff node v exists
+	std::shared_ptr<const void> mapping; //!< keeps external storage (e.g. a mapped file) alive
+
+	StaticArray<index> outOffsets; //!< outgoing edges of u are stored in [outOffsets[u], outOffsets[u+1])
+	StaticArray<node> outTargets;
+	StaticArray<edgeweight> outWeights; //!< empty if unweighted
+	StaticArray<edgeid> outEdgeIds; //!< empty if edges are not indexed
+
+	StaticArray<index> inOffsets; //!< only used for directed graphs
+	StaticArray<node> inTargets;
+	StaticArray<edgeweight> inWeights;
+	StaticArray<edgeid> inEdgeIds;
+
+	template<bool hasWeights>
+	inline edgeweight getWeight(const StaticArray<edgeweight>& w, index i) const {
+		return hasWeights ? w[i] : defaultEdgeWeight;
+	}
+
+	template<bool hasIds>
+	inline edgeid getEdgeId(const StaticArray<edgeid>& ids, index i) const {
+		return hasIds ? ids[i] : 0;
+	}
+
+	template<bool hasWeights, bool hasIds, typename L>
+	inline void forAdjacencyImpl(node u, const StaticArray<index>& offsets, const StaticArray<node>& targets,
+			const StaticArray<edgeweight>& w, const StaticArray<edgeid>& ids, L& handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool hasIds, typename L>
+	inline void forEdgesOfNodeImpl(node u, L& handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool hasIds, typename L>
+	inline double sumEdgesOfNodeImpl(node u, L& handle) const;
+
+	/*
+	 * The following overloads select how a lambda is called depending on its parameters,
+	 * using the same rules as the corresponding helpers of Graph.
+	 */
+
+	template < class F,
+	         typename std::enable_if <
+	         (Aux::FunctionTraits<F>::arity >= 3) &&
+	         std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<2>::type>::value &&
+	         std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<3>::type>::value
+	         >::type * = (void*)0 >
+	auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v, ew, id)) {
+		return f(u, v, ew, id);
+	}
+
+	template<class F,
+			 typename std::enable_if<
+			 (Aux::FunctionTraits<F>::arity >= 2) &&
+			 std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<2>::type>::value &&
+			 std::is_same<node, typename Aux::FunctionTraits<F>::template arg<1>::type>::value
+			 >::type* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight, edgeid id) const -> decltype(f(u, v, id)) {
+		return f(u, v, id);
+	}
+
+	template<class F,
+			 typename std::enable_if<
+			 (Aux::FunctionTraits<F>::arity >= 2) &&
+			 std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<2>::type>::value
+			 >::type* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid /*id*/) const -> decltype(f(u, v, ew)) {
+		return f(u, v, ew);
+	}
+
+	template<class F,
+			 typename std::enable_if<
+			 (Aux::FunctionTraits<F>::arity >= 1) &&
+			 std::is_same<node, typename Aux::FunctionTraits<F>::template arg<1>::type>::value
+			 >::type* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight /*ew*/, edgeid /*id*/) const -> decltype(f(u, v)) {
+		return f(u, v);
+	}
+
+	template<class F,
+			 typename std::enable_if<
+			 (Aux::FunctionTraits<F>::arity >= 1) &&
+			 std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<1>::type>::value
+			 >::type* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid /*id*/) const -> decltype(f(u, ew)) {
+		return f(v, ew);
+	}
+
+	template<class F,
+			 void* = (void*)0>
+	auto edgeLambda(F&f, node, node v, edgeweight, edgeid) const -> decltype(f(v)) {
+		return f(v);
+	}
+};
+
+/* HELPERS */
+
+template<bool hasWeights, bool hasIds, typename L>
+inline void StaticGraph::forAdjacencyImpl(node u, const StaticArray<index>& offsets, const StaticArray<node>& targets,
+		const StaticArray<edgeweight>& w, const StaticArray<edgeid>& ids, L& handle) const {
+	const index end = offsets[u + 1];
+	for (index i = offsets[u]; i < end; ++i) {
+		edgeLambda<L>(handle, u, targets[i], getWeight<hasWeights>(w, i), getEdgeId<hasIds>(ids, i));
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool hasIds, typename L>
+inline void StaticGraph::forEdgesOfNodeImpl(node u, L& handle) const {
+	const index end = outOffsets[u + 1];
+	for (index i = outOffsets[u]; i < end; ++i) {
+		node v = outTargets[i];
+		// undirected edges are stored twice, only report {u, v} with u >= v
+		if (graphIsDirected || u >= v) {
+			edgeLambda<L>(handle, u, v, getWeight<hasWeights>(outWeights, i), getEdgeId<hasIds>(outEdgeIds, i));
+		}
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool hasIds, typename L>
+inline double StaticGraph::sumEdgesOfNodeImpl(node u, L& handle) const {
+	double sum = 0.0;
+	const index end = outOffsets[u + 1];
+	for (index i = outOffsets[u]; i < end; ++i) {
+		node v = outTargets[i];
+		if (graphIsDirected || u >= v) {
+			sum += edgeLambda<L>(handle, u, v, getWeight<hasWeights>(outWeights, i), getEdgeId<hasIds>(outEdgeIds, i));
+		}
+	}
+	return sum;
+}
+
+/* NODE ITERATORS */
+
+template<typename L>
+void StaticGraph::forNodes(L handle) const {
+	for (node v = 0; v < z; ++v) {
+		if (hasNode(v)) {
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void StaticGraph::parallelForNodes(L handle) const {
+	#pragma omp parallel for
+	for (node v = 0; v < z; ++v) {
+		if (hasNode(v)) {
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void StaticGraph::balancedParallelForNodes(L handle) const {
+	#pragma omp parallel for schedule(guided)
+	for (node v = 0; v < z; ++v) {
+		if (hasNode(v)) {
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+double StaticGraph::parallelSumForNodes(L handle) const {
+	double sum = 0.0;
+	#pragma omp parallel for reduction(+:sum)
+	for (node v = 0; v < z; ++v) {
+		if (hasNode(v)) {
+			sum += handle(v);
+		}
+	}
+	return sum;
+}
+
+/* EDGE ITERATORS */
+
+template<typename L>
+void StaticGraph::forEdges(L handle) const {
+	switch (weighted + 2 * directed + 4 * edgesIndexed) {
+	case 0: for (node u = 0; u < z; ++u) forEdgesOfNodeImpl<false, false, false, L>(u, handle); break;
+	case 1: for (node u = 0; u < z; ++u) forEdgesOfNodeImpl<false, true, false, L>(u, handle); break;
+	case 2: for (node u = 0; u < z; ++u) forEdgesOfNodeImpl<true, false, false, L>(u, handle); break;
+	case 3: for (node u = 0; u < z; ++u) forEdgesOfNodeImpl<true, true, false, L>(u, handle); break;
+	case 4: for (node u = 0; u < z; ++u) forEdgesOfNodeImpl<false, false, true, L>(u, handle); break;
+	case 5: for (node u = 0; u < z; ++u) forEdgesOfNodeImpl<false, true, true, L>(u, handle); break;
+	case 6: for (node u = 0; u < z; ++u) forEdgesOfNodeImpl<true, false, true, L>(u, handle); break;
+	case 7: for (node u = 0; u < z; ++u) forEdgesOfNodeImpl<true, true, true, L>(u, handle); break;
+	}
+}
+
+template<typename L>
+void StaticGraph::parallelForEdges(L handle) const {
+	balancedParallelForNodes([&](node u) {
+		switch (weighted + 2 * directed + 4 * edgesIndexed) {
+		case 0: forEdgesOfNodeImpl<false, false, false, L>(u, handle); break;
+		case 1: forEdgesOfNodeImpl<false, true, false, L>(u, handle); break;
+		case 2: forEdgesOfNodeImpl<true, false, false, L>(u, handle); break;
+		case 3: forEdgesOfNodeImpl<true, true, false, L>(u, handle); break;
+		case 4: forEdgesOfNodeImpl<false, false, true, L>(u, handle); break;
+		case 5: forEdgesOfNodeImpl<false, true, true, L>(u, handle); break;
+		case 6: forEdgesOfNodeImpl<true, false, true, L>(u, handle); break;
+		case 7: forEdgesOfNodeImpl<true, true, true, L>(u, handle); break;
+		}
+	});
+}
+
+template<typename L>
+double StaticGraph::parallelSumForEdges(L handle) const {
+	return parallelSumForNodes([&](node u) {
+		switch (weighted + 2 * directed + 4 * edgesIndexed) {
+		case 0: return sumEdgesOfNodeImpl<false, false, false, L>(u, handle);
+		case 1: return sumEdgesOfNodeImpl<false, true, false, L>(u, handle);
+		case 2: return sumEdgesOfNodeImpl<true, false, false, L>(u, handle);
+		case 3: return sumEdgesOfNodeImpl<true, true, false, L>(u, handle);
+		case 4: return sumEdgesOfNodeImpl<false, false, true, L>(u, handle);
+		case 5: return sumEdgesOfNodeImpl<false, true, true, L>(u, handle);
+		case 6: return sumEdgesOfNodeImpl<true, false, true, L>(u, handle);
+		default: return sumEdgesOfNodeImpl<true, true, true, L>(u, handle);
+		}
+	});
+}
+
+/* NEIGHBORHOOD ITERATORS */
+
+template<typename L>
+void StaticGraph::forNeighborsOf(node u, L handle) const {
+	forEdgesOf(u, handle);
+}
+
+template<typename L>
+void StaticGraph::forEdgesOf(node u, L handle) const {
+	switch (weighted + 2 * edgesIndexed) {
+	case 0: forAdjacencyImpl<false, false, L>(u, outOffsets, outTargets, outWeights, outEdgeIds, handle); break;
+	case 1: forAdjacencyImpl<true, false, L>(u, outOffsets, outTargets, outWeights, outEdgeIds, handle); break;
+	case 2: forAdjacencyImpl<false, true, L>(u, outOffsets, outTargets, outWeights, outEdgeIds, handle); break;
+	case 3: forAdjacencyImpl<true, true, L>(u, outOffsets, outTargets, outWeights, outEdgeIds, handle); break;
+	}
+}
+
+template<typename L>
+void StaticGraph::forInNeighborsOf(node u, L handle) const {
+	forInEdgesOf(u, handle);
+}
+
+template<typename L>
+void StaticGraph::forInEdgesOf(node u, L handle) const {
+	if (!directed) {
+		forEdgesOf(u, handle);
+		return;
+	}
+	assert(!inOffsets.empty());
+	switch (weighted + 2 * edgesIndexed) {
+	case 0: forAdjacencyImpl<false, false, L>(u, inOffsets, inTargets, inWeights, inEdgeIds, handle); break;
+	case 1: forAdjacencyImpl<true, false, L>(u, inOffsets, inTargets, inWeights, inEdgeIds, handle); break;
+	case 2: forAdjacencyImpl<false, true, L>(u, inOffsets, inTargets, inWeights, inEdgeIds, handle); break;
+	case 3: forAdjacencyImpl<true, true, L>(u, inOffsets, inTargets, inWeights, inEdgeIds, handle); break;
+	}
+}
+
+template<typename L>
+void StaticGraph::forInNeighborsOfWhile(node u, L handle) const {
+	const StaticArray<index>& offsets = directed ? inOffsets : outOffsets;
+	const StaticArray<node>& targets = directed ? inTargets : outTargets;
+	assert(!offsets.empty());
+	const index end = offsets[u + 1];
+	for (index i = offsets[u]; i < end; ++i) {
+		if (!handle(targets[i])) {
+			break;
+		}
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* STATICGRAPH_H_ */
@@ -398,6 +398,84 @@ TEST_P(GraphBuilderAutoCompleteGTest, testSameAsGraph) {
 	}
 }
 
+TEST_P(GraphBuilderAutoCompleteGTest, testParallelSameAsSequential) {
+	Aux::Random::setSeed(1, false);
+	const count n = 2000;
+	auto b1 = createGraphBuilder(n);
+	auto b2 = createGraphBuilder(n);
+	for (node v = 0; v < n; v++) {
+		std::vector<node> targets(Aux::Random::integer(20));
+		for (node& u : targets) {
+			u = Aux::Random::integer(v, n - 1); // self-loops possible
+		}
+		std::sort(targets.begin(), targets.end());
+		targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+		for (node u : targets) {
+			edgeweight ew = Aux::Random::probability();
+			b1.addHalfEdge(v, u, ew);
+			b2.addHalfEdge(v, u, ew);
+		}
+	}
+
+	// both paths have to produce the same adjacency arrays, including their order
+	Graph G_sequential = b1.toGraph(true, false);
+	Graph G_parallel = b2.toGraph(true, true);
+	ASSERT_EQ(G_sequential.numberOfEdges(), G_parallel.numberOfEdges());
+	ASSERT_EQ(G_sequential.numberOfSelfLoops(), G_parallel.numberOfSelfLoops());
+	G_sequential.forNodes([&](node v) {
+		std::vector<std::pair<node, edgeweight>> expected, actual;
+		G_sequential.forNeighborsOf(v, [&](node u, edgeweight ew) { expected.emplace_back(u, ew); });
+		G_parallel.forNeighborsOf(v, [&](node u, edgeweight ew) { actual.emplace_back(u, ew); });
+		ASSERT_EQ(expected, actual);
+		expected.clear();
+		actual.clear();
+		G_sequential.forInNeighborsOf(v, [&](node u, edgeweight ew) { expected.emplace_back(u, ew); });
+		G_parallel.forInNeighborsOf(v, [&](node u, edgeweight ew) { actual.emplace_back(u, ew); });
+		ASSERT_EQ(expected, actual);
+	});
+}
+
+TEST_P(GraphBuilderAutoCompleteGTest, testParallelSameAsSequentialMultigraph) {
+	Aux::Random::setSeed(2, false);
+	const count n = 500;
+	auto b1 = createGraphBuilder(n);
+	auto b2 = createGraphBuilder(n);
+	for (node v = 0; v + 1 < n; v++) {
+		// parallel edges with decreasing weights, so their order differs from the order of the weights;
+		// addHalfEdge does not accept parallel edges, so the neighborhoods are swapped in
+		count edges = Aux::Random::integer(20);
+		std::vector<node> neighbors;
+		std::vector<edgeweight> weights;
+		for (index i = 0; i < edges; i++) {
+			neighbors.push_back(Aux::Random::integer(v + 1, std::min(v + 5, n - 1)));
+			weights.push_back(edges - i + Aux::Random::probability());
+		}
+		if (!isWeighted()) {
+			weights.clear();
+		}
+		std::vector<node> neighbors2 = neighbors;
+		std::vector<edgeweight> weights2 = weights;
+		b1.swapNeighborhood(v, neighbors, weights, false);
+		b2.swapNeighborhood(v, neighbors2, weights2, false);
+	}
+
+	Graph G_sequential = b1.toGraph(true, false);
+	Graph G_parallel = b2.toGraph(true, true);
+	ASSERT_EQ(G_sequential.numberOfEdges(), G_parallel.numberOfEdges());
+	ASSERT_EQ(G_sequential.numberOfSelfLoops(), G_parallel.numberOfSelfLoops());
+	G_sequential.forNodes([&](node v) {
+		std::vector<std::pair<node, edgeweight>> expected, actual;
+		G_sequential.forNeighborsOf(v, [&](node u, edgeweight ew) { expected.emplace_back(u, ew); });
+		G_parallel.forNeighborsOf(v, [&](node u, edgeweight ew) { actual.emplace_back(u, ew); });
+		ASSERT_EQ(expected, actual);
+		expected.clear();
+		actual.clear();
+		G_sequential.forInNeighborsOf(v, [&](node u, edgeweight ew) { expected.emplace_back(u, ew); });
+		G_parallel.forInNeighborsOf(v, [&](node u, edgeweight ew) { actual.emplace_back(u, ew); });
+		ASSERT_EQ(expected, actual);
+	});
+}
+
 TEST_P(GraphBuilderAutoCompleteGTest, testForValidStateAfterToGraph) {
 	Graph Ghouse = toGraph(this->bHouse);
 
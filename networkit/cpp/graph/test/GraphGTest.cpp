@@ -11,6 +11,7 @@
 
 #include "GraphGTest.h"
 #include "../GraphBuilder.h"
+#include "../StaticGraph.h"
 #include "../../io/METISGraphReader.h"
 #include "../../auxiliary/NumericTools.h"
 #include "../../distance/DynBFS.h"
@@ -2158,6 +2159,151 @@ TEST_P(GraphGTest, testSortEdges) {
 	}
 }
 
+TEST_P(GraphGTest, testEdgeLookup) {
+	Aux::Random::setSeed(42, false);
+	const count n = 60;
+	// H gets the same modifications as G, but is searched linearly
+	Graph G = createGraph(n);
+	Graph H = createGraph(n);
+	auto addEdge = [&](node u, node v, edgeweight w) {
+		G.addEdge(u, v, w);
+		H.addEdge(u, v, w);
+	};
+	for (node v = 1; v < n; ++v) {
+		addEdge(0, v, v);
+		addEdge(v, 0, v + 0.5);
+	}
+	addEdge(0, 7, 100.0); // multi-edge
+	G.indexEdges();
+	H.indexEdges();
+	G.indexEdgeLookup(8);
+	EXPECT_TRUE(G.hasEdgeLookup());
+	EXPECT_FALSE(H.hasEdgeLookup());
+
+	auto expectSameEdges = [&]() {
+		for (node u = 0; u < G.upperNodeIdBound(); ++u) {
+			for (node v = 0; v < G.upperNodeIdBound(); ++v) {
+				ASSERT_EQ(H.hasEdge(u, v), G.hasEdge(u, v));
+				EXPECT_EQ(H.weight(u, v), G.weight(u, v));
+				if (H.hasEdge(u, v)) {
+					EXPECT_EQ(H.edgeId(u, v), G.edgeId(u, v));
+				}
+			}
+		}
+	};
+	expectSameEdges();
+
+	for (index i = 0; i < 200; ++i) {
+		node u = Aux::Random::integer(G.upperNodeIdBound() - 1);
+		node v = Aux::Random::integer(G.upperNodeIdBound() - 1);
+		if (i % 3 == 0 && H.hasEdge(u, v)) {
+			G.removeEdge(u, v);
+			H.removeEdge(u, v);
+		} else if (i % 3 == 1 && G.isWeighted() && H.hasEdge(u, v)) {
+			G.setWeight(u, v, i);
+			H.setWeight(u, v, i);
+		} else {
+			addEdge(u, v, i);
+		}
+		if (i % 50 == 0) {
+			G.addNode();
+			H.addNode();
+			addEdge(0, G.upperNodeIdBound() - 1, 1.0);
+		}
+	}
+	expectSameEdges();
+
+	addEdge(0, 3, 1.0);
+	addEdge(0, 5, 1.0);
+	G.swapEdge(0, 3, 0, 5);
+	H.swapEdge(0, 3, 0, 5);
+	addEdge(1, 2, 1.0);
+	addEdge(3, 4, 1.0);
+	G.swapEdge(1, 2, 3, 4);
+	H.swapEdge(1, 2, 3, 4);
+	expectSameEdges();
+
+	G.compactEdges();
+	H.compactEdges();
+	expectSameEdges();
+
+	G.sortEdges();
+	H.sortEdges();
+	expectSameEdges();
+
+	Graph copy = G;
+	EXPECT_TRUE(copy.hasEdgeLookup());
+	G.removeEdgeLookup();
+	EXPECT_FALSE(G.hasEdgeLookup());
+	expectSameEdges();
+}
+
+TEST_P(GraphGTest, testStaticGraphSnapshot) {
+	Graph G = this->Ghouse;
+	G.addNode();
+	G.addNode();
+	G.removeNode(5);
+	G.addEdge(0, 6, 2.5);
+	G.removeEdge(1, 0);
+	G.indexEdges();
+
+	StaticGraph S(G);
+	ASSERT_EQ(G.numberOfNodes(), S.numberOfNodes());
+	ASSERT_EQ(G.numberOfEdges(), S.numberOfEdges());
+	ASSERT_EQ(G.upperNodeIdBound(), S.upperNodeIdBound());
+	ASSERT_EQ(G.upperEdgeIdBound(), S.upperEdgeIdBound());
+	ASSERT_EQ(G.isWeighted(), S.isWeighted());
+	ASSERT_EQ(G.isDirected(), S.isDirected());
+	ASSERT_FALSE(S.hasNode(5));
+
+	typedef std::tuple<node, node, edgeweight, edgeid> EdgeTuple;
+	std::vector<EdgeTuple> expected, actual;
+
+	// neighborhoods are stored in the same order
+	G.forNodes([&](node u) {
+		ASSERT_TRUE(S.hasNode(u));
+		ASSERT_EQ(G.degree(u), S.degree(u));
+		ASSERT_EQ(G.degreeIn(u), S.degreeIn(u));
+		ASSERT_DOUBLE_EQ(G.weightedDegree(u), S.weightedDegree(u));
+		G.forEdgesOf(u, [&](node u, node v, edgeweight w, edgeid eid) {
+			expected.emplace_back(u, v, w, eid);
+		});
+		G.forInEdgesOf(u, [&](node u, node v, edgeweight w, edgeid eid) {
+			expected.emplace_back(u, v, w, eid);
+		});
+		S.forEdgesOf(u, [&](node u, node v, edgeweight w, edgeid eid) {
+			actual.emplace_back(u, v, w, eid);
+		});
+		S.forInEdgesOf(u, [&](node u, node v, edgeweight w, edgeid eid) {
+			actual.emplace_back(u, v, w, eid);
+		});
+	});
+	EXPECT_EQ(expected, actual);
+
+	expected.clear();
+	actual.clear();
+	G.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+		expected.emplace_back(u, v, w, eid);
+		EXPECT_TRUE(S.hasEdge(u, v));
+		EXPECT_EQ(G.weight(u, v), S.weight(u, v));
+	});
+	S.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+		actual.emplace_back(u, v, w, eid);
+	});
+	EXPECT_EQ(expected, actual);
+
+	count neighbors = 0;
+	S.forNodes([&](node u) {
+		S.forNeighborsOf(u, [&](node) {
+			neighbors++;
+		});
+	});
+	EXPECT_EQ(G.isDirected() ? G.numberOfEdges() : 2 * G.numberOfEdges() - G.numberOfSelfLoops(), neighbors);
+	EXPECT_DOUBLE_EQ(G.totalEdgeWeight(), S.totalEdgeWeight());
+	EXPECT_EQ(G.numberOfEdges(), S.parallelSumForEdges([](node, node) { return 1.0; }));
+	EXPECT_FALSE(S.hasEdge(1, 0));
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
@@ -10,6 +10,9 @@
 #include "../RandomSpanningForest.h"
 #include "../SpanningForest.h"
 #include "../../io/METISGraphReader.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+#include "../../structures/UnionFind.h"
+#include "../../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -31,6 +34,39 @@ TEST_F(SpanningGTest, testKruskalMinSpanningForest) {
 	}
 }
 
+TEST_F(SpanningGTest, testKruskalMinSpanningForestWeighted) {
+	Aux::Random::setSeed(42, false);
+	// enough edges for several filter chunks, and more than one component
+	Graph G = ErdosRenyiGenerator(3000, 0.03).generate();
+	Graph H(G.upperNodeIdBound() + 5, true);
+	G.forEdges([&](node u, node v) {
+		H.addEdge(u, v, Aux::Random::real());
+	});
+
+	KruskalMSF msf(H);
+	msf.run();
+	Graph T = msf.getForest();
+
+	// reference: Kruskal with the sequential union find, in the same (decreasing) weight order
+	std::vector<std::pair<edgeweight, std::pair<node, node>>> edges;
+	H.forEdges([&](node u, node v, edgeweight w) {
+		edges.push_back({w, {u, v}});
+	});
+	std::sort(edges.begin(), edges.end(), std::greater<std::pair<edgeweight, std::pair<node, node>>>());
+	UnionFind uf(H.upperNodeIdBound());
+	count treeEdges = 0;
+	for (auto e : edges) {
+		node u = e.second.first;
+		node v = e.second.second;
+		if (uf.find(u) != uf.find(v)) {
+			uf.merge(u, v);
+			++treeEdges;
+			EXPECT_TRUE(T.hasEdge(u, v));
+		}
+	}
+	EXPECT_EQ(treeEdges, T.numberOfEdges());
+}
+
 TEST_F(SpanningGTest, testRandomSpanningTree) {
 	METISGraphReader reader;
 	std::vector<std::string> graphs = {"karate", "jazz", "celegans_metabolic"};
@@ -6,22 +6,24 @@
  */
 
 #include "EdgeListReader.h"
+#include "ParallelLineReader.h"
 #include "../auxiliary/Log.h"
 
 #include <sstream>
+#include <algorithm>
+#include <omp.h>
 
 #include "../auxiliary/Enforce.h"
+#include "../auxiliary/NumberParsing.h"
+#include "../graph/GraphBuilder.h"
 
 namespace NetworKit {
 
-EdgeListReader::EdgeListReader(const char separator, const node firstNode, const std::string commentPrefix, const bool continuous, const bool directed) :
-	separator(separator), commentPrefix(commentPrefix), firstNode(firstNode), continuous(continuous), mapNodeIds(), directed(directed) {
-//	this->mapNodeIds;i
+EdgeListReader::EdgeListReader(const char separator, const node firstNode, const std::string commentPrefix, const bool continuous, const bool directed, const bool integerIds) :
+	separator(separator), commentPrefix(commentPrefix), firstNode(firstNode), continuous(continuous), nodeIds(integerIds), directed(directed), integerIds(integerIds) {
 }
 
 Graph EdgeListReader::read(const std::string& path) {
-	this->mapNodeIds.clear();
-
 	if (this->continuous) {
 		DEBUG("read graph with continuous ids");
 		return readContinuous(path);
@@ -32,213 +34,305 @@ Graph EdgeListReader::read(const std::string& path) {
 }
 
 std::map<std::string,node> EdgeListReader::getNodeMap() {
+	std::map<std::string,node> mapNodeIds;
+	const NodeIdInterner& ids = getNodeIds();
+	for (node u = 0; u < ids.size(); ++u) {
+		mapNodeIds.insert(std::make_pair(ids.key(u), u));
+	}
+	return mapNodeIds;
+}
+
+const NodeIdInterner& EdgeListReader::getNodeIds() const {
 	if (this->continuous) throw std::runtime_error("Input files are assumed to have continuous node ids, therefore no node mapping has been created.");
-	return this->mapNodeIds;
+	return this->nodeIds;
 }
 
-Graph EdgeListReader::readContinuous(const std::string& path) {
-	std::ifstream file(path);
-	Aux::enforceOpened(file);
-	std::string line; // the current line
+/**
+ * Edges parsed from one chunk of an edge list file, in the order of the lines.
+ */
+struct EdgeChunk {
+	std::vector<node> sources;
+	std::vector<node> targets;
+	std::vector<edgeweight> weights;
+	count lines = 0;			//!< number of lines in the chunk
+	count firstTokens = 0;		//!< number of tokens on the first edge line, 0 if there is none
+	node maxId = 0;				//!< largest node id of the chunk, continuous ids only
+	index weightedLine = none;	//!< first line with an edge weight
+	std::string weightedText;
+	index errorLine = none;		//!< first malformed line
+	std::string error;
+};
 
-	// read file once to get to the last line and figure out the number of nodes
-	// unfortunately there is an empty line at the ending of the file, so we need to get the line before that
+template<typename T>
+static T parseToken(const char* it, const char* end) {
+	if (it == end) {
+		throw std::invalid_argument("empty token");
+	}
+	T value;
+	std::tie(value, it) = Aux::Parsing::strTo<T, const char*, Aux::Checkers::Enforcer>(it, end);
+	return value;
+}
 
-	node maxNode = 0;
+/**
+ * Parses the lines [@a from, @a to) into @a chunk. @a parseId(it, end) translates a node id token.
+ */
+template<typename L>
+static void parseChunk(const char* from, const char* to, char separator, const std::string& commentPrefix, EdgeChunk& chunk, L parseId) {
+	ParallelLineReader::forLines(from, to, [&](const char* it, const char* end) {
+		index line = chunk.lines++;
+		if (chunk.errorLine != none || it == end) {
+			return;
+		}
+		if (count(end - it) >= commentPrefix.size() && std::equal(commentPrefix.begin(), commentPrefix.end(), it)) {
+			return;
+		}
+		// split at the separator like Aux::StringTools::split, but without copying the tokens
+		std::pair<const char*, const char*> tokens[3];
+		count numTokens = 0;
+		const char* pos = it;
+		while (pos != end) {
+			const char* tokenEnd = std::find(pos, end, separator);
+			if (numTokens < 3) {
+				tokens[numTokens] = std::make_pair(pos, tokenEnd);
+			}
+			++numTokens;
+			if (tokenEnd == end) {
+				break;
+			}
+			pos = tokenEnd + 1;
+		}
+		if (chunk.firstTokens == 0) {
+			chunk.firstTokens = numTokens;
+		}
+		try {
+			if (numTokens != 2 && numTokens != 3) {
+				throw std::invalid_argument("wrong number of tokens");
+			}
+			node u = parseId(tokens[0].first, tokens[0].second);
+			node v = parseId(tokens[1].first, tokens[1].second);
+			edgeweight weight = defaultEdgeWeight;
+			if (numTokens == 3) {
+				weight = parseToken<edgeweight>(tokens[2].first, tokens[2].second);
+				if (chunk.weightedLine == none) {
+					chunk.weightedLine = line;
+					chunk.weightedText.assign(it, end);
+				}
+			}
+			chunk.sources.push_back(u);
+			chunk.targets.push_back(v);
+			chunk.weights.push_back(weight);
+		} catch (std::exception& e) {
+			chunk.errorLine = line;
+			chunk.error.assign(it, end);
+		}
+	});
+}
+
+/**
+ * Determines whether the graph is weighted and throws for the first malformed line of all chunks.
+ */
+static bool checkChunks(const std::vector<EdgeChunk>& chunks) {
 	bool weighted = false;
-	bool checkedWeighted = false;
+	for (const EdgeChunk& chunk : chunks) {
+		if (chunk.firstTokens != 0) {
+			weighted = (chunk.firstTokens == 3);
+			if (weighted) {
+				INFO("Identified graph as weighted.");
+			}
+			break;
+		}
+	}
+	count line = 0;
+	for (const EdgeChunk& chunk : chunks) {
+		// a weight in an unweighted graph makes the line malformed
+		index errorLine = chunk.errorLine;
+		if (!weighted && chunk.weightedLine != none && (errorLine == none || chunk.weightedLine < errorLine)) {
+			errorLine = chunk.weightedLine;
+		}
+		if (errorLine != none) {
+			std::stringstream message;
+			message << "malformed line ";
+			message << line + errorLine + 1 << ": ";
+			message << (errorLine == chunk.errorLine ? chunk.error : chunk.weightedText);
+			throw std::runtime_error(message.str());
+		}
+		line += chunk.lines;
+	}
+	return weighted;
+}
 
-	DEBUG("separator: " , this->separator);
-	DEBUG("first node: " , this->firstNode);
+/**
+ * Builds the graph from the parsed edges. The neighbors of every node are stored in the order of
+ * the file and of several parallel edges only the first is added, as if the edges had been added
+ * one by one with Graph::addEdge unless Graph::hasEdge.
+ */
+static Graph buildGraph(std::vector<EdgeChunk>& chunks, count n, bool weighted, bool directed) {
+	// the position of an edge in the file is its sequence number
+	std::vector<index> offset(chunks.size() + 1, 0);
+	for (index c = 0; c < chunks.size(); ++c) {
+		offset[c + 1] = offset[c] + chunks[c].sources.size();
+	}
+	const count m = offset[chunks.size()];
+	std::vector<node> sources(m);
+	std::vector<node> targets(m);
+	std::vector<edgeweight> weights(weighted ? m : 0);
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index c = 0; c < chunks.size(); ++c) {
+		std::copy(chunks[c].sources.begin(), chunks[c].sources.end(), sources.begin() + offset[c]);
+		std::copy(chunks[c].targets.begin(), chunks[c].targets.end(), targets.begin() + offset[c]);
+		if (weighted) {
+			std::copy(chunks[c].weights.begin(), chunks[c].weights.end(), weights.begin() + offset[c]);
+		}
+		chunks[c] = EdgeChunk();
+	}
 
-	// first find out the maximum node id
-	DEBUG("first pass");
-	count i = 0;
-	while (file.good()) {
-		++i;
-		std::getline(file, line);
-		TRACE("read line: " , line);
-		if (!line.empty()) {
-			if (line.back() == '\r') line.pop_back();
-			if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) == 0) {
-				TRACE("ignoring comment: " , line);
-			} else {
-				std::vector<std::string> split = Aux::StringTools::split(line, this->separator);
-				if (!checkedWeighted) {
-					if (split.size() == 2) {
-						weighted = false;
-					} else if (split.size() == 3) {
-						INFO("Identified graph as weighted.");
-						weighted = true;
-					}
-					checkedWeighted = true;
-				}
-				if (split.size() == 2 || split.size() == 3) {
-					TRACE("split into : " , split[0] , " and " , split[1]);
-					node u = std::stoul(split[0]);
-					if (u > maxNode) {
-						maxNode = u;
-					}
-					node v = std::stoul(split[1]);
-					if (v > maxNode) {
-						maxNode = v;
-					}
+	// bucket the half edges by the node that stores them
+	std::vector<index> outBegin(n + 1, 0);
+	std::vector<index> inBegin(directed ? n + 1 : 0, 0);
+	#pragma omp parallel for
+	for (index e = 0; e < m; ++e) {
+		#pragma omp atomic
+		outBegin[sources[e] + 1]++;
+		if (directed) {
+			#pragma omp atomic
+			inBegin[targets[e] + 1]++;
+		} else if (sources[e] != targets[e]) {
+			#pragma omp atomic
+			outBegin[targets[e] + 1]++;
+		}
+	}
+	for (node u = 0; u < n; ++u) {
+		outBegin[u + 1] += outBegin[u];
+		if (directed) {
+			inBegin[u + 1] += inBegin[u];
+		}
+	}
+
+	using HalfEdge = std::pair<node, index>; // (neighbor, sequence number)
+	std::vector<HalfEdge> outHalf(outBegin[n]);
+	std::vector<HalfEdge> inHalf(directed ? inBegin[n] : 0);
+	std::vector<index> outPos(outBegin.begin(), outBegin.begin() + n);
+	std::vector<index> inPos(inBegin.begin(), directed ? inBegin.begin() + n : inBegin.end());
+	#pragma omp parallel for
+	for (index e = 0; e < m; ++e) {
+		const node u = sources[e];
+		const node v = targets[e];
+		index pos;
+		#pragma omp atomic capture
+		pos = outPos[u]++;
+		outHalf[pos] = std::make_pair(v, e);
+		if (directed) {
+			#pragma omp atomic capture
+			pos = inPos[v]++;
+			inHalf[pos] = std::make_pair(u, e);
+		} else if (u != v) {
+			#pragma omp atomic capture
+			pos = outPos[v]++;
+			outHalf[pos] = std::make_pair(u, e);
+		}
+	}
+
+	// every node is handled by one thread, so its half edges can be added concurrently
+	GraphBuilder b(n, weighted, directed);
+	auto addHalfEdges = [&](std::vector<HalfEdge>& half, const std::vector<index>& begin, bool in) {
+		#pragma omp parallel for schedule(dynamic, 1024)
+		for (node u = 0; u < n; ++u) {
+			auto first = half.begin() + begin[u];
+			auto last = half.begin() + begin[u + 1];
+			std::sort(first, last);
+			last = std::unique(first, last, [](const HalfEdge& x, const HalfEdge& y) {
+				return x.first == y.first;
+			});
+			std::sort(first, last, [](const HalfEdge& x, const HalfEdge& y) {
+				return x.second < y.second;
+			});
+			for (auto it = first; it != last; ++it) {
+				edgeweight weight = weighted ? weights[it->second] : defaultEdgeWeight;
+				if (in) {
+					b.addHalfInEdge(u, it->first, weight);
 				} else {
-					std::stringstream message;
-					message << "malformed line ";
-					message << i << ": ";
-					message << line;
-					throw std::runtime_error(message.str());
+					b.addHalfOutEdge(u, it->first, weight);
 				}
 			}
-		} else {
-			DEBUG("line ", i, " is empty.");
 		}
+	};
+	addHalfEdges(outHalf, outBegin, false);
+	if (directed) {
+		addHalfEdges(inHalf, inBegin, true);
 	}
-	file.close();
-	maxNode = maxNode - this->firstNode + 1;
-	DEBUG("max. node id found: " , maxNode);
+	return b.toGraph(false);
+}
 
-	Graph G(maxNode, weighted, directed);
-
-	DEBUG("second pass");
-	file.open(path);
-	// split the line into start and end node. since the edges are sorted, the start node has the highest id of all nodes
-	i = 0; // count lines
-	while(std::getline(file,line)){
-		if (line.empty()) continue;
-		if(*line.rbegin() == '\r') line.pop_back();
-		++i;
-		if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) == 0) {
-			// TRACE("ignoring comment: " , line);
-		} else {
-			// TRACE("edge line: " , line);
-			std::vector<std::string> split = Aux::StringTools::split(line, this->separator);
-			if (split.size() == 2) {
-				node u = std::stoul(split[0]) - this->firstNode;
-				node v = std::stoul(split[1]) - this->firstNode;
-			    if (!G.hasEdge(u,v)) {
-					G.addEdge(u, v);
-				}
-			} else if (weighted && split.size() == 3) {
-				node u = std::stoul(split[0]) - this->firstNode;
-				node v = std::stoul(split[1]) - this->firstNode;
-				double weight = std::stod(split[2]);
-			    if (!G.hasEdge(u,v)) {
-					G.addEdge(u, v, weight);
-				}
-			} else {
-				std::stringstream message;
-				message << "malformed line ";
-				message << i << ": ";
-				message << line;
-				throw std::runtime_error(message.str());
+Graph EdgeListReader::readContinuous(const std::string& path) {
+	ParallelLineReader reader(path);
+	DEBUG("separator: " , this->separator);
+	DEBUG("first node: " , this->firstNode);
+
+	// several chunks per thread to balance the load
+	const count numChunks = 4 * omp_get_max_threads();
+	std::vector<const char*> bounds = reader.chunkBounds(reader.begin(), numChunks);
+	std::vector<EdgeChunk> chunks(numChunks);
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index c = 0; c < numChunks; ++c) {
+		EdgeChunk& chunk = chunks[c];
+		parseChunk(bounds[c], bounds[c + 1], separator, commentPrefix, chunk, [&](const char* it, const char* end) {
+			node id = parseToken<node>(it, end);
+			if (id < firstNode) {
+				throw std::invalid_argument("node id smaller than the first node");
 			}
-		}
+			chunk.maxId = std::max(chunk.maxId, id);
+			return id - firstNode;
+		});
 	}
-	file.close();
+	bool weighted = checkChunks(chunks);
 
-	G.shrinkToFit();
-	return G;
+	node maxNode = 0;
+	for (const EdgeChunk& chunk : chunks) {
+		maxNode = std::max(maxNode, chunk.maxId);
+	}
+	maxNode = maxNode - this->firstNode + 1;
+	DEBUG("max. node id found: " , maxNode);
+
+	return buildGraph(chunks, maxNode, weighted, directed);
 }
 
 
 Graph EdgeListReader::readNonContinuous(const std::string& path) {
-	std::ifstream file(path);
-	Aux::enforceOpened(file);
+	ParallelLineReader reader(path);
 	DEBUG("file is opened, proceed");
-	std::string line; // the current line
-	node consecutiveID = 0;
 
-	bool weighted = false;
-	bool checkedWeighted = false;
-
-	// first find out the maximum node id
-	DEBUG("first pass: create node ID mapping");
-	count i = 0;
-	while (file.good()) {
-		++i;
-		std::getline(file, line);
-		TRACE("read line: " , line);
-		if (!line.empty()) {
-			if(line.back() == '\r') line.pop_back();
-			if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) == 0) {
-				 TRACE("ignoring comment: " , line);
-			} else if (line.length() == 0) {
-				TRACE("ignoring empty line");
-			} else {
-				std::vector<std::string> split = Aux::StringTools::split(line, this->separator);
-				if (!checkedWeighted) {
-					if (split.size() == 2) {
-						weighted = false;
-					} else if (split.size() == 3) {
-						INFO("Identified graph as weighted.");
-						weighted = true;
-					}
-					checkedWeighted = true;
-				}
-				if (split.size() == 2 || split.size() == 3) {
-					TRACE("split into : " , split[0] , " and " , split[1]);
-					if(this->mapNodeIds.insert(std::make_pair(split[0],consecutiveID)).second) ++consecutiveID;
-					if(this->mapNodeIds.insert(std::make_pair(split[1],consecutiveID)).second) ++consecutiveID;
-				} else {
-					std::stringstream message;
-					message << "malformed line ";
-					message << i << ": ";
-					message << line;
-					throw std::runtime_error(message.str());
-				}
+	const count numChunks = 4 * omp_get_max_threads();
+	std::vector<const char*> bounds = reader.chunkBounds(reader.begin(), numChunks);
+
+	this->nodeIds.reset(reader.begin());
+
+	// the position of an id in the file determines its node, regardless of the thread interning it
+	std::vector<EdgeChunk> chunks(numChunks);
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index c = 0; c < numChunks; ++c) {
+		parseChunk(bounds[c], bounds[c + 1], separator, commentPrefix, chunks[c], [&](const char* it, const char* end) {
+			if (this->integerIds) {
+				return this->nodeIds.insert(parseToken<uint64_t>(it, end), it - reader.begin());
 			}
-		} else {
-			DEBUG("line ", i, " is empty.");
-		}
+			return this->nodeIds.insert(it, end, it - reader.begin());
+		});
 	}
-	file.close();
-
-	DEBUG("found ",this->mapNodeIds.size()," unique node ids");
-	Graph G(this->mapNodeIds.size(), weighted, directed);
-
-	DEBUG("second pass: add edges");
-	file.open(path);
-
-	// split the line into start and end node. since the edges are sorted, the start node has the highest id of all nodes
-	i = 0; // count lines
-	while(std::getline(file,line)){
-		if (line.empty()) continue;
-		if(*line.rbegin() == '\r') line.pop_back();
-        ++i;
-		if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) == 0) {
-			// TRACE("ignoring comment: " , line);
-		} else {
-			// TRACE("edge line: " , line);
-			std::vector<std::string> split = Aux::StringTools::split(line, this->separator);
-			if (split.size() == 2) {
-				node u = this->mapNodeIds[split[0]];
-				node v = this->mapNodeIds[split[1]];
-				if (!G.hasEdge(u,v)) {
-					G.addEdge(u, v);
-				}
-			} else if (weighted && split.size() == 3) {
-				node u = this->mapNodeIds[split[0]];
-				node v = this->mapNodeIds[split[1]];
-				double weight = std::stod(split[2]);
-			    if (!G.hasEdge(u,v)) {
-					G.addEdge(u, v, weight);
-				}
-			} else {
-				std::stringstream message;
-				message << "malformed line ";
-				message << i << ": ";
-				message << line;
-				throw std::runtime_error(message.str());
-			}
+	bool weighted = checkChunks(chunks);
+
+	DEBUG("create node ID mapping");
+	const count n = this->nodeIds.finalize();
+	DEBUG("found ", n, " unique node ids");
+
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index c = 0; c < numChunks; ++c) {
+		EdgeChunk& chunk = chunks[c];
+		for (index i = 0; i < chunk.sources.size(); ++i) {
+			chunk.sources[i] = this->nodeIds.nodeOf(chunk.sources[i]);
+			chunk.targets[i] = this->nodeIds.nodeOf(chunk.targets[i]);
 		}
 	}
-	DEBUG("read ",i," lines and added ",G.numberOfEdges()," edges");
-	file.close();
 
-	G.shrinkToFit();
-	return G;
+	return buildGraph(chunks, n, weighted, directed);
 }
 
 } /* namespace NetworKit */
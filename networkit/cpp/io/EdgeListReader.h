@@ -15,6 +15,7 @@
 
 
 #include "GraphReader.h"
+#include "NodeIdInterner.h"
 
 namespace NetworKit {
 
@@ -36,8 +37,9 @@ public:
 	 * @param[in]	commentChar	character used to mark comment lines
 	 * @param[in]	continuous	boolean to specify, if node ids are continuous
 	 * @param[in]	directed	treat graph as directed
+	 * @param[in]	integerIds	non-continuous ids are unsigned 64-bit integers, which are interned without creating strings
 	 */
-	EdgeListReader(const char separator, const node firstNode, const std::string commentPrefix = "#", const bool continuous = true, const bool directed = false);
+	EdgeListReader(const char separator, const node firstNode, const std::string commentPrefix = "#", const bool continuous = true, const bool directed = false, const bool integerIds = false);
 
 	/**
 	 * Given the path of an input file, read the graph contained.
@@ -54,17 +56,24 @@ public:
 //	virtual void write(const Graph& G, std::string path);
 
 	/**
-	 * Return the node map, in case node ids are not continuous
+	 * Return the node map, in case node ids are not continuous. The map is created by this call,
+	 * use getNodeIds() to access the ids without a copy.
 	 */
 	std::map<std::string,node> getNodeMap();
 
+	/**
+	 * Return the mapping of the ids in the file to nodes, in case node ids are not continuous.
+	 */
+	const NodeIdInterner& getNodeIds() const;
+
 protected:
 	char separator; 	//!< character separating nodes in an edge line
 	std::string commentPrefix;
 	node firstNode;
 	bool continuous;
-	std::map<std::string,node> mapNodeIds;
+	NodeIdInterner nodeIds;
 	bool directed;
+	bool integerIds;
 
 private:
 	Graph readContinuous(const std::string& path);
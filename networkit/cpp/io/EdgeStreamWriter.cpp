@@ -0,0 +1,120 @@
+/*
+ * EdgeStreamWriter.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <omp.h>
+
+#include "EdgeStreamWriter.h"
+#include "../auxiliary/Enforce.h"
+
+namespace NetworKit {
+
+const count EdgeStreamWriter::bufferSize = 1 << 20;
+
+/**
+ * Appends the decimal representation of @a x to @a buffer.
+ */
+static void appendNumber(std::vector<char>& buffer, uint64_t x) {
+	char digits[20];
+	int length = 0;
+	do {
+		digits[length++] = '0' + (x % 10);
+		x /= 10;
+	} while (x != 0);
+	while (length > 0) {
+		buffer.push_back(digits[--length]);
+	}
+}
+
+/**
+ * Appends @a x to @a buffer as 8 bytes in little-endian order, independent of the byte order of the machine.
+ */
+static void appendLittleEndian(std::vector<char>& buffer, uint64_t x) {
+	for (int i = 0; i < 8; ++i) {
+		buffer.push_back(static_cast<char>((x >> (8 * i)) & 0xff));
+	}
+}
+
+EdgeStreamWriter::EdgeStreamWriter(const std::string& path, Format format, bool weighted, node firstNode) :
+	file(path, std::ios::binary), format(format), weighted(weighted), firstNode(firstNode),
+	buffers(omp_get_max_threads()), edges(omp_get_max_threads(), 0) {
+	Aux::enforceOpened(file);
+	for (auto& buffer : buffers) {
+		buffer.reserve(bufferSize + 64);
+	}
+}
+
+EdgeStreamWriter::~EdgeStreamWriter() {
+	// errors can only be reported by an explicit close()
+	if (file.is_open()) {
+		for (auto& buffer : buffers) {
+			flush(buffer);
+		}
+		file.close();
+	}
+}
+
+void EdgeStreamWriter::addEdge(node u, node v, edgeweight w) {
+	const index thread = omp_get_thread_num();
+	if (thread >= buffers.size()) {
+		throw std::runtime_error("EdgeStreamWriter: more threads than at construction");
+	}
+	std::vector<char>& buffer = buffers[thread];
+	if (format == EDGELIST) {
+		appendNumber(buffer, u + firstNode);
+		buffer.push_back(' ');
+		appendNumber(buffer, v + firstNode);
+		if (weighted) {
+			buffer.push_back(' ');
+			// 17 significant digits are enough to read back the same double
+			char weight[32];
+			const int length = std::snprintf(weight, sizeof(weight), "%.17g", w);
+			buffer.insert(buffer.end(), weight, weight + length);
+		}
+		buffer.push_back('\n');
+	} else {
+		appendLittleEndian(buffer, u);
+		appendLittleEndian(buffer, v);
+		if (weighted) {
+			uint64_t bits;
+			std::memcpy(&bits, &w, sizeof(bits));
+			appendLittleEndian(buffer, bits);
+		}
+	}
+	++edges[thread];
+	if (buffer.size() >= bufferSize) {
+		flush(buffer);
+	}
+}
+
+void EdgeStreamWriter::flush(std::vector<char>& buffer) {
+	#pragma omp critical (EdgeStreamWriterFlush)
+	{
+		file.write(buffer.data(), buffer.size());
+	}
+	buffer.clear();
+}
+
+void EdgeStreamWriter::close() {
+	for (auto& buffer : buffers) {
+		flush(buffer);
+	}
+	file.close();
+	if (file.fail()) {
+		throw std::runtime_error("EdgeStreamWriter: writing the file failed");
+	}
+}
+
+count EdgeStreamWriter::numberOfEdges() const {
+	return std::accumulate(edges.begin(), edges.end(), count(0));
+}
+
+} /* namespace NetworKit */
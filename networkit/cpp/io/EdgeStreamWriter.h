@@ -0,0 +1,85 @@
+/*
+ * EdgeStreamWriter.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef EDGESTREAMWRITER_H_
+#define EDGESTREAMWRITER_H_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../Globals.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Writes edges to a file as they are produced, e.g. by a graph generator, without building a Graph.
+ *
+ * addEdge() may be called concurrently from the threads of an OpenMP parallel region. Every thread
+ * appends to its own buffer, full buffers are written to the file one at a time. Hence the edges of
+ * one thread keep their order, but the edges of different threads are interleaved in no particular
+ * order.
+ *
+ * EDGELIST writes one edge per line as "u v" (or "u v w" if weighted), readable by EdgeListReader(' ', firstNode).
+ * Weights are written with 17 significant digits, so they are read back exactly.
+ * BINARY writes every edge as two little-endian 64 bit node ids (followed by the bits of the weight as a
+ * little-endian 64 bit IEEE 754 double if weighted), without a header, on machines of any byte order.
+ */
+class EdgeStreamWriter final {
+
+public:
+	enum Format {
+		EDGELIST,
+		BINARY
+	};
+
+	/**
+	 * Opens @a path for writing.
+	 * @param[in]	path		the output file path
+	 * @param[in]	format		the file format
+	 * @param[in]	weighted	if the weight of every edge shall be written
+	 * @param[in]	firstNode	id of node 0 in the file, EDGELIST only
+	 */
+	EdgeStreamWriter(const std::string& path, Format format = EDGELIST, bool weighted = false, node firstNode = 0);
+
+	/** Flushes the buffers and closes the file. */
+	~EdgeStreamWriter();
+
+	EdgeStreamWriter(const EdgeStreamWriter&) = delete;
+	EdgeStreamWriter& operator=(const EdgeStreamWriter&) = delete;
+
+	/**
+	 * Appends the edge (@a u, @a v) with weight @a w.
+	 */
+	void addEdge(node u, node v, edgeweight w = defaultEdgeWeight);
+
+	/**
+	 * Flushes the buffers and closes the file, no edges may be added afterwards.
+	 */
+	void close();
+
+	/**
+	 * @return The number of edges written so far.
+	 */
+	count numberOfEdges() const;
+
+private:
+	static const count bufferSize;
+
+	std::ofstream file;
+	Format format;
+	bool weighted;
+	node firstNode;
+	std::vector<std::vector<char>> buffers;
+	std::vector<count> edges;
+
+	void flush(std::vector<char>& buffer);
+};
+
+} /* namespace NetworKit */
+#endif /* EDGESTREAMWRITER_H_ */
@@ -5,15 +5,59 @@
  *      Author: Christian Staudt (christian.staudt@kit.edu)
  */
 
+#include <omp.h>
+
 #include "METISGraphReader.h"
 #include "METISParser.h"
+#include "ParallelLineReader.h"
 #include "../auxiliary/Enforce.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/NumberParsing.h"
 #include "../auxiliary/StringTools.h"
 #include "../graph/GraphBuilder.h"
 
 namespace NetworKit {
 
+/**
+ * Adds the half edges of the adjacency line [@a it, @a end) of node @a u to @a b.
+ *
+ * @return The number of entries on the line, selfloops counted twice.
+ */
+static count addAdjacencies(GraphBuilder& b, node u, count n, count ignoreFirst, bool weighted, const char* it, const char* end) {
+	for (index i = 0; i < ignoreFirst && it != end; ++i) {
+		// parse first values but ignore them.
+		double dummy;
+		std::tie(dummy, it) = Aux::Parsing::strTo<double>(it, end);
+	}
+	count entries = 0;
+	while (it != end) {
+		node v;
+		edgeweight weight = defaultEdgeWeight;
+		if (weighted) {
+			try {
+				std::tie(v, it) = Aux::Parsing::strTo<node>(it, end);
+				std::tie(weight, it) = Aux::Parsing::strTo<double, const char*, Aux::Checkers::Enforcer>(it, end);
+			} catch (std::exception& e) {
+				ERROR("malformed line; not all edges have been read correctly");
+				break;
+			}
+		} else {
+			std::tie(v, it) = Aux::Parsing::strTo<node>(it, end);
+		}
+		++entries;
+		if (v == 0) {
+			ERROR("METIS Node ID should not be 0, edge ignored.");
+			continue;
+		}
+		Aux::Checkers::Enforcer::enforce(v > 0 && v <= n);
+		v = v - 1; 	// METIS-indices are 1-based
+		// correct edgeCounter for selfloops
+		entries += (u == v);
+		b.addHalfEdge(u, v, weight);
+	}
+	return entries;
+}
+
 Graph METISGraphReader::read(const std::string& path) {
 
 	METISParser parser(path);
@@ -41,63 +85,60 @@ Graph METISGraphReader::read(const std::string& path) {
 	std::string graphName = Aux::StringTools::split(Aux::StringTools::split(path, '/').back(), '.').front();
 	b.setName(graphName);
 
-	INFO("\n[BEGIN] reading graph G(n=", n, ", m=", m, ") from METIS file: ", graphName);	// progress bar follows
+	INFO("\n[BEGIN] reading graph G(n=", n, ", m=", m, ") from METIS file: ", graphName);
+
+	// the adjacency lines start after the comments and the header line
+	ParallelLineReader reader(path);
+	const char* first = reader.begin();
+	while (first != reader.end() && *first == '%') {
+		first = reader.nextLine(first);
+	}
+	first = reader.nextLine(first);
+
+	auto isComment = [](const char* it, const char* end) {
+		return it != end && *it == '%';
+	};
 
-#if (LOG_LEVEL == LOG_LEVEL_TRACE)
-	double p = 0.0; // percentage for progress bar
-#endif
-	node u = 0; // begin with 0
+	// several chunks per thread to balance lines of different length
+	const count chunks = 4 * omp_get_max_threads();
+	std::vector<const char*> bounds = reader.chunkBounds(first, chunks);
+
+	// the i-th adjacency line belongs to node i, so the first node of each chunk is a prefix sum
+	std::vector<node> firstNode(chunks + 1, 0);
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (index c = 0; c < chunks; ++c) {
+		count lines = 0;
+		ParallelLineReader::forLines(bounds[c], bounds[c + 1], [&](const char* it, const char* end) {
+			lines += !isComment(it, end);
+		});
+		firstNode[c + 1] = lines;
+	}
+	for (index c = 0; c < chunks; ++c) {
+		firstNode[c + 1] += firstNode[c];
+	}
+
+	// every node is added by a single thread, so its half edges can be added concurrently
 	count edgeCounter = 0;
-	if (weighted == 0) {
-		while (parser.hasNext() && u < n) {
-			std::vector<node> adjacencies = parser.getNext(ignoreFirst);
-			edgeCounter += adjacencies.size();
-			for (index i=0; i < adjacencies.size(); i++) {
-				if (adjacencies[i] == 0) {
-					ERROR("METIS Node ID should not be 0, edge ignored.");
-					continue;
-				}
-				Aux::Checkers::Enforcer::enforce(adjacencies[i] > 0 && adjacencies[i] <= n);
-				node v = adjacencies[i] - 1; 	// METIS-indices are 1-based
-				// correct edgeCounter for selfloops
-				edgeCounter += (u == v);
-				b.addHalfEdge(u, v);
-			}
-			u++; // next node
-#if (LOG_LEVEL == LOG_LEVEL_TRACE)
-			if ((u % ((n + 10)/10)) == 0) {
-				p = ((double) (u-1) / (double) n) * 100;
-				DEBUG(p, "% ");
-			}
-#endif
-		}
-	} else {
-		while (parser.hasNext() && u < n) {
-			std::vector<std::pair<node,double>> adjacencies = parser.getNextWithWeights(ignoreFirst);
-			edgeCounter += adjacencies.size();
-			DEBUG("node ",u," has ",adjacencies.size()," edges");
-			for (index i=0; i < adjacencies.size(); i++) {
-				if (adjacencies[i].first == 0) {
-					ERROR("METIS Node ID should not be 0, edge ignored.");
-					continue;
+	std::string failure;
+	#pragma omp parallel for schedule(dynamic, 1) reduction(+:edgeCounter)
+	for (index c = 0; c < chunks; ++c) {
+		node u = firstNode[c];
+		try {
+			ParallelLineReader::forLines(bounds[c], bounds[c + 1], [&](const char* it, const char* end) {
+				if (isComment(it, end) || u >= n) {
+					return;
 				}
-				Aux::Checkers::Enforcer::enforce(adjacencies[i].first > 0 && adjacencies[i].first <= n);
-				node v = adjacencies[i].first - 1; 	// METIS-indices are 1-based
-				// correct edgeCounter for selfloops
-				edgeCounter += (u == v);
-				double weight = adjacencies[i].second;
-				b.addHalfEdge(u, v, weight);
-				TRACE("(",u,",",v,",",adjacencies[i].second,")");
-			}
-			u += 1; // next node
-#if (LOG_LEVEL == LOG_LEVEL_TRACE)
-			if ((u % ((n + 10)/10)) == 0) {
-				p = ((double) (u-1) / (double) n) * 100;
-				DEBUG(p, "% ");
-			}
-#endif
+				edgeCounter += addAdjacencies(b, u, n, ignoreFirst, weighted, it, end);
+				u++; // next node
+			});
+		} catch (std::exception& e) {
+			#pragma omp critical
+			failure = e.what();
 		}
 	}
+	if (!failure.empty()) {
+		throw std::runtime_error(failure);
+	}
 
 	auto G = b.toGraph(false);
 
@@ -0,0 +1,76 @@
+/*
+ * NetworKitBinaryFormat.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef NETWORKITBINARYFORMAT_H_
+#define NETWORKITBINARYFORMAT_H_
+
+#include <cstdint>
+
+namespace NetworKit {
+
+/**
+ * Layout of the native binary graph format written by NetworKitBinaryWriter.
+ *
+ * The file starts with a Header, followed by the arrays of a StaticGraph. All values are
+ * 64-bit words (node ids, offsets and edge ids as unsigned integers, weights as IEEE 754
+ * doubles) in the byte order of the machine that wrote the file, so every array is 8-byte
+ * aligned and can be used directly from a memory mapping of the file.
+ */
+namespace NetworKitBinaryFormat {
+
+/** Magic bytes at the start of every file. */
+static const char magic[8] = {'N', 'K', 'B', 'I', 'N', 'G', 'R', 'F'};
+
+/** Version of the layout, incremented on incompatible changes. */
+static const uint64_t version = 1;
+
+/** Written as a 64-bit word to detect files of a different byte order. */
+static const uint64_t byteOrderMark = 0x0102030405060708ULL;
+
+enum Flags : uint64_t {
+	DIRECTED = 1,
+	WEIGHTED = 2,
+	EDGE_IDS = 4,
+	IN_EDGES = 8
+};
+
+/** Arrays stored in the file, in this order. */
+enum Section {
+	NODE_EXISTS, //!< bit v % 64 of word v / 64 is set iff node v exists
+	OUT_OFFSETS,
+	OUT_TARGETS,
+	OUT_WEIGHTS,
+	OUT_EDGE_IDS,
+	IN_OFFSETS,
+	IN_TARGETS,
+	IN_WEIGHTS,
+	IN_EDGE_IDS,
+	NUM_SECTIONS
+};
+
+struct SectionEntry {
+	uint64_t offset; //!< position of the array in bytes from the start of the file
+	uint64_t length; //!< number of 64-bit words
+};
+
+struct Header {
+	char magic[8];
+	uint64_t version;
+	uint64_t byteOrder;
+	uint64_t flags;
+	uint64_t n;
+	uint64_t m;
+	uint64_t z;
+	uint64_t omega;
+	SectionEntry sections[NUM_SECTIONS];
+};
+
+static_assert(sizeof(Header) % 8 == 0, "the arrays following the header have to be 8-byte aligned");
+
+} /* namespace NetworKitBinaryFormat */
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYFORMAT_H_ */
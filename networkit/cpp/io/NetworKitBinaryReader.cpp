@@ -0,0 +1,178 @@
+/*
+ * NetworKitBinaryReader.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include "NetworKitBinaryReader.h"
+#include "NetworKitBinaryFormat.h"
+#include "../auxiliary/MemoryMappedFile.h"
+
+namespace NetworKit {
+
+NetworKitBinaryReader::NetworKitBinaryReader(bool validate) : validate(validate) {
+}
+
+Graph NetworKitBinaryReader::read(const std::string& path) {
+	StaticGraph S = readStatic(path);
+	Graph G(S.upperNodeIdBound(), S.isWeighted(), S.isDirected());
+	for (node u = 0; u < S.upperNodeIdBound(); ++u) {
+		if (!S.hasNode(u)) {
+			G.removeNode(u);
+		}
+	}
+	S.forEdges([&](node u, node v, edgeweight w) {
+		G.addEdge(u, v, w);
+	});
+	if (S.hasEdgeIds()) {
+		G.indexEdges();
+	}
+	return G;
+}
+
+StaticGraph NetworKitBinaryReader::readStatic(const std::string& path) {
+	using namespace NetworKitBinaryFormat;
+
+	auto file = std::make_shared<Aux::MemoryMappedFile>(path);
+	auto fail = [&](const std::string& reason) {
+		throw std::runtime_error("invalid NetworKit binary graph file " + path + ": " + reason);
+	};
+
+	if (file->size() < sizeof(Header)) {
+		fail("file too short");
+	}
+	Header header;
+	std::memcpy(&header, file->data(), sizeof(header));
+	if (std::memcmp(header.magic, magic, sizeof(magic)) != 0) {
+		fail("wrong magic bytes");
+	}
+	if (header.byteOrder != byteOrderMark) {
+		fail("the file was written on a machine with a different byte order");
+	}
+	if (header.version != version) {
+		fail("unsupported version " + std::to_string(header.version));
+	}
+
+	const bool directed = header.flags & DIRECTED;
+	const bool weighted = header.flags & WEIGHTED;
+	const bool indexed = header.flags & EDGE_IDS;
+	const bool inEdges = header.flags & IN_EDGES;
+
+	// check that every section lies within the file and has the expected length
+	for (index i = 0; i < NUM_SECTIONS; ++i) {
+		const SectionEntry& section = header.sections[i];
+		if (section.offset % sizeof(uint64_t) != 0 || section.offset > file->size()
+				|| section.length > (file->size() - section.offset) / sizeof(uint64_t)) {
+			fail("section " + std::to_string(i) + " is out of bounds");
+		}
+	}
+	auto expectLength = [&](Section s, uint64_t length) {
+		if (header.sections[s].length != length) {
+			fail("section " + std::to_string(s) + " has the wrong length");
+		}
+	};
+	auto words = [&](Section s) {
+		return reinterpret_cast<const uint64_t*>(file->data() + header.sections[s].offset);
+	};
+	auto checkAdjacency = [&](Section offsets, Section targets, Section weights, Section ids) {
+		expectLength(offsets, header.z + 1);
+		const uint64_t* offset = words(offsets);
+		const uint64_t entries = offset[header.z];
+		expectLength(targets, entries);
+		expectLength(weights, weighted ? entries : 0);
+		expectLength(ids, indexed ? entries : 0);
+		if (!validate) {
+			return;
+		}
+
+		// O(n + m) check of the content, every node is checked by one thread
+		const uint64_t* exists = words(NODE_EXISTS);
+		const uint64_t* target = words(targets);
+		const uint64_t* id = indexed ? words(ids) : nullptr;
+		auto hasNode = [&](uint64_t u) {
+			return (exists[u / 64] >> (u % 64)) & 1;
+		};
+		if (offset[0] != 0) {
+			fail("section " + std::to_string(offsets) + " does not start at 0");
+		}
+		bool valid = true;
+		#pragma omp parallel for schedule(guided)
+		for (index u = 0; u < header.z; ++u) {
+			// the targets of u are only read if its offsets lie within the section
+			if (offset[u] > offset[u + 1] || offset[u + 1] > entries || (offset[u] != offset[u + 1] && !hasNode(u))) {
+				__atomic_store_n(&valid, false, __ATOMIC_RELAXED);
+				continue;
+			}
+			for (uint64_t i = offset[u]; i < offset[u + 1]; ++i) {
+				if (target[i] >= header.z || !hasNode(target[i]) || (indexed && id[i] >= header.omega)) {
+					__atomic_store_n(&valid, false, __ATOMIC_RELAXED);
+					break;
+				}
+			}
+		}
+		if (!valid) {
+			fail("the adjacency in sections " + std::to_string(offsets) + " to " + std::to_string(ids) + " is inconsistent");
+		}
+	};
+
+	if (header.z == std::numeric_limits<uint64_t>::max()) {
+		fail("the upper node id bound is too large");
+	}
+	const uint64_t existsWords = header.z / 64 + (header.z % 64 != 0);
+	expectLength(NODE_EXISTS, existsWords);
+	if (validate) {
+		uint64_t nodes = 0;
+		const uint64_t* exists = words(NODE_EXISTS);
+		for (index i = 0; i < existsWords; ++i) {
+			nodes += __builtin_popcountll(exists[i]);
+		}
+		if (header.z % 64 != 0 && (exists[existsWords - 1] >> (header.z % 64)) != 0) {
+			fail("nodes beyond the upper node id bound exist");
+		}
+		if (nodes != header.n) {
+			fail("the number of existing nodes differs from the header");
+		}
+	}
+	checkAdjacency(OUT_OFFSETS, OUT_TARGETS, OUT_WEIGHTS, OUT_EDGE_IDS);
+	if (inEdges) {
+		checkAdjacency(IN_OFFSETS, IN_TARGETS, IN_WEIGHTS, IN_EDGE_IDS);
+	} else {
+		for (Section s : {IN_OFFSETS, IN_TARGETS, IN_WEIGHTS, IN_EDGE_IDS}) {
+			expectLength(s, 0);
+		}
+	}
+
+	StaticGraph S;
+	S.n = header.n;
+	S.m = header.m;
+	S.z = header.z;
+	S.omega = header.omega;
+	S.directed = directed;
+	S.weighted = weighted;
+	S.edgesIndexed = indexed;
+	S.mapping = file;
+
+	auto view = [&](Section s, StaticArray<uint64_t>& array) {
+		array.view(words(s), header.sections[s].length);
+	};
+	auto viewWeights = [&](Section s, StaticArray<edgeweight>& array) {
+		array.view(reinterpret_cast<const edgeweight*>(words(s)), header.sections[s].length);
+	};
+	view(NODE_EXISTS, S.existsBits);
+	view(OUT_OFFSETS, S.outOffsets);
+	view(OUT_TARGETS, S.outTargets);
+	viewWeights(OUT_WEIGHTS, S.outWeights);
+	view(OUT_EDGE_IDS, S.outEdgeIds);
+	view(IN_OFFSETS, S.inOffsets);
+	view(IN_TARGETS, S.inTargets);
+	viewWeights(IN_WEIGHTS, S.inWeights);
+	view(IN_EDGE_IDS, S.inEdgeIds);
+	return S;
+}
+
+} /* namespace NetworKit */
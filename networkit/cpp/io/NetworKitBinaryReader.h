@@ -0,0 +1,57 @@
+/*
+ * NetworKitBinaryReader.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef NETWORKITBINARYREADER_H_
+#define NETWORKITBINARYREADER_H_
+
+#include <string>
+
+#include "GraphReader.h"
+#include "../graph/StaticGraph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Reads graphs in the native binary format written by NetworKitBinaryWriter.
+ *
+ * readStatic() maps the file into memory and returns a StaticGraph whose arrays point into
+ * the mapping, so loading takes time independent of the size of the graph: no data is parsed
+ * or copied, and pages are only loaded from disk when they are accessed. The mapping lives
+ * as long as the snapshot (or a copy of it) exists.
+ *
+ * By default, the content of the arrays is validated as well, which reads the whole file once
+ * in O(n + m): the offsets have to be monotone, the targets have to be existing nodes and the
+ * edge ids have to be smaller than the upper edge id bound. Without validation, only the
+ * structure of the file is checked and the arrays are trusted.
+ */
+class NetworKitBinaryReader : public GraphReader {
+
+public:
+
+	/**
+	 * @param validate Check the content of the arrays, not only the structure of the file.
+	 */
+	NetworKitBinaryReader(bool validate = true);
+
+	/**
+	 * Reads the graph at @a path into a (mutable) Graph. Node ids are preserved; if the file
+	 * contains edge ids, the edges of the returned graph are indexed anew.
+	 */
+	Graph read(const std::string& path) override;
+
+	/**
+	 * Maps the file at @a path and returns a snapshot backed by the mapping.
+	 */
+	StaticGraph readStatic(const std::string& path);
+
+private:
+	bool validate;
+};
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYREADER_H_ */
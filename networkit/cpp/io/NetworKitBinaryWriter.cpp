@@ -0,0 +1,72 @@
+/*
+ * NetworKitBinaryWriter.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <fstream>
+#include <cstring>
+
+#include "NetworKitBinaryWriter.h"
+#include "NetworKitBinaryFormat.h"
+#include "../auxiliary/Enforce.h"
+
+namespace NetworKit {
+
+void NetworKitBinaryWriter::write(const Graph& G, const std::string& path) {
+	StaticGraph S(G);
+	write(S, path);
+}
+
+template<class T>
+static void writeArray(std::ofstream& file, const StaticArray<T>& array) {
+	static_assert(sizeof(T) == 8, "all arrays consist of 64-bit words");
+	file.write(reinterpret_cast<const char*>(array.data()), array.size() * sizeof(T));
+}
+
+void NetworKitBinaryWriter::write(const StaticGraph& S, const std::string& path) {
+	using namespace NetworKitBinaryFormat;
+
+	Header header;
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, magic, sizeof(magic));
+	header.version = version;
+	header.byteOrder = byteOrderMark;
+	header.flags = (S.directed ? DIRECTED : 0) | (S.weighted ? WEIGHTED : 0) | (S.edgesIndexed ? EDGE_IDS : 0)
+			| (S.directed && !S.inOffsets.empty() ? IN_EDGES : 0);
+	header.n = S.n;
+	header.m = S.m;
+	header.z = S.z;
+	header.omega = S.omega;
+
+	const count lengths[NUM_SECTIONS] = {
+		S.existsBits.size(),
+		S.outOffsets.size(), S.outTargets.size(), S.outWeights.size(), S.outEdgeIds.size(),
+		S.inOffsets.size(), S.inTargets.size(), S.inWeights.size(), S.inEdgeIds.size()
+	};
+	uint64_t position = sizeof(Header);
+	for (index i = 0; i < NUM_SECTIONS; ++i) {
+		header.sections[i].offset = position;
+		header.sections[i].length = lengths[i];
+		position += lengths[i] * sizeof(uint64_t);
+	}
+
+	std::ofstream file(path, std::ios::binary | std::ios::out | std::ios::trunc);
+	Aux::enforceOpened(file);
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	writeArray(file, S.existsBits);
+	writeArray(file, S.outOffsets);
+	writeArray(file, S.outTargets);
+	writeArray(file, S.outWeights);
+	writeArray(file, S.outEdgeIds);
+	writeArray(file, S.inOffsets);
+	writeArray(file, S.inTargets);
+	writeArray(file, S.inWeights);
+	writeArray(file, S.inEdgeIds);
+	if (!file) {
+		throw std::runtime_error("error while writing " + path);
+	}
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,42 @@
+/*
+ * NetworKitBinaryWriter.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef NETWORKITBINARYWRITER_H_
+#define NETWORKITBINARYWRITER_H_
+
+#include <string>
+
+#include "GraphWriter.h"
+#include "../graph/StaticGraph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Writes graphs in the native binary format described in NetworKitBinaryFormat.h: a
+ * versioned header followed by the CSR arrays of a StaticGraph, which NetworKitBinaryReader
+ * maps into memory without parsing. Node ids and edge ids are preserved.
+ */
+class NetworKitBinaryWriter : public GraphWriter {
+
+public:
+
+	NetworKitBinaryWriter() = default; //nullary constructor for Python shell
+
+	/**
+	 * Writes @a G to the file at @a path. For directed graphs, the incoming edges are stored as well.
+	 */
+	void write(const Graph& G, const std::string& path) override;
+
+	/**
+	 * Writes the snapshot @a S to the file at @a path.
+	 */
+	void write(const StaticGraph& S, const std::string& path);
+};
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYWRITER_H_ */
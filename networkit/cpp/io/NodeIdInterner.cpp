@@ -0,0 +1,356 @@
+/*
+ * NodeIdInterner.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <omp.h>
+
+#include "NodeIdInterner.h"
+#include "../auxiliary/Log.h"
+#include "../auxiliary/Parallel.h"
+
+namespace NetworKit {
+
+const uint64_t NodeIdInterner::empty;
+const uint64_t NodeIdInterner::lengthBits;
+const uint64_t NodeIdInterner::localBits;
+const uint64_t NodeIdInterner::registerBits;
+
+NodeIdInterner::NodeIdInterner(bool integerKeys) : integerKeys(integerKeys), finalized(false), base(nullptr), numberOfKeys(0), mask(0) {
+}
+
+void NodeIdInterner::reset(const char* base) {
+	this->base = base;
+	finalized = false;
+	numberOfKeys = 0;
+	mask = 0;
+	locals.clear();
+	locals.resize(omp_get_max_threads());
+	for (LocalTable& local : locals) {
+		local.registers.assign(uint64_t(1) << registerBits, 0);
+	}
+	slots.clear();
+	slotValue.clear();
+	arena.clear();
+	arenaOffset.clear();
+	integerKeyOfNode.clear();
+}
+
+uint64_t NodeIdInterner::hash(uint64_t key) {
+	// finalizer of MurmurHash3
+	key ^= key >> 33;
+	key *= 0xff51afd7ed558ccdULL;
+	key ^= key >> 33;
+	key *= 0xc4ceb9fe1a85ec53ULL;
+	key ^= key >> 33;
+	return key;
+}
+
+uint64_t NodeIdInterner::hash(const char* begin, const char* end) {
+	// FNV-1a
+	uint64_t h = 0xcbf29ce484222325ULL;
+	for (const char* it = begin; it != end; ++it) {
+		h ^= static_cast<unsigned char>(*it);
+		h *= 0x100000001b3ULL;
+	}
+	return hash(h);
+}
+
+uint64_t NodeIdInterner::hashOfRef(uint64_t ref) const {
+	if (integerKeys) {
+		return hash(ref - 1);
+	}
+	const char* begin = base + ((ref - 1) >> lengthBits);
+	return hash(begin, begin + ((ref - 1) & ((uint64_t(1) << lengthBits) - 1)));
+}
+
+bool NodeIdInterner::sameKey(uint64_t ref, uint64_t other) const {
+	if (ref == other) {
+		return true;
+	}
+	if (integerKeys) {
+		return false;
+	}
+	const uint64_t length = (ref - 1) & ((uint64_t(1) << lengthBits) - 1);
+	return ((other - 1) & ((uint64_t(1) << lengthBits) - 1)) == length
+		&& std::memcmp(base + ((ref - 1) >> lengthBits), base + ((other - 1) >> lengthBits), length) == 0;
+}
+
+index NodeIdInterner::insertLocal(uint64_t h, uint64_t ref, index position) {
+	if (finalized) {
+		throw std::runtime_error("no keys can be inserted after finalize()");
+	}
+	const index t = omp_get_thread_num();
+	if (t >= locals.size()) {
+		throw std::runtime_error("more threads insert keys than reset() has prepared for");
+	}
+	LocalTable& local = locals[t];
+
+	// a load factor of at most 2/3 keeps the probe sequences short
+	if (3 * (local.refs.size() + 1) > 2 * local.table.size()) {
+		std::vector<index> table(std::max<count>(16, 2 * local.table.size()), 0);
+		const uint64_t tableMask = table.size() - 1;
+		for (index id = 0; id < local.refs.size(); ++id) {
+			index i = hashOfRef(local.refs[id]) & tableMask;
+			while (table[i] != 0) {
+				i = (i + 1) & tableMask;
+			}
+			table[i] = id + 1;
+		}
+		local.table.swap(table);
+	}
+
+	const uint64_t tableMask = local.table.size() - 1;
+	index i = h & tableMask;
+	for (; local.table[i] != 0; i = (i + 1) & tableMask) {
+		const index id = local.table[i] - 1;
+		if (sameKey(ref, local.refs[id])) {
+			local.positions[id] = std::min(local.positions[id], position);
+			return (t << localBits) | id;
+		}
+	}
+	const index id = local.refs.size();
+	if (id >= (uint64_t(1) << localBits)) {
+		throw std::runtime_error("too many node ids");
+	}
+	local.table[i] = id + 1;
+	local.refs.push_back(ref);
+	local.positions.push_back(position);
+
+	// the register of the key keeps the maximum rank of the first one bit after the register bits
+	const uint64_t rest = h << registerBits;
+	const uint8_t rank = rest == 0 ? 64 - registerBits + 1 : __builtin_clzll(rest) + 1;
+	uint8_t& reg = local.registers[h >> (64 - registerBits)];
+	reg = std::max(reg, rank);
+	return (t << localBits) | id;
+}
+
+index NodeIdInterner::insert(const char* begin, const char* end, index position) {
+	if (integerKeys) {
+		throw std::runtime_error("the interner expects integer keys");
+	}
+	const uint64_t length = end - begin;
+	if (length >= (uint64_t(1) << lengthBits)) {
+		throw std::runtime_error("node id is too long");
+	}
+	const uint64_t ref = ((static_cast<uint64_t>(begin - base) << lengthBits) | length) + 1;
+	return insertLocal(hash(begin, end), ref, position);
+}
+
+index NodeIdInterner::insert(uint64_t key, index position) {
+	if (!integerKeys) {
+		throw std::runtime_error("the interner expects string keys");
+	}
+	if (key + 1 == empty) {
+		throw std::runtime_error("node id is too large");
+	}
+	return insertLocal(hash(key), key + 1, position);
+}
+
+double NodeIdInterner::estimateDistinctKeys() const {
+	// HyperLogLog over the registers of all threads
+	const count m = uint64_t(1) << registerBits;
+	double sum = 0.0;
+	count zeros = 0;
+	for (index j = 0; j < m; ++j) {
+		uint8_t reg = 0;
+		for (const LocalTable& local : locals) {
+			reg = std::max(reg, local.registers[j]);
+		}
+		sum += std::ldexp(1.0, -static_cast<int>(reg));
+		zeros += (reg == 0);
+	}
+	const double alpha = 0.7213 / (1.0 + 1.079 / m);
+	const double estimate = alpha * m * m / sum;
+	if (estimate <= 2.5 * m && zeros > 0) {
+		// linear counting is more accurate for few keys
+		return m * std::log(static_cast<double>(m) / zeros);
+	}
+	return estimate;
+}
+
+std::pair<index, bool> NodeIdInterner::claim(uint64_t h, uint64_t ref, index position) {
+	index i = h & mask;
+	for (count probes = 0; probes <= mask; ++probes, i = (i + 1) & mask) {
+		uint64_t current = __atomic_load_n(&slots[i], __ATOMIC_ACQUIRE);
+		bool claimed = false;
+		if (current == empty && __atomic_compare_exchange_n(&slots[i], &current, ref, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+			current = ref;
+			claimed = true;
+		}
+		// current is the key of the slot now, either inserted by this or by another thread
+		if (sameKey(ref, current)) {
+			uint64_t first = __atomic_load_n(&slotValue[i], __ATOMIC_RELAXED);
+			while (position < first && !__atomic_compare_exchange_n(&slotValue[i], &first, position, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+			}
+			return std::make_pair(i, claimed);
+		}
+	}
+	return std::make_pair(none, false);
+}
+
+count NodeIdInterner::merge(count capacity) {
+	mask = capacity - 1;
+	slots.assign(capacity, empty);
+	slotValue.assign(capacity, none);
+	const count limit = 2 * capacity / 3;
+	count claimed = 0;
+	bool full = false;
+	for (LocalTable& local : locals) {
+		local.nodes.resize(local.refs.size());
+		#pragma omp parallel for schedule(guided) reduction(+:claimed)
+		for (index id = 0; id < local.refs.size(); ++id) {
+			// stop early once the table is too full, it is merged into a larger one anyway
+			if (__atomic_load_n(&full, __ATOMIC_RELAXED)) {
+				continue;
+			}
+			std::pair<index, bool> slot = claim(hashOfRef(local.refs[id]), local.refs[id], local.positions[id]);
+			if (slot.first == none) {
+				__atomic_store_n(&full, true, __ATOMIC_RELAXED);
+				continue;
+			}
+			local.nodes[id] = slot.first;
+			claimed += slot.second;
+		}
+		if (full || claimed > limit) {
+			return none;
+		}
+	}
+	return claimed;
+}
+
+count NodeIdInterner::finalize() {
+	if (finalized) {
+		return numberOfKeys;
+	}
+	count sumOfKeys = 0;
+	count maxKeys = 0;
+	for (LocalTable& local : locals) {
+		std::vector<index>().swap(local.table);
+		sumOfKeys += local.refs.size();
+		maxKeys = std::max<count>(maxKeys, local.refs.size());
+	}
+
+	// the keys of the threads overlap, so their sum is only an upper bound of the distinct keys
+	const double estimate = std::min<double>(sumOfKeys, std::max<double>(maxKeys, 1.1 * estimateDistinctKeys()));
+	count capacity = 16;
+	while (2 * capacity < 3 * estimate + 3) {
+		capacity *= 2;
+	}
+	count distinct;
+	while ((distinct = merge(capacity)) == none) {
+		DEBUG("node id table with ", capacity, " slots is too small");
+		capacity *= 2;
+	}
+	DEBUG("merged ", sumOfKeys, " keys of ", locals.size(), " threads into ", distinct, " distinct keys");
+
+	// collect the used slots and sort them by the first position of their key
+	std::vector<index> used;
+	#pragma omp parallel
+	{
+		std::vector<index> local;
+		#pragma omp for schedule(static)
+		for (index i = 0; i < slots.size(); ++i) {
+			if (slots[i] != empty) {
+				local.push_back(i);
+			}
+		}
+		#pragma omp critical
+		used.insert(used.end(), local.begin(), local.end());
+	}
+	Aux::Parallel::sort(used.begin(), used.end(), [&](index i, index j) {
+		return slotValue[i] < slotValue[j];
+	});
+	numberOfKeys = used.size();
+
+	#pragma omp parallel for
+	for (index u = 0; u < numberOfKeys; ++u) {
+		slotValue[used[u]] = u;
+	}
+	for (LocalTable& local : locals) {
+		#pragma omp parallel for
+		for (index id = 0; id < local.nodes.size(); ++id) {
+			local.nodes[id] = slotValue[local.nodes[id]];
+		}
+		std::vector<uint64_t>().swap(local.refs);
+		std::vector<uint64_t>().swap(local.positions);
+		std::vector<uint8_t>().swap(local.registers);
+	}
+
+	if (integerKeys) {
+		integerKeyOfNode.resize(numberOfKeys);
+		#pragma omp parallel for
+		for (index u = 0; u < numberOfKeys; ++u) {
+			integerKeyOfNode[u] = slots[used[u]] - 1;
+		}
+	} else {
+		arenaOffset.assign(numberOfKeys + 1, 0);
+		for (index u = 0; u < numberOfKeys; ++u) {
+			arenaOffset[u + 1] = arenaOffset[u] + ((slots[used[u]] - 1) & ((uint64_t(1) << lengthBits) - 1));
+		}
+		arena.resize(arenaOffset[numberOfKeys]);
+		#pragma omp parallel for
+		for (index u = 0; u < numberOfKeys; ++u) {
+			const uint64_t ref = slots[used[u]] - 1;
+			std::memcpy(arena.data() + arenaOffset[u], base + (ref >> lengthBits), arenaOffset[u + 1] - arenaOffset[u]);
+		}
+	}
+
+	// the text may be released now
+	base = nullptr;
+	finalized = true;
+	return numberOfKeys;
+}
+
+node NodeIdInterner::find(const std::string& key) const {
+	if (integerKeys) {
+		// only the canonical decimal representation of an integer key is found
+		if (key.empty() || key.size() > 20 || key.find_first_not_of("0123456789") != std::string::npos) {
+			return none;
+		}
+		try {
+			node u = find(static_cast<uint64_t>(std::stoull(key)));
+			return (u != none && this->key(u) == key) ? u : none;
+		} catch (std::out_of_range& e) {
+			return none;
+		}
+	}
+	if (!finalized) {
+		return none;
+	}
+	for (index i = hash(key.data(), key.data() + key.size()) & mask; slots[i] != empty; i = (i + 1) & mask) {
+		const node u = slotValue[i];
+		const count length = arenaOffset[u + 1] - arenaOffset[u];
+		if (length == key.size() && std::memcmp(arena.data() + arenaOffset[u], key.data(), length) == 0) {
+			return u;
+		}
+	}
+	return none;
+}
+
+node NodeIdInterner::find(uint64_t key) const {
+	if (!integerKeys || !finalized || key + 1 == empty) {
+		return none;
+	}
+	for (index i = hash(key) & mask; slots[i] != empty; i = (i + 1) & mask) {
+		if (slots[i] == key + 1) {
+			return slotValue[i];
+		}
+	}
+	return none;
+}
+
+std::string NodeIdInterner::key(node u) const {
+	if (integerKeys) {
+		return std::to_string(integerKeyOfNode[u]);
+	}
+	return std::string(arena.data() + arenaOffset[u], arena.data() + arenaOffset[u + 1]);
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,194 @@
+/*
+ * NodeIdInterner.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef NODEIDINTERNER_H_
+#define NODEIDINTERNER_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+#include "../Globals.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Maps the node ids of a file, either strings or 64-bit integers, to consecutive nodes.
+ *
+ * While a file is parsed, insert() may be called concurrently by the threads of an OpenMP team.
+ * Every thread interns its keys in its own open-addressing hash table with linear probing, which
+ * grows with the number of distinct keys the thread has seen. String keys are only referenced in
+ * the parsed text until finalize() copies them into one contiguous arena.
+ *
+ * finalize() merges the tables of the threads into one table, in which every slot is claimed with
+ * a single compare-and-swap. It is sized by a HyperLogLog estimate of the number of distinct keys
+ * and only grown if the estimate was too small, so its memory follows the number of distinct keys
+ * instead of the number of lines. The keys are numbered by their first position in the file, so the
+ * nodes do not depend on the number of threads.
+ */
+class NodeIdInterner final {
+
+public:
+	/**
+	 * @param[in]	integerKeys	keys are unsigned 64-bit integers instead of strings
+	 */
+	NodeIdInterner(bool integerKeys = false);
+
+	/**
+	 * Removes all keys. String keys are referenced as ranges in the text starting at @a base,
+	 * which has to stay valid until finalize() is called. Not thread-safe.
+	 */
+	void reset(const char* base = nullptr);
+
+	/**
+	 * Inserts the string key [@a begin, @a end) that appears at @a position of the text.
+	 * Safe to call concurrently from the threads of an OpenMP team.
+	 *
+	 * @return The id of the key, nodeOf() turns it into a node after finalize().
+	 */
+	index insert(const char* begin, const char* end, index position);
+
+	/**
+	 * Inserts the integer key @a key that appears at @a position of the text. Safe to call
+	 * concurrently from the threads of an OpenMP team.
+	 *
+	 * @return The id of the key, nodeOf() turns it into a node after finalize().
+	 */
+	index insert(uint64_t key, index position);
+
+	/**
+	 * Numbers the keys in the order of their first position and copies the string keys into
+	 * the arena. No keys can be inserted afterwards.
+	 *
+	 * @return The number of distinct keys.
+	 */
+	count finalize();
+
+	/**
+	 * @return The node of the key with the @a id returned by insert(), only valid after finalize().
+	 */
+	node nodeOf(index id) const {
+		return locals[id >> localBits].nodes[id & ((uint64_t(1) << localBits) - 1)];
+	}
+
+	/**
+	 * @return The number of distinct keys.
+	 */
+	count size() const {
+		return numberOfKeys;
+	}
+
+	/**
+	 * @return The number of slots of the hash table that maps the keys to nodes.
+	 */
+	count capacity() const {
+		return slots.size();
+	}
+
+	/**
+	 * @return True if the keys are integers.
+	 */
+	bool hasIntegerKeys() const {
+		return integerKeys;
+	}
+
+	/**
+	 * @return The node of @a key, none if @a key does not exist.
+	 */
+	node find(const std::string& key) const;
+
+	/**
+	 * @return The node of the integer key @a key, none if @a key does not exist.
+	 */
+	node find(uint64_t key) const;
+
+	/**
+	 * @return The key of node @a u, integer keys are converted to strings.
+	 */
+	std::string key(node u) const;
+
+	/**
+	 * @return The integer key of node @a u.
+	 */
+	uint64_t integerKey(node u) const {
+		return integerKeyOfNode[u];
+	}
+
+private:
+	static const uint64_t empty = 0;
+	static const uint64_t lengthBits = 24;
+	static const uint64_t localBits = 48;
+	static const uint64_t registerBits = 12;
+
+	/**
+	 * The keys a single thread has inserted, numbered by their local id.
+	 */
+	struct LocalTable {
+		std::vector<uint64_t> refs;			//!< key of every local id, see slots
+		std::vector<uint64_t> positions;	//!< first position of every local id
+		std::vector<node> nodes;			//!< slot of every local id during finalize(), its node afterwards
+		std::vector<index> table;			//!< local id + 1 in every slot, 0 for an empty slot
+		std::vector<uint8_t> registers;		//!< HyperLogLog registers of the hashes of the keys
+		char padding[64];					//!< keeps the tables of the threads on separate cache lines
+	};
+
+	bool integerKeys;
+	bool finalized;
+	const char* base;
+	count numberOfKeys;
+	uint64_t mask;
+
+	std::vector<LocalTable> locals;
+
+	/**
+	 * Keys of the slots, 0 for an empty slot. A string key is stored as its offset from base
+	 * and its length, an integer key as the integer plus one.
+	 */
+	std::vector<uint64_t> slots;
+
+	/** First position of the key in each slot while merging, its node after finalize(). */
+	std::vector<uint64_t> slotValue;
+
+	std::vector<char> arena;
+	std::vector<index> arenaOffset;
+	std::vector<uint64_t> integerKeyOfNode;
+
+	static uint64_t hash(const char* begin, const char* end);
+	static uint64_t hash(uint64_t key);
+
+	uint64_t hashOfRef(uint64_t ref) const;
+	bool sameKey(uint64_t ref, uint64_t other) const;
+
+	/**
+	 * Inserts the key @a ref with hash @a h into the table of the calling thread.
+	 */
+	index insertLocal(uint64_t h, uint64_t ref, index position);
+
+	/**
+	 * @return An estimate of the number of distinct keys of all threads.
+	 */
+	double estimateDistinctKeys() const;
+
+	/**
+	 * Merges the keys of all threads into a table with @a capacity slots.
+	 *
+	 * @return The number of distinct keys, or none if the table is too small.
+	 */
+	count merge(count capacity);
+
+	/**
+	 * Claims the first slot from @a h on that is empty or holds @a ref.
+	 *
+	 * @return The slot and whether it has been empty, none if the table is full.
+	 */
+	std::pair<index, bool> claim(uint64_t h, uint64_t ref, index position);
+};
+
+} /* namespace NetworKit */
+#endif /* NODEIDINTERNER_H_ */
@@ -0,0 +1,37 @@
+/*
+ * ParallelLineReader.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include "ParallelLineReader.h"
+
+namespace NetworKit {
+
+ParallelLineReader::ParallelLineReader(const std::string& path) : file(path) {
+	file.adviseSequential();
+}
+
+const char* ParallelLineReader::nextLine(const char* pos) const {
+	const char* lineEnd = std::find(pos, end(), '\n');
+	return (lineEnd == end()) ? end() : lineEnd + 1;
+}
+
+std::vector<const char*> ParallelLineReader::chunkBounds(const char* from, count chunks) const {
+	chunks = std::max<count>(chunks, 1);
+	const count length = end() - from;
+	std::vector<const char*> bounds(chunks + 1, end());
+	bounds[0] = from;
+	for (index i = 1; i < chunks; ++i) {
+		// move every split point to the beginning of the next line
+		const char* pos = std::max(from + (length * i) / chunks, bounds[i - 1]);
+		if (pos > from && *(pos - 1) != '\n') {
+			pos = nextLine(pos);
+		}
+		bounds[i] = pos;
+	}
+	return bounds;
+}
+
+} /* namespace NetworKit */
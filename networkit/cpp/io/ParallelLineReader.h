@@ -0,0 +1,83 @@
+/*
+ * ParallelLineReader.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef PARALLELLINEREADER_H_
+#define PARALLELLINEREADER_H_
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "../Globals.h"
+#include "../auxiliary/MemoryMappedFile.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Memory-maps a text file and splits it into line-aligned chunks that can be parsed by
+ * different threads. Lines are reported as character ranges into the mapping, without the
+ * line break (a trailing '\r' is removed as well), so no strings are copied.
+ */
+class ParallelLineReader final {
+
+public:
+	/**
+	 * Maps the file at @a path.
+	 */
+	ParallelLineReader(const std::string& path);
+
+	/** @return The first character of the file. */
+	const char* begin() const {
+		return file.data();
+	}
+
+	/** @return The position after the last character of the file. */
+	const char* end() const {
+		return file.data() + file.size();
+	}
+
+	/**
+	 * Skips the line starting at @a pos.
+	 *
+	 * @return The beginning of the next line, or end().
+	 */
+	const char* nextLine(const char* pos) const;
+
+	/**
+	 * Splits [@a from, end()) into @a chunks ranges that begin at the start of a line.
+	 * The chunk i is [bounds[i], bounds[i+1]), some chunks may be empty.
+	 *
+	 * @return The chunks.size() + 1 bounds.
+	 */
+	std::vector<const char*> chunkBounds(const char* from, count chunks) const;
+
+	/**
+	 * Calls @a handle(lineBegin, lineEnd) for every line in [@a from, @a to), in order.
+	 * @a from has to be the beginning of a line.
+	 */
+	template<typename L> static void forLines(const char* from, const char* to, L handle);
+
+private:
+	Aux::MemoryMappedFile file;
+};
+
+template<typename L>
+void ParallelLineReader::forLines(const char* from, const char* to, L handle) {
+	while (from < to) {
+		const char* lineEnd = std::find(from, to, '\n');
+		const char* next = (lineEnd == to) ? to : lineEnd + 1;
+		if (lineEnd > from && *(lineEnd - 1) == '\r') {
+			--lineEnd;
+		}
+		handle(from, lineEnd);
+		from = next;
+	}
+}
+
+} /* namespace NetworKit */
+#endif /* PARALLELLINEREADER_H_ */
@@ -9,9 +9,12 @@
 
 #include "IOGTest.h"
 
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <unordered_set>
 #include <vector>
+#include <omp.h>
 
 #include "../METISGraphReader.h"
 #include "../METISGraphWriter.h"
@@ -32,10 +35,14 @@
 #include "../GMLGraphReader.h"
 #include "../GraphToolBinaryReader.h"
 #include "../GraphToolBinaryWriter.h"
+#include "../NetworKitBinaryFormat.h"
+#include "../NetworKitBinaryReader.h"
+#include "../NetworKitBinaryWriter.h"
 #include "../../generators/ErdosRenyiGenerator.h"
 
 #include "../../community/GraphClusteringTools.h"
 #include "../../auxiliary/Log.h"
+#include "../../auxiliary/StringTools.h"
 #include "../../community/ClusteringGenerator.h"
 #include "../../structures/Partition.h"
 #include "../../community/Modularity.h"
@@ -387,6 +394,178 @@ TEST_F(IOGTest, testEdgeListReader) {
 
 }
 
+TEST_F(IOGTest, testParallelEdgeListReader) {
+	std::string path = "output/parallel.edgelist";
+	std::ofstream out(path);
+	out << "# comment\n";
+	for (index i = 0; i < 1000; ++i) {
+		out << 1 + (i * 7) % 300 << " " << 1 + (i * 13) % 300 << "\r\n";
+	}
+	out << "\n5 3\n3 5\n3 3\n3 3\n5 3";
+	out.close();
+
+	EdgeListReader reader(' ', 1);
+	Graph G = reader.read(path);
+	EXPECT_EQ(300u, G.numberOfNodes());
+	EXPECT_FALSE(G.isWeighted());
+	EXPECT_TRUE(G.hasEdge(2, 4));
+	EXPECT_TRUE(G.hasEdge(2, 2));
+
+	// same graph as adding the edges of the file one by one, including the order of the neighbors
+	Graph H(300);
+	std::ifstream in(path);
+	std::string line;
+	while (std::getline(in, line)) {
+		if (line.empty() || line[0] == '#') continue;
+		node u = std::stoul(Aux::StringTools::split(line, ' ')[0]) - 1;
+		node v = std::stoul(Aux::StringTools::split(line, ' ')[1]) - 1;
+		if (!H.hasEdge(u, v)) {
+			H.addEdge(u, v);
+		}
+	}
+	EXPECT_EQ(H.numberOfEdges(), G.numberOfEdges());
+	EXPECT_EQ(H.numberOfSelfLoops(), G.numberOfSelfLoops());
+	H.forNodes([&](node u) {
+		std::vector<node> expected, actual;
+		H.forNeighborsOf(u, [&](node v) { expected.push_back(v); });
+		G.forNeighborsOf(u, [&](node v) { actual.push_back(v); });
+		EXPECT_EQ(expected, actual);
+	});
+
+	// node ids are assigned in the order of their first appearance
+	EdgeListReader nonContinuous(' ', 1, "#", false, true);
+	Graph D = nonContinuous.read(path);
+	std::map<std::string, node> ids = nonContinuous.getNodeMap();
+	EXPECT_EQ(300u, D.numberOfNodes());
+	EXPECT_TRUE(D.isDirected());
+	EXPECT_EQ(0u, ids["1"]);
+	EXPECT_EQ(1u, ids["8"]);
+	EXPECT_TRUE(D.hasEdge(ids["5"], ids["3"]));
+	EXPECT_TRUE(D.hasEdge(ids["3"], ids["5"]));
+
+	out.open(path);
+	out << "1 2\n2 3 0.5\n";
+	out.close();
+	EXPECT_THROW(reader.read(path), std::runtime_error);
+}
+
+TEST_F(IOGTest, testNodeIdInterner) {
+	// sparse 64-bit ids, numbered by their first appearance
+	std::string path = "output/sparseids.edgelist";
+	std::ofstream out(path);
+	std::vector<uint64_t> ids;
+	for (index i = 0; i < 500; ++i) {
+		ids.push_back(18000000000000000000ULL - i * 1000003ULL);
+	}
+	for (index i = 0; i < 2000; ++i) {
+		out << ids[(i * 7) % 500] << "\t" << ids[(i * 11 + 3) % 500] << "\n";
+	}
+	out.close();
+
+	EdgeListReader stringReader('\t', 0, "#", false);
+	EdgeListReader integerReader('\t', 0, "#", false, false, true);
+	Graph G = stringReader.read(path);
+	Graph H = integerReader.read(path);
+	const NodeIdInterner& stringIds = stringReader.getNodeIds();
+	const NodeIdInterner& integerIds = integerReader.getNodeIds();
+	EXPECT_EQ(500u, G.numberOfNodes());
+	EXPECT_EQ(500u, stringIds.size());
+	EXPECT_EQ(500u, integerIds.size());
+	EXPECT_EQ(G.numberOfEdges(), H.numberOfEdges());
+
+	EXPECT_EQ(0u, stringIds.find(std::to_string(ids[0])));
+	EXPECT_EQ(1u, stringIds.find(std::to_string(ids[3])));
+	EXPECT_EQ(none, stringIds.find("42"));
+	EXPECT_EQ(1u, integerIds.find(ids[3]));
+	EXPECT_EQ(none, integerIds.find(uint64_t(42)));
+	EXPECT_EQ(none, integerIds.find("0" + std::to_string(ids[3])));
+	for (node u = 0; u < 500; ++u) {
+		EXPECT_EQ(stringIds.key(u), integerIds.key(u));
+		EXPECT_EQ(u, integerIds.find(integerIds.integerKey(u)));
+	}
+	G.forEdges([&](node u, node v) {
+		EXPECT_TRUE(H.hasEdge(u, v));
+	});
+
+	std::map<std::string, node> map = stringReader.getNodeMap();
+	EXPECT_EQ(500u, map.size());
+	for (auto& entry : map) {
+		EXPECT_EQ(entry.second, stringIds.find(entry.first));
+	}
+
+	// concurrent inserts of the same keys
+	std::string text = "a b c d a b e f";
+	NodeIdInterner interner;
+	interner.reset(text.data());
+	std::vector<index> textIds(8);
+	#pragma omp parallel for
+	for (index i = 0; i < 8; ++i) {
+		textIds[i] = interner.insert(text.data() + 2 * i, text.data() + 2 * i + 1, 2 * i);
+	}
+	EXPECT_EQ(6u, interner.finalize());
+	EXPECT_EQ(interner.nodeOf(textIds[0]), interner.nodeOf(textIds[4]));
+	EXPECT_EQ(5u, interner.nodeOf(textIds[7]));
+	EXPECT_EQ("e", interner.key(4));
+}
+
+TEST_F(IOGTest, testNodeIdInternerCapacity) {
+	// many lines with few distinct ids, the table must not be sized by the number of lines
+	std::string path = "output/fewids.edgelist";
+	std::ofstream out(path);
+	for (index i = 0; i < 200000; ++i) {
+		out << "id" << (i * 7) % 100 << " id" << (i * 13 + 5) % 100 << "\n";
+	}
+	out.close();
+
+	EdgeListReader reader(' ', 0, "#", false);
+	Graph G = reader.read(path);
+	const NodeIdInterner& ids = reader.getNodeIds();
+	EXPECT_EQ(100u, G.numberOfNodes());
+	EXPECT_EQ(100u, ids.size());
+	EXPECT_LE(ids.capacity(), 4 * ids.size());
+	EXPECT_EQ(0u, ids.find("id0"));
+	EXPECT_EQ(1u, ids.find("id5"));
+
+	// many distinct ids, each inserted twice by different threads
+	NodeIdInterner interner(true);
+	interner.reset();
+	const count n = 100000;
+	std::vector<index> inserted(2 * n);
+	#pragma omp parallel for
+	for (index i = 0; i < 2 * n; ++i) {
+		inserted[i] = interner.insert(uint64_t((i % n) * 1000003ULL), i);
+	}
+	EXPECT_EQ(n, interner.finalize());
+	EXPECT_GE(interner.capacity(), n + n / 2);
+	EXPECT_LE(interner.capacity(), 4 * n);
+	for (index i = 0; i < 2 * n; ++i) {
+		EXPECT_EQ(i % n, interner.nodeOf(inserted[i]));
+	}
+}
+
+TEST_F(IOGTest, testParallelMETISGraphReader) {
+	// the result must not depend on the number of threads
+	for (std::string path : {"input/jazz.graph", "input/PGPgiantcompo.graph", "input/lesmis.graph", "input/example.graph"}) {
+		METISGraphReader reader;
+		const int threads = omp_get_max_threads();
+		omp_set_num_threads(1);
+		Graph H = reader.read(path);
+		omp_set_num_threads(std::max(threads, 4));
+		Graph G = reader.read(path);
+		omp_set_num_threads(threads);
+
+		EXPECT_EQ(H.numberOfNodes(), G.numberOfNodes());
+		EXPECT_EQ(H.numberOfEdges(), G.numberOfEdges());
+		EXPECT_EQ(H.isWeighted(), G.isWeighted());
+		H.forNodes([&](node u) {
+			std::vector<std::pair<node, edgeweight>> expected, actual;
+			H.forNeighborsOf(u, [&](node v, edgeweight w) { expected.emplace_back(v, w); });
+			G.forNeighborsOf(u, [&](node v, edgeweight w) { actual.emplace_back(v, w); });
+			EXPECT_EQ(expected, actual);
+		});
+	}
+}
+
 TEST_F(IOGTest, testEdgeListPartitionReader) {
 	EdgeListPartitionReader reader(1);
 
@@ -698,6 +877,119 @@ TEST_F(IOGTest, testGraphToolBinaryWriterDirected) {
 	EXPECT_EQ(G.isWeighted(),Gread.isWeighted());
 }
 
+TEST_F(IOGTest, testNetworKitBinaryGraph) {
+	Aux::Random::setSeed(42, false);
+	Graph U = ErdosRenyiGenerator(100, 0.1).generate();
+	U.removeNode(3);
+	U.removeNode(99);
+	U.indexEdges();
+	Graph D(ErdosRenyiGenerator(100, 0.1, true).generate(), true, true);
+	D.forEdges([&](node u, node v) {
+		D.setWeight(u, v, Aux::Random::real());
+	});
+	D.removeNode(50);
+
+	NetworKitBinaryWriter writer;
+	NetworKitBinaryReader reader;
+	std::string path = "output/test.nkbg";
+	for (Graph* G : {&U, &D}) {
+		writer.write(*G, path);
+
+		StaticGraph S = reader.readStatic(path);
+		EXPECT_EQ(G->numberOfNodes(), S.numberOfNodes());
+		EXPECT_EQ(G->numberOfEdges(), S.numberOfEdges());
+		EXPECT_EQ(G->upperNodeIdBound(), S.upperNodeIdBound());
+		EXPECT_EQ(G->isDirected(), S.isDirected());
+		EXPECT_EQ(G->isWeighted(), S.isWeighted());
+		EXPECT_EQ(G->hasEdgeIds(), S.hasEdgeIds());
+		for (node u = 0; u < G->upperNodeIdBound(); ++u) {
+			EXPECT_EQ(G->hasNode(u), S.hasNode(u));
+		}
+		G->forNodes([&](node u) {
+			EXPECT_EQ(G->degreeOut(u), S.degreeOut(u));
+			EXPECT_EQ(G->degreeIn(u), S.degreeIn(u));
+		});
+		S.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+			EXPECT_TRUE(G->hasEdge(u, v));
+			EXPECT_EQ(G->weight(u, v), w);
+			if (G->hasEdgeIds()) {
+				EXPECT_EQ(G->edgeId(u, v), eid);
+			}
+		});
+		// a copy of the snapshot keeps the mapping alive
+		StaticGraph copy = S;
+		S = StaticGraph();
+		EXPECT_EQ(G->numberOfEdges(), copy.parallelSumForEdges([](node, node) { return 1.0; }));
+
+		Graph Gread = reader.read(path);
+		EXPECT_EQ(G->numberOfNodes(), Gread.numberOfNodes());
+		EXPECT_EQ(G->numberOfEdges(), Gread.numberOfEdges());
+		EXPECT_EQ(G->isDirected(), Gread.isDirected());
+		EXPECT_EQ(G->isWeighted(), Gread.isWeighted());
+		G->forEdges([&](node u, node v, edgeweight w) {
+			EXPECT_TRUE(Gread.hasEdge(u, v));
+			EXPECT_EQ(w, Gread.weight(u, v));
+		});
+	}
+
+	// files in other formats are rejected
+	EXPECT_THROW(reader.readStatic("input/jazz.graph"), std::runtime_error);
+}
+
+TEST_F(IOGTest, testNetworKitBinaryGraphValidation) {
+	using namespace NetworKitBinaryFormat;
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(100, 0.1, true).generate();
+	G.removeNode(50);
+	G.indexEdges();
+	std::string path = "output/corrupt.nkbg";
+	NetworKitBinaryWriter().write(G, path);
+
+	std::ifstream in(path, std::ios::binary);
+	const std::string original((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	in.close();
+	Header header;
+	std::memcpy(&header, original.data(), sizeof(header));
+
+	// overwrites word i of section s and returns whether the validating reader rejects the file
+	auto rejected = [&](Section s, index i, uint64_t value) {
+		std::string content = original;
+		std::memcpy(&content[header.sections[s].offset + i * sizeof(uint64_t)], &value, sizeof(value));
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		out.write(content.data(), content.size());
+		out.close();
+		EXPECT_NO_THROW(NetworKitBinaryReader(false).readStatic(path));
+		try {
+			NetworKitBinaryReader().readStatic(path);
+		} catch (std::runtime_error& e) {
+			return true;
+		}
+		return false;
+	};
+	const uint64_t* offsets = reinterpret_cast<const uint64_t*>(original.data() + header.sections[OUT_OFFSETS].offset);
+	EXPECT_TRUE(rejected(OUT_TARGETS, 0, header.z));
+	EXPECT_TRUE(rejected(OUT_TARGETS, 0, 50));
+	EXPECT_TRUE(rejected(IN_TARGETS, 1, uint64_t(1) << 40));
+	EXPECT_TRUE(rejected(OUT_EDGE_IDS, 2, header.omega));
+	EXPECT_TRUE(rejected(OUT_OFFSETS, 10, offsets[11] + 1));
+	EXPECT_TRUE(rejected(OUT_OFFSETS, 51, offsets[51] + 1));
+	EXPECT_TRUE(rejected(NODE_EXISTS, 0, 0));
+	EXPECT_TRUE(rejected(NODE_EXISTS, 1, ~uint64_t(0)));
+
+	// an unchanged file is accepted
+	EXPECT_FALSE(rejected(OUT_TARGETS, 0, reinterpret_cast<const uint64_t*>(original.data() + header.sections[OUT_TARGETS].offset)[0]));
+
+	// writing to an array of a mapped snapshot copies it instead of writing to the file
+	StaticGraph S = NetworKitBinaryReader().readStatic(path);
+	StaticArray<node> targets = S.getOutTargets();
+	const node first = targets[0];
+	targets[0] = first + 1;
+	EXPECT_EQ(first + 1, static_cast<const StaticArray<node>&>(targets)[0]);
+	EXPECT_EQ(first, S.getOutTargets()[0]);
+	EXPECT_EQ(first, NetworKitBinaryReader().readStatic(path).getOutTargets()[0]);
+	std::remove(path.c_str());
+}
+
 TEST_F(IOGTest, testGraphToolBinaryWriterWithDeletedNodesDirected) {
 	Graph G(10,false,true);
 	G.removeNode(0);
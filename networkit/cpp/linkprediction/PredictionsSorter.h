@@ -18,7 +18,7 @@ namespace NetworKit {
  * Allows the sorting of predictions by score or node-pair.
  */
 class PredictionsSorter {
-private:
+public:
   /**
    * Comparator used to sort predictions descendingly by score and on equality
    * ascendingly by node-pairs which means e.g. (0, 1) < (1, 1) and (0, 0) < (0, 1).
@@ -29,6 +29,7 @@ private:
     }
   } static ConcreteScoreComp; //!< Comparator instance for score-based comparison
 
+private:
   /**
    * Comparator used to sort predictions ascendingly by node-pairs.
    */
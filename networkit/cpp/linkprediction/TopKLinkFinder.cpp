@@ -0,0 +1,193 @@
+/*
+ * TopKLinkFinder.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include <algorithm>
+#include <omp.h>
+
+#include "TopKLinkFinder.h"
+#include "PredictionsSorter.h"
+#include "../auxiliary/Log.h"
+
+namespace NetworKit {
+
+TopKLinkFinder::TopKLinkFinder(const Graph& G, LinkPredictor& predictor, count batchSize) : G(G), predictor(predictor), batchSize(batchSize) {
+  if (G.isDirected()) {
+    throw std::invalid_argument("Only undirected graphs accepted.");
+  }
+}
+
+void TopKLinkFinder::forCandidateBatches(bool bothDirections, const std::function<void(std::vector<std::pair<node, node>>&)>& handle) {
+  const count z = G.upperNodeIdBound();
+  const count maxThreads = omp_get_max_threads();
+
+  // the number of paths of length 2 starting at a node bounds its number of candidates
+  std::vector<count> paths(z, 0);
+  G.parallelForNodes([&](node u) {
+    G.forNeighborsOf(u, [&](node w) {
+      paths[u] += G.degree(w);
+    });
+  });
+
+  // marks[t] is a bitset over the nodes, every thread clears the bits it has set
+  std::vector<std::vector<uint64_t>> marks(maxThreads);
+  std::vector<std::vector<std::pair<node, node>>> threadCandidates(maxThreads);
+  std::vector<std::pair<node, node>> candidates;
+
+  node begin = 0;
+  while (begin < z) {
+    node end = begin;
+    count batchPaths = 0;
+    do {
+      batchPaths += paths[end];
+      ++end;
+    } while (end < z && batchPaths + paths[end] <= batchSize);
+
+    #pragma omp parallel
+    {
+      const index t = omp_get_thread_num();
+      std::vector<uint64_t>& mark = marks[t];
+      if (mark.empty()) {
+        mark.assign((z + 63) / 64, 0);
+      }
+      auto testAndSet = [&](node v) {
+        const uint64_t bit = uint64_t(1) << (v % 64);
+        const bool wasSet = mark[v / 64] & bit;
+        mark[v / 64] |= bit;
+        return wasSet;
+      };
+      auto unset = [&](node v) {
+        mark[v / 64] &= ~(uint64_t(1) << (v % 64));
+      };
+      std::vector<node> found;
+
+      #pragma omp for schedule(dynamic, 16)
+      for (index u = begin; u < end; ++u) {
+        if (!G.hasNode(u)) {
+          continue;
+        }
+        // u and its neighbors are no candidates
+        testAndSet(u);
+        G.forNeighborsOf(u, [&](node w) {
+          testAndSet(w);
+        });
+        G.forNeighborsOf(u, [&](node w) {
+          G.forNeighborsOf(w, [&](node v) {
+            if (!testAndSet(v)) {
+              found.push_back(v);
+              if (bothDirections || u < v) {
+                threadCandidates[t].emplace_back(u, v);
+              }
+            }
+          });
+        });
+        unset(u);
+        G.forNeighborsOf(u, [&](node w) {
+          unset(w);
+        });
+        for (node v : found) {
+          unset(v);
+        }
+        found.clear();
+      }
+    }
+
+    candidates.clear();
+    for (index t = 0; t < maxThreads; ++t) {
+      candidates.insert(candidates.end(), threadCandidates[t].begin(), threadCandidates[t].end());
+      threadCandidates[t].clear();
+    }
+    DEBUG("scoring ", candidates.size(), " candidates of the nodes ", begin, " to ", end - 1);
+    if (!candidates.empty()) {
+      handle(candidates);
+    }
+    begin = end;
+  }
+}
+
+std::vector<LinkPredictor::prediction> TopKLinkFinder::findTopK(count k) {
+  std::vector<LinkPredictor::prediction> result;
+  if (k == 0) {
+    return result;
+  }
+  predictor.setGraph(G);
+  PredictionsSorter::ScoreComp better;
+
+  // every thread keeps a heap of its k best predictions with the worst one on top
+  std::vector<std::vector<LinkPredictor::prediction>> heaps(omp_get_max_threads());
+  forCandidateBatches(false, [&](std::vector<std::pair<node, node>>& candidates) {
+    std::vector<LinkPredictor::prediction> predictions = predictor.runOn(std::move(candidates));
+    #pragma omp parallel
+    {
+      std::vector<LinkPredictor::prediction>& heap = heaps[omp_get_thread_num()];
+      #pragma omp for schedule(static) nowait
+      for (index i = 0; i < predictions.size(); ++i) {
+        if (heap.size() < k) {
+          heap.push_back(predictions[i]);
+          std::push_heap(heap.begin(), heap.end(), better);
+        } else if (better(predictions[i], heap.front())) {
+          std::pop_heap(heap.begin(), heap.end(), better);
+          heap.back() = predictions[i];
+          std::push_heap(heap.begin(), heap.end(), better);
+        }
+      }
+    }
+  });
+
+  for (const auto& heap : heaps) {
+    result.insert(result.end(), heap.begin(), heap.end());
+  }
+  const count kept = std::min(k, static_cast<count>(result.size()));
+  std::partial_sort(result.begin(), result.begin() + kept, result.end(), better);
+  result.resize(kept);
+  return result;
+}
+
+std::vector<LinkPredictor::prediction> TopKLinkFinder::findTopKPerNode(count k) {
+  std::vector<LinkPredictor::prediction> result;
+  if (k == 0) {
+    return result;
+  }
+  predictor.setGraph(G);
+  PredictionsSorter::ScoreComp better;
+
+  forCandidateBatches(true, [&](std::vector<std::pair<node, node>>& candidates) {
+    std::vector<LinkPredictor::prediction> predictions = predictor.runOn(std::move(candidates));
+    if (!std::is_sorted(predictions.begin(), predictions.end(), [](const LinkPredictor::prediction& a, const LinkPredictor::prediction& b) {
+      return a.first < b.first;
+    })) {
+      PredictionsSorter::sortByNodePair(predictions);
+    }
+
+    // the predictions of a source node are contiguous, select the best k of each of them
+    std::vector<index> runBegin;
+    for (index i = 0; i < predictions.size(); ++i) {
+      if (i == 0 || predictions[i].first.first != predictions[i - 1].first.first) {
+        runBegin.push_back(i);
+      }
+    }
+    runBegin.push_back(predictions.size());
+    const count numRuns = runBegin.size() - 1;
+    std::vector<index> offset(numRuns + 1, result.size());
+    for (index r = 0; r < numRuns; ++r) {
+      offset[r + 1] = offset[r] + std::min(k, runBegin[r + 1] - runBegin[r]);
+    }
+    result.resize(offset[numRuns]);
+
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (index r = 0; r < numRuns; ++r) {
+      auto first = predictions.begin() + runBegin[r];
+      auto last = predictions.begin() + runBegin[r + 1];
+      auto middle = first + (offset[r + 1] - offset[r]);
+      std::partial_sort(first, middle, last, better);
+      std::copy(first, middle, result.begin() + offset[r]);
+    }
+  });
+
+  return result;
+}
+
+} // namespace NetworKit
@@ -0,0 +1,70 @@
+/*
+ * TopKLinkFinder.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef TOPKLINKFINDER_H_
+#define TOPKLINKFINDER_H_
+
+#include <functional>
+
+#include "LinkPredictor.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup linkprediction
+ *
+ * Finds the best scored missing links of a graph without scoring all node-pairs.
+ * Candidates are the node-pairs at distance 2, i.e. the pairs that would close a triangle,
+ * which are enumerated per source node in parallel. They are generated and scored in batches
+ * of bounded size by the runOn method of the given link predictor, and only the best k
+ * predictions are kept, either in total or per source node. Hence the memory needed does not
+ * grow with the number of candidates but with k.
+ */
+class TopKLinkFinder {
+private:
+  const Graph& G; //!< The graph to find missing links in
+
+  LinkPredictor& predictor; //!< Predictor used to score the candidates
+
+  count batchSize; //!< Approximate maximum number of candidates generated and scored at once
+
+  /**
+   * Enumerates all node-pairs (u, v) at distance 2 in batches of consecutive source nodes u and
+   * calls @a handle for every batch.
+   * @param bothDirections If set, (u, v) and (v, u) are generated, otherwise only pairs with u < v.
+   * @param handle Called with the candidates of a batch, which it may consume.
+   */
+  void forCandidateBatches(bool bothDirections, const std::function<void(std::vector<std::pair<node, node>>&)>& handle);
+
+public:
+  /**
+   * @param G The graph to find missing links in, it has to be undirected.
+   * @param predictor The link predictor to score the candidates with, it is set to work on @a G.
+   * @param batchSize Approximate maximum number of candidates generated and scored at once,
+   * a batch contains at least all candidates of one node.
+   */
+  TopKLinkFinder(const Graph& G, LinkPredictor& predictor, count batchSize = 1 << 22);
+
+  /**
+   * Returns the @a k best scored node-pairs (u, v) with u < v at distance 2.
+   * @param k Number of predictions to return
+   * @return at most @a k predictions, sorted descendingly by score like PredictionsSorter::sortByScore
+   */
+  std::vector<LinkPredictor::prediction> findTopK(count k);
+
+  /**
+   * Returns for every node u the @a k best scored node-pairs (u, v) at distance 2.
+   * @param k Number of predictions to return per node
+   * @return at most @a k predictions per node, ascendingly by u and for each u descendingly
+   * by score like PredictionsSorter::sortByScore
+   */
+  std::vector<LinkPredictor::prediction> findTopKPerNode(count k);
+};
+
+} // namespace NetworKit
+
+#endif /* TOPKLINKFINDER_H_ */
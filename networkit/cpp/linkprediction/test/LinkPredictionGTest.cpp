@@ -25,6 +25,10 @@
 #include "../NeighborsMeasureIndex.h"
 #include "../SameCommunityIndex.h"
 #include "../PredictionsSorter.h"
+#include "../TopKLinkFinder.h"
+#include "../AdamicAdarIndex.h"
+#include "../../generators/BarabasiAlbertGenerator.h"
+#include "../../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -188,6 +192,56 @@ TEST_F(LinkPredictionGTest, testKatzRunOnOrdering) {
   }
 }
 
+TEST_F(LinkPredictionGTest, testTopKLinkFinder) {
+  Aux::Random::setSeed(42, false);
+  Graph newG = BarabasiAlbertGenerator(3, 300).generate();
+  newG.removeNode(17); // node ids with gaps
+  CommonNeighborsIndex cn;
+  AdamicAdarIndex aa;
+  JaccardIndex jaccard;
+  std::vector<LinkPredictor*> predictors = {&cn, &aa, &jaccard};
+  const count k = 25;
+
+  for (LinkPredictor* predictor : predictors) {
+    predictor->setGraph(newG);
+    std::vector<LinkPredictor::prediction> all = predictor->runOn(MissingLinksFinder(newG).findAtDistance(2));
+    PredictionsSorter::sortByScore(all);
+    all.resize(k);
+
+    // a small batch size splits the candidates into many batches
+    for (count batchSize : {count(1) << 22, count(500)}) {
+      TopKLinkFinder finder(newG, *predictor, batchSize);
+      EXPECT_EQ(all, finder.findTopK(k));
+
+      std::vector<LinkPredictor::prediction> perNode = finder.findTopKPerNode(3);
+      index i = 0;
+      newG.forNodes([&](node u) {
+        std::vector<LinkPredictor::prediction> ofU = predictor->runOn(MissingLinksFinder(newG).findFromNode(u, 2));
+        PredictionsSorter::sortByScore(ofU);
+        ofU.resize(std::min<count>(3, ofU.size()));
+        for (const LinkPredictor::prediction& p : ofU) {
+          ASSERT_LT(i, perNode.size());
+          EXPECT_EQ(p, perNode[i]);
+          ++i;
+        }
+      });
+      EXPECT_EQ(i, perNode.size());
+    }
+  }
+
+  // Katz scores depend on the order of the calls because of its cache, so only the form is checked
+  KatzIndex katz;
+  std::vector<LinkPredictor::prediction> best = TopKLinkFinder(newG, katz).findTopK(k);
+  EXPECT_EQ(k, best.size());
+  EXPECT_TRUE(std::is_sorted(best.begin(), best.end(), [](const LinkPredictor::prediction& a, const LinkPredictor::prediction& b) {
+    return a.second > b.second;
+  }));
+
+  TopKLinkFinder finder(trainingGraph, cn);
+  EXPECT_TRUE(finder.findTopK(0).empty());
+  EXPECT_EQ(predictions, finder.findTopK(100));
+}
+
 } // namespace NetworKit
 
 #endif /* NOGTEST */
\ No newline at end of file
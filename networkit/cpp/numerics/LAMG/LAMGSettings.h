@@ -35,6 +35,9 @@ constexpr double SETUP_MAX_COARSE_RELAX_ACF = 0.3;
 
 constexpr count MAX_COMBINED_ITERATES = 4;
 
+// maximum number of right-hand sides that are carried through the solve cycles together
+constexpr count SOLVE_BLOCK_SIZE = 8;
+
 /**************************
  * SETUP - Elimination    *
  **************************/
@@ -8,10 +8,12 @@
 #ifndef NETWORKIT_CPP_NUMERICS_LAMG_LAMG_H_
 #define NETWORKIT_CPP_NUMERICS_LAMG_LAMG_H_
 
+#include <memory>
 #include <vector>
 
 #include "../LinearSolver.h"
 #include "MultiLevelSetup.h"
+#include "LevelHierarchyCache.h"
 #include "SolverLamg.h"
 #include "../GaussSeidelRelaxation.h"
 #include "../../algebraic/MatrixTools.h"
@@ -25,6 +27,10 @@ namespace NetworKit {
  * Represents the interface to the Lean Algebraic Multigrid (LAMG) graph Laplacian linear solver
  * by Oren E. Livne and Achi Brandt.
  * @see Livne, Oren E., and Achi Brandt. "Lean algebraic multigrid (LAMG): Fast graph Laplacian linear solver." SIAM Journal on Scientific Computing 34.4 (2012): B499-B522.
+ *
+ * The multigrid hierarchies are obtained from the LevelHierarchyCache, hence solvers that are set up for the same
+ * Laplacian share the setup, and it can be persisted across runs by setting a cache directory. Solvers that do not
+ * exist at the same time only share the setup if the cache retains hierarchies or has a directory.
  */
 template<class Matrix>
 class Lamg : public LinearSolver<Matrix> {
@@ -33,7 +39,7 @@ private:
 	GaussSeidelRelaxation<Matrix> smoother;
 	MultiLevelSetup<Matrix> lamgSetup;
 	Matrix laplacianMatrix;
-	std::vector<LevelHierarchy<Matrix>> compHierarchies;
+	std::vector<std::shared_ptr<const LevelHierarchy<Matrix>>> compHierarchies;
 	std::vector<SolverLamg<Matrix>> compSolvers;
 	std::vector<LAMGSolverStatus> compStati;
 
@@ -46,6 +52,8 @@ private:
 
 	void initializeForOneComponent();
 
+	void solveBlock(SolverLamg<Matrix>& solver, const std::vector<Vector>& rhs, std::vector<Vector>& results, index begin, index end, count maxConvergenceTime, count maxIterations);
+
 public:
 	/**
 	 * Construct a solver with the given @a tolerance. The relative residual ||Ax-b||/||b|| will be less than or equal to
@@ -87,6 +95,9 @@ public:
 	 * Compute the @a results for the matrix currently setup and the right-hand sides @a rhs.
 	 * The maximum spent time for each system can be specified by @a maxConvergenceTime and the maximum number of iterations can be set
 	 * by @a maxIterations.
+	 * The right-hand sides are solved in blocks of up to SOLVE_BLOCK_SIZE vectors that pass through the multigrid cycles
+	 * together (see SolverLamg::solve for blocks). If there are at least as many blocks as threads, every thread solves
+	 * whole blocks, otherwise the blocks are solved one after the other with parallel matrix products and smoothing.
 	 * @param rhs
 	 * @param results
 	 * @param maxConvergenceTime
@@ -98,10 +109,9 @@ public:
 
 template<class Matrix>
 void Lamg<Matrix>::initializeForOneComponent() {
-	compHierarchies = std::vector<LevelHierarchy<Matrix>>(1);
-	lamgSetup.setup(laplacianMatrix, compHierarchies[0]);
+	compHierarchies.assign(1, LevelHierarchyCache<Matrix>::get(laplacianMatrix, lamgSetup));
 	compSolvers.clear();
-	compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[0], smoother));
+	compSolvers.push_back(SolverLamg<Matrix>(*compHierarchies[0], smoother));
 	validSetup = true;
 }
 
@@ -128,7 +138,7 @@ void Lamg<Matrix>::setup(const Matrix& laplacianMatrix) {
 		rhsVectors = std::vector<Vector>(numComponents);
 
 		components = std::vector<std::vector<index>>(numComponents);
-		compHierarchies = std::vector<LevelHierarchy<Matrix>>(numComponents);
+		compHierarchies = std::vector<std::shared_ptr<const LevelHierarchy<Matrix>>>(numComponents);
 		compSolvers.clear();
 		compStati = std::vector<LAMGSolverStatus>(numComponents);
 
@@ -153,8 +163,8 @@ void Lamg<Matrix>::setup(const Matrix& laplacianMatrix) {
 			Matrix compMatrix(component.size(), component.size(), triplets);
 			initialVectors[compIdx] = Vector(component.size());
 			rhsVectors[compIdx] = Vector(component.size());
-			lamgSetup.setup(compMatrix, compHierarchies[compIdx]);
-			compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[compIdx], smoother));
+			compHierarchies[compIdx] = LevelHierarchyCache<Matrix>::get(compMatrix, lamgSetup);
+			compSolvers.push_back(SolverLamg<Matrix>(*compHierarchies[compIdx], smoother));
 			LAMGSolverStatus status;
 			status.desiredResidualReduction = this->tolerance * component.size() / G.numberOfNodes();
 			compStati[compIdx] = status;
@@ -194,7 +204,7 @@ SolverStatus Lamg<Matrix>::solve(const Vector& rhs, Vector& result, count maxCon
 				rhsVectors[i][graph2Components[element]] = rhs[element];
 			}
 
-			double resReduction = this->tolerance * rhsVectors[i].length() / (compHierarchies[i].at(0).getLaplacian() * initialVectors[i] - rhsVectors[i]).length();
+			double resReduction = this->tolerance * rhsVectors[i].length() / (compHierarchies[i]->at(0).getLaplacian() * initialVectors[i] - rhsVectors[i]).length();
 			compStati[i].desiredResidualReduction = resReduction * components[i].size() / laplacianMatrix.numberOfRows();
 			compStati[i].maxIters = maxIterations;
 			compStati[i].maxConvergenceTime = maxConvergenceTime;
@@ -215,33 +225,59 @@ SolverStatus Lamg<Matrix>::solve(const Vector& rhs, Vector& result, count maxCon
 	return status;
 }
 
+template<class Matrix>
+void Lamg<Matrix>::solveBlock(SolverLamg<Matrix>& solver, const std::vector<Vector>& rhs, std::vector<Vector>& results, index begin, index end, count maxConvergenceTime, count maxIterations) {
+	std::vector<Vector> x(results.begin() + begin, results.begin() + end);
+	std::vector<Vector> b(rhs.begin() + begin, rhs.begin() + end);
+	std::vector<LAMGSolverStatus> stati(end - begin);
+	for (index j = 0; j < stati.size(); ++j) {
+		stati[j].desiredResidualReduction = this->tolerance * b[j].length() / (laplacianMatrix * x[j] - b[j]).length();
+		stati[j].maxIters = maxIterations;
+		stati[j].maxConvergenceTime = maxConvergenceTime;
+	}
+
+	solver.solve(x, b, stati);
+	std::move(x.begin(), x.end(), results.begin() + begin);
+}
+
 template<class Matrix>
 void Lamg<Matrix>::parallelSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime, count maxIterations) {
 	if (numComponents == 1) {
 		assert(rhs.size() == results.size());
+		const count numBlocks = (rhs.size() + SOLVE_BLOCK_SIZE - 1) / SOLVE_BLOCK_SIZE;
 		const index numThreads = omp_get_max_threads();
-		if (compSolvers.size() != numThreads) {
-			compSolvers.clear();
+		compSolvers[0].colorLevels();
 
-			for (index i = 0; i < (index) numThreads; ++i) {
-				compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[0], smoother));
+		if (numBlocks < numThreads) { // parallelism within the blocks
+			for (index i = 0; i < numBlocks; ++i) {
+				solveBlock(compSolvers[0], rhs, results, i * SOLVE_BLOCK_SIZE, std::min(rhs.size(), (i+1) * SOLVE_BLOCK_SIZE), maxConvergenceTime, maxIterations);
+			}
+			return;
+		}
+
+		if (compSolvers.size() != numThreads) {
+			while (compSolvers.size() > 1) {
+				compSolvers.pop_back();
+			}
+			for (index i = 1; i < (index) numThreads; ++i) {
+				compSolvers.push_back(compSolvers[0]); // shares the colorings of the levels
 			}
 		}
 
 		bool nested = omp_get_nested();
 		if (nested) omp_set_nested(false);
 
-#pragma omp parallel for
-		for (index i = 0; i < rhs.size(); ++i) {
+#pragma omp parallel for schedule(dynamic, 1)
+		for (index i = 0; i < numBlocks; ++i) {
 			index threadId = omp_get_thread_num();
-			LAMGSolverStatus stat;
-			stat.desiredResidualReduction = this->tolerance * rhs[i].length() / (laplacianMatrix * results[i] - rhs[i]).length();
-			stat.maxIters = maxIterations;
-			stat.maxConvergenceTime = maxConvergenceTime;
-			compSolvers[threadId].solve(results[i], rhs[i], stat);
+			solveBlock(compSolvers[threadId], rhs, results, i * SOLVE_BLOCK_SIZE, std::min(rhs.size(), (i+1) * SOLVE_BLOCK_SIZE), maxConvergenceTime, maxIterations);
 		}
 
 		if (nested) omp_set_nested(true);
+	} else {
+		for (index i = 0; i < rhs.size(); ++i) {
+			solve(rhs[i], results[i], maxConvergenceTime, maxIterations);
+		}
 	}
 }
 
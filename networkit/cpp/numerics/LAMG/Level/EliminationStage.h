@@ -26,6 +26,7 @@ private:
 
 public:
 	EliminationStage(const Matrix& P, const Vector& q, const std::vector<index>& fSet, const std::vector<index>& cSet) : P(P), R(P.transpose()), q(q), fSet(fSet), cSet(cSet) {}
+	EliminationStage(const Matrix& P, const Matrix& R, const Vector& q, const std::vector<index>& fSet, const std::vector<index>& cSet) : P(P), R(R), q(q), fSet(fSet), cSet(cSet) {}
 
 	inline const Matrix& getP() const {
 		return P;
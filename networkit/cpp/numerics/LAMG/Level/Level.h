@@ -8,6 +8,7 @@
 #ifndef LEVEL_H_
 #define LEVEL_H_
 
+#include <vector>
 #include "../../../algebraic/CSRMatrix.h"
 
 namespace NetworKit {
@@ -18,6 +19,29 @@ enum LevelType {FINEST, // original problem
 	COARSEST // coarsest level
 };
 
+/**
+ * @ingroup numerics
+ * Computes Y[j] = A * X[j] for all vectors of the block @a X. Every row of @a A is read once for all vectors.
+ */
+template<class Matrix>
+void blockMultiply(const Matrix& A, const std::vector<Vector>& X, std::vector<Vector>& Y) {
+	const count numVectors = X.size();
+	Y.resize(numVectors);
+	for (index j = 0; j < numVectors; ++j) {
+		assert(X[j].getDimension() == A.numberOfColumns());
+		Y[j] = Vector(A.numberOfRows(), 0.0);
+	}
+
+#pragma omp parallel for schedule(guided)
+	for (index i = 0; i < A.numberOfRows(); ++i) {
+		A.forNonZeroElementsInRow(i, [&](index k, double value) {
+			for (index j = 0; j < numVectors; ++j) {
+				Y[j][i] += value * X[j][k];
+			}
+		});
+	}
+}
+
 /**
  * @ingroup numerics
  * Abstract base class for an LAMG Level.
@@ -50,6 +74,44 @@ public:
 	virtual void interpolate(const Vector& /*xc*/, Vector& /*xf*/) const {}
 
 	virtual void interpolate(const Vector& /*xc*/, Vector& /*xf*/, const std::vector<Vector>& /*bStages*/) const {}
+
+	// block versions for several vectors at once, bStages[j] holds the stages of vector j
+
+	virtual void coarseType(const std::vector<Vector>& xf, std::vector<Vector>& xc) const {
+		xc.resize(xf.size());
+		for (index j = 0; j < xf.size(); ++j) {
+			coarseType(xf[j], xc[j]);
+		}
+	}
+
+	virtual void restrict(const std::vector<Vector>& bf, std::vector<Vector>& bc) const {
+		bc.resize(bf.size());
+		for (index j = 0; j < bf.size(); ++j) {
+			restrict(bf[j], bc[j]);
+		}
+	}
+
+	virtual void restrict(const std::vector<Vector>& bf, std::vector<Vector>& bc, std::vector<std::vector<Vector>>& bStages) const {
+		bc.resize(bf.size());
+		bStages.resize(bf.size());
+		for (index j = 0; j < bf.size(); ++j) {
+			restrict(bf[j], bc[j], bStages[j]);
+		}
+	}
+
+	virtual void interpolate(const std::vector<Vector>& xc, std::vector<Vector>& xf) const {
+		xf.resize(xc.size());
+		for (index j = 0; j < xc.size(); ++j) {
+			interpolate(xc[j], xf[j]);
+		}
+	}
+
+	virtual void interpolate(const std::vector<Vector>& xc, std::vector<Vector>& xf, const std::vector<std::vector<Vector>>& bStages) const {
+		xf.resize(xc.size());
+		for (index j = 0; j < xc.size(); ++j) {
+			interpolate(xc[j], xf[j], bStages[j]);
+		}
+	}
 };
 
 
@@ -24,11 +24,23 @@ private:
 public:
 	LevelAggregation(const Matrix& A, const Matrix& P, const Matrix& R) : Level<Matrix>(LevelType::AGGREGATION, A), P(P), R(R) {}
 
+	inline const Matrix& getP() const {
+		return P;
+	}
+
+	inline const Matrix& getR() const {
+		return R;
+	}
+
 	void coarseType(const Vector& xf, Vector& xc) const;
 
 	void restrict(const Vector& bf, Vector& bc) const;
 
 	void interpolate(const Vector& xc, Vector& xf) const;
+
+	void restrict(const std::vector<Vector>& bf, std::vector<Vector>& bc) const;
+
+	void interpolate(const std::vector<Vector>& xc, std::vector<Vector>& xf) const;
 };
 
 template<class Matrix>
@@ -46,6 +58,16 @@ void LevelAggregation<Matrix>::interpolate(const Vector& xc, Vector& xf) const {
 	xf = P * xc;
 }
 
+template<class Matrix>
+void LevelAggregation<Matrix>::restrict(const std::vector<Vector>& bf, std::vector<Vector>& bc) const {
+	blockMultiply(R, bf, bc);
+}
+
+template<class Matrix>
+void LevelAggregation<Matrix>::interpolate(const std::vector<Vector>& xc, std::vector<Vector>& xf) const {
+	blockMultiply(P, xc, xf);
+}
+
 } /* namespace NetworKit */
 
 #endif /* LEVELAGGREGATION_H_ */
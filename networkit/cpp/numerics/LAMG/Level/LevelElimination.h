@@ -27,9 +27,16 @@ private:
 public:
 	LevelElimination(const Matrix& A, const std::vector<EliminationStage<Matrix>>& coarseningStages);
 
+	inline const std::vector<EliminationStage<Matrix>>& getStages() const {
+		return coarseningStages;
+	}
+
 	void coarseType(const Vector& xf, Vector& xc) const;
 	void restrict(const Vector& bf, Vector& bc, std::vector<Vector>& bStages) const;
 	void interpolate(const Vector& xc, Vector& xf, const std::vector<Vector>& bStages) const;
+
+	void restrict(const std::vector<Vector>& bf, std::vector<Vector>& bc, std::vector<std::vector<Vector>>& bStages) const;
+	void interpolate(const std::vector<Vector>& xc, std::vector<Vector>& xf, const std::vector<std::vector<Vector>>& bStages) const;
 };
 
 template<class Matrix>
@@ -110,6 +117,68 @@ void LevelElimination<Matrix>::interpolate(const Vector& xc, Vector& xf, const s
 	}
 }
 
+template<class Matrix>
+void LevelElimination<Matrix>::restrict(const std::vector<Vector>& bf, std::vector<Vector>& bc, std::vector<std::vector<Vector>>& bStages) const {
+	const count numVectors = bf.size();
+	bStages.assign(numVectors, std::vector<Vector>(coarseningStages.size() + 1));
+	bc = bf;
+	for (index j = 0; j < numVectors; ++j) {
+		bStages[j][0] = bf[j];
+	}
+
+	std::vector<Vector> bCSet(numVectors);
+	std::vector<Vector> bFSet(numVectors);
+	std::vector<Vector> rbFSet;
+	index curStage = 0;
+	for (const EliminationStage<Matrix>& s : coarseningStages) {
+		for (index j = 0; j < numVectors; ++j) {
+			subVectorExtract(bCSet[j], bc[j], s.getCSet());
+			subVectorExtract(bFSet[j], bc[j], s.getFSet());
+		}
+
+		blockMultiply(s.getR(), bFSet, rbFSet);
+		for (index j = 0; j < numVectors; ++j) {
+			bc[j] = bCSet[j] + rbFSet[j];
+			bStages[j][curStage+1] = bc[j]; // b = b.c + s.P^T * b.f
+		}
+
+		curStage++;
+	}
+}
+
+template<class Matrix>
+void LevelElimination<Matrix>::interpolate(const std::vector<Vector>& xc, std::vector<Vector>& xf, const std::vector<std::vector<Vector>>& bStages) const {
+	const count numVectors = xc.size();
+	std::vector<Vector> currX = xc;
+	std::vector<Vector> pX;
+	Vector bFSet;
+	xf.resize(numVectors);
+	for (index k = coarseningStages.size(); k-- > 0;) {
+		const EliminationStage<Matrix>& s = coarseningStages[k];
+		const Vector &q = s.getQ();
+		const std::vector<index> &fSet = s.getFSet();
+		const std::vector<index> &cSet = s.getCSet();
+		blockMultiply(s.getP(), currX, pX);
+
+		for (index j = 0; j < numVectors; ++j) {
+			xf[j] = Vector(s.getN());
+			subVectorExtract(bFSet, bStages[j][k], fSet);
+
+#pragma omp parallel for
+			for (index i = 0; i < fSet.size(); ++i) { // x.f = s.P * x.c + s.q .* b.f
+				xf[j][fSet[i]] = pX[j][i] + q[i] * bFSet[i];
+			}
+
+#pragma omp parallel for
+			for (index i = 0; i < cSet.size(); ++i) {
+				xf[j][cSet[i]] = currX[j][i];
+			}
+		}
+
+		currX = xf;
+	}
+}
+
 template<class Matrix>
 void LevelElimination<Matrix>::subVectorExtract(Vector& subVector, const Vector& vector, const std::vector<index>& elements) const {
 	subVector = Vector(elements.size());
@@ -8,17 +8,187 @@
 #ifndef LEVELHIERARCHY_H_
 #define LEVELHIERARCHY_H_
 
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
 #include "Level/Level.h"
 #include "Level/LevelFinest.h"
 #include "Level/LevelElimination.h"
 #include "Level/LevelAggregation.h"
 #include "LAMGSettings.h"
 #include "../../algebraic/DenseMatrix.h"
+#include "../../auxiliary/Enforce.h"
+#include "../../auxiliary/MemoryMappedFile.h"
 
 namespace NetworKit {
 
+/**
+ * Layout of the files written by LevelHierarchy::save.
+ *
+ * The file starts with a Header, followed by the levels from the finest to the coarsest and the LU
+ * decomposition of the coarsest level. Everything is stored as 64-bit words (indices and counts as
+ * unsigned integers, matrix entries as IEEE 754 doubles) in the byte order of the writing machine.
+ * A sparse matrix is stored by its dimensions, its sortedness, its zero and its CSR arrays, an array
+ * by its length followed by its elements.
+ */
+namespace LevelHierarchyFormat {
+
+/** Magic bytes at the start of every file. */
+static const char magic[8] = {'N', 'K', 'L', 'A', 'M', 'G', 'H', 'Y'};
+
+/** Version of the layout, incremented on incompatible changes and changes of the setup. */
+static const uint64_t version = 1;
+
+/** Written as a 64-bit word to detect files of a different byte order. */
+static const uint64_t byteOrderMark = 0x0102030405060708ULL;
+
+struct Header {
+	char magic[8];
+	uint64_t version;
+	uint64_t byteOrder;
+	uint64_t key; //!< key the hierarchy has been saved under, usually the fingerprint of the finest Laplacian
+	uint64_t numLevels;
+};
+
+static_assert(sizeof(Header) % 8 == 0, "the words following the header have to be 8-byte aligned");
+
+/** Appends 64-bit words to a file. */
+class Writer {
+private:
+	std::ofstream& file;
+
+public:
+	Writer(std::ofstream& file) : file(file) {}
+
+	void word(uint64_t w) {
+		file.write(reinterpret_cast<const char*>(&w), sizeof(w));
+	}
+
+	void real(double d) {
+		static_assert(sizeof(double) == sizeof(uint64_t), "doubles are stored as 64-bit words");
+		file.write(reinterpret_cast<const char*>(&d), sizeof(d));
+	}
+
+	template<class T>
+	void array(const std::vector<T>& values) {
+		static_assert(sizeof(T) == sizeof(uint64_t), "arrays consist of 64-bit words");
+		word(values.size());
+		file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+	}
+
+	template<class Matrix>
+	void matrix(const Matrix& A) {
+		word(A.numberOfRows());
+		word(A.numberOfColumns());
+		word(A.sorted());
+		real(A.getZero());
+		std::vector<index> rowIdx(A.numberOfRows() + 1, 0);
+		for (index i = 0; i < A.numberOfRows(); ++i) {
+			rowIdx[i + 1] = rowIdx[i] + A.nnzInRow(i);
+		}
+		std::vector<index> columnIdx;
+		std::vector<double> nonZeros;
+		columnIdx.reserve(rowIdx.back());
+		nonZeros.reserve(rowIdx.back());
+		A.forNonZeroElementsInRowOrder([&](index, index j, double value) {
+			columnIdx.push_back(j);
+			nonZeros.push_back(value);
+		});
+		array(rowIdx);
+		array(columnIdx);
+		array(nonZeros);
+	}
+};
+
+/** Reads 64-bit words from a memory mapped file, throws std::runtime_error when reading past its end. */
+class Reader {
+private:
+	const std::string& path;
+	const char* position;
+	const char* end;
+
+public:
+	Reader(const std::string& path, const Aux::MemoryMappedFile& file) : path(path), position(file.data()), end(file.data() + file.size()) {}
+
+	[[noreturn]] void fail(const std::string& reason) const {
+		throw std::runtime_error("invalid LAMG hierarchy file " + path + ": " + reason);
+	}
+
+	void bytes(void* target, uint64_t length) {
+		if (length > (uint64_t) (end - position)) {
+			fail("unexpected end of file");
+		}
+		if (length > 0) {
+			std::memcpy(target, position, length);
+		}
+		position += length;
+	}
+
+	uint64_t word() {
+		uint64_t w;
+		bytes(&w, sizeof(w));
+		return w;
+	}
+
+	double real() {
+		double d;
+		bytes(&d, sizeof(d));
+		return d;
+	}
+
+	template<class T>
+	std::vector<T> array() {
+		const uint64_t length = word();
+		if (length > (uint64_t) (end - position) / sizeof(T)) {
+			fail("array exceeds the file");
+		}
+		std::vector<T> values(length);
+		bytes(values.data(), length * sizeof(T));
+		return values;
+	}
+
+	template<class Matrix>
+	Matrix matrix() {
+		const count nRows = word();
+		const count nCols = word();
+		const bool sorted = word();
+		const double zero = real();
+		std::vector<index> rowIdx = array<index>();
+		std::vector<index> columnIdx = array<index>();
+		std::vector<double> nonZeros = array<double>();
+		if (rowIdx.size() != nRows + 1 || rowIdx[0] != 0 || rowIdx.back() != columnIdx.size() || columnIdx.size() != nonZeros.size()) {
+			fail("inconsistent matrix");
+		}
+		for (index i = 0; i < nRows; ++i) {
+			if (rowIdx[i] > rowIdx[i + 1]) {
+				fail("inconsistent matrix");
+			}
+		}
+		for (index j : columnIdx) {
+			if (j >= nCols) {
+				fail("column index out of range");
+			}
+		}
+		return Matrix(nRows, nCols, std::move(rowIdx), std::move(columnIdx), std::move(nonZeros), zero, sorted);
+	}
+
+	bool atEnd() const {
+		return position == end;
+	}
+};
+
+} /* namespace LevelHierarchyFormat */
+
 /**
  * @ingroup numerics
+ * The levels of the LAMG multigrid hierarchy, from the finest level (the original Laplacian) to the coarsest
+ * one whose LU decomposition is stored. The hierarchy is not modified by the solver, so one hierarchy can be
+ * shared by several solvers and threads. It can be saved to a file and loaded again to skip the setup, see
+ * LevelHierarchyCache.
  */
 template<class Matrix>
 class LevelHierarchy {
@@ -39,7 +209,7 @@ public:
 	void addEliminationLevel(const Matrix& A, const std::vector<EliminationStage<Matrix>>& coarseningStages);
 	void addAggregationLevel(const Matrix& A, const Matrix& P, const Matrix& R);
 	void setLastAsCoarsest();
-	inline DenseMatrix& getCoarseMatrix() {
+	inline const DenseMatrix& getCoarseMatrix() const {
 		return coarseLUMatrix;
 	}
 
@@ -48,8 +218,24 @@ public:
 	}
 
 	LevelType getType(index levelIdx) const;
-	Level<Matrix>& at(index levelIdx);
-	double cycleIndex(index levelIdx);
+	const Level<Matrix>& at(index levelIdx) const;
+	double cycleIndex(index levelIdx) const;
+
+	/**
+	 * Writes the hierarchy to the file at @a path, tagged with @a key. The file is written to a temporary
+	 * file next to @a path first and then renamed, so concurrent readers never see a partial file.
+	 * @param path
+	 * @param key Usually the fingerprint of the finest Laplacian, see LevelHierarchyCache::fingerprint.
+	 */
+	void save(const std::string& path, uint64_t key) const;
+
+	/**
+	 * Reads a hierarchy written by save() from a memory mapping of the file at @a path. Throws
+	 * std::runtime_error if the file is invalid or has been written with a different version.
+	 * @param path
+	 * @param key[out] The key the hierarchy has been saved under.
+	 */
+	static LevelHierarchy<Matrix> load(const std::string& path, uint64_t& key);
 };
 
 template<class Matrix>
@@ -102,7 +288,7 @@ LevelType LevelHierarchy<Matrix>::getType(index levelIdx) const {
 }
 
 template<class Matrix>
-Level<Matrix>& LevelHierarchy<Matrix>::at(index levelIdx) {
+const Level<Matrix>& LevelHierarchy<Matrix>::at(index levelIdx) const {
 	assert(levelIdx >= 0 && levelIdx < this->size());
 
 	if (levelIdx == 0) { // finest level
@@ -119,7 +305,7 @@ Level<Matrix>& LevelHierarchy<Matrix>::at(index levelIdx) {
 }
 
 template<class Matrix>
-double LevelHierarchy<Matrix>::cycleIndex(index levelIdx) {
+double LevelHierarchy<Matrix>::cycleIndex(index levelIdx) const {
 	double gamma = 1.0;
 	if (getType(levelIdx+1) != ELIMINATION) {
 		count finestNumEdges = finestLevel.getLaplacian().nnz();
@@ -136,6 +322,154 @@ double LevelHierarchy<Matrix>::cycleIndex(index levelIdx) {
 	return gamma;
 }
 
+template<class Matrix>
+void LevelHierarchy<Matrix>::save(const std::string& path, uint64_t key) const {
+	using namespace LevelHierarchyFormat;
+
+	Header header;
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, magic, sizeof(magic));
+	header.version = version;
+	header.byteOrder = byteOrderMark;
+	header.key = key;
+	header.numLevels = size();
+
+	// unique per process and hierarchy, so concurrent writers of the same path do not interfere
+	const std::string tmpPath = path + ".tmp." + std::to_string(getpid()) + "." + std::to_string((uintptr_t) this);
+	{
+		std::ofstream file(tmpPath, std::ios::binary | std::ios::out | std::ios::trunc);
+		Aux::enforceOpened(file);
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		Writer out(file);
+		out.matrix(finestLevel.getLaplacian());
+		for (index k = 0; k < levelType.size(); ++k) {
+			out.word(levelType[k]);
+			if (levelType[k] == ELIMINATION) {
+				const LevelElimination<Matrix>& level = eliminationLevels[levelIndex[k]];
+				out.matrix(level.getLaplacian());
+				out.word(level.getStages().size());
+				for (const EliminationStage<Matrix>& stage : level.getStages()) {
+					out.matrix(stage.getP());
+					out.matrix(stage.getR());
+					std::vector<double> q(stage.getQ().getDimension());
+					for (index i = 0; i < q.size(); ++i) {
+						q[i] = stage.getQ()[i];
+					}
+					out.array(q);
+					out.array(stage.getFSet());
+					out.array(stage.getCSet());
+				}
+			} else {
+				const LevelAggregation<Matrix>& level = aggregationLevels[levelIndex[k]];
+				out.matrix(level.getLaplacian());
+				out.matrix(level.getP());
+				out.matrix(level.getR());
+			}
+		}
+		out.word(coarseLUMatrix.numberOfRows());
+		out.word(coarseLUMatrix.numberOfColumns());
+		out.real(coarseLUMatrix.getZero());
+		std::vector<double> entries;
+		entries.reserve(coarseLUMatrix.numberOfRows() * coarseLUMatrix.numberOfColumns());
+		for (index i = 0; i < coarseLUMatrix.numberOfRows(); ++i) {
+			for (index j = 0; j < coarseLUMatrix.numberOfColumns(); ++j) {
+				entries.push_back(coarseLUMatrix(i, j));
+			}
+		}
+		out.array(entries);
+		if (!file) {
+			throw std::runtime_error("error while writing " + tmpPath);
+		}
+	}
+	if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+		std::remove(tmpPath.c_str());
+		throw std::runtime_error("could not rename " + tmpPath + " to " + path);
+	}
+}
+
+template<class Matrix>
+LevelHierarchy<Matrix> LevelHierarchy<Matrix>::load(const std::string& path, uint64_t& key) {
+	using namespace LevelHierarchyFormat;
+
+	Aux::MemoryMappedFile file(path);
+	file.adviseSequential();
+	Reader in(path, file);
+
+	Header header;
+	in.bytes(&header, sizeof(header));
+	if (std::memcmp(header.magic, magic, sizeof(magic)) != 0) {
+		in.fail("wrong magic bytes");
+	}
+	if (header.byteOrder != byteOrderMark) {
+		in.fail("the file was written on a machine with a different byte order");
+	}
+	if (header.version != version) {
+		in.fail("unsupported version " + std::to_string(header.version));
+	}
+	if (header.numLevels == 0) {
+		in.fail("no levels");
+	}
+
+	LevelHierarchy<Matrix> hierarchy;
+	hierarchy.addFinestLevel(in.template matrix<Matrix>());
+	for (index k = 1; k < header.numLevels; ++k) {
+		const uint64_t type = in.word();
+		Matrix A = in.template matrix<Matrix>();
+		if (type == ELIMINATION) {
+			const count numStages = in.word();
+			std::vector<EliminationStage<Matrix>> stages;
+			for (index s = 0; s < numStages; ++s) {
+				Matrix P = in.template matrix<Matrix>();
+				Matrix R = in.template matrix<Matrix>();
+				Vector q(in.template array<double>());
+				std::vector<index> fSet = in.template array<index>();
+				std::vector<index> cSet = in.template array<index>();
+				const count n = fSet.size() + cSet.size();
+				for (index i : fSet) {
+					if (i >= n) in.fail("elimination stage out of range");
+				}
+				for (index i : cSet) {
+					if (i >= n) in.fail("elimination stage out of range");
+				}
+				if (P.numberOfRows() != fSet.size() || P.numberOfColumns() != cSet.size() || q.getDimension() != fSet.size()
+						|| n != (s == 0 ? hierarchy.at(k - 1).getNumberOfNodes() : stages.back().getCSet().size())) {
+					in.fail("inconsistent elimination stage");
+				}
+				stages.push_back(EliminationStage<Matrix>(P, R, q, fSet, cSet));
+			}
+			if (stages.empty() || stages.back().getCSet().size() != A.numberOfRows()) {
+				in.fail("inconsistent elimination level");
+			}
+			hierarchy.addEliminationLevel(A, stages);
+		} else if (type == AGGREGATION) {
+			Matrix P = in.template matrix<Matrix>();
+			Matrix R = in.template matrix<Matrix>();
+			if (P.numberOfRows() != hierarchy.at(k - 1).getNumberOfNodes() || P.numberOfColumns() != A.numberOfRows()
+					|| R.numberOfRows() != P.numberOfColumns() || R.numberOfColumns() != P.numberOfRows()) {
+				in.fail("inconsistent aggregation level");
+			}
+			hierarchy.addAggregationLevel(A, P, R);
+		} else {
+			in.fail("unknown level type " + std::to_string(type));
+		}
+	}
+
+	const count nRows = in.word();
+	const count nCols = in.word();
+	const double zero = in.real();
+	std::vector<double> entries = in.template array<double>();
+	if (entries.size() != nRows * nCols || nRows != hierarchy.at(hierarchy.size() - 1).getNumberOfNodes() + 1) {
+		in.fail("inconsistent coarse matrix");
+	}
+	hierarchy.coarseLUMatrix = DenseMatrix(nRows, nCols, entries, zero);
+	if (!in.atEnd()) {
+		in.fail("trailing data");
+	}
+
+	key = header.key;
+	return hierarchy;
+}
+
 } /* namespace NetworKit */
 
 #endif /* LEVELHIERARCHY_H_ */
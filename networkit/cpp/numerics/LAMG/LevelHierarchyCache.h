@@ -0,0 +1,338 @@
+/*
+ * LevelHierarchyCache.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef LEVELHIERARCHYCACHE_H_
+#define LEVELHIERARCHYCACHE_H_
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <sys/stat.h>
+
+#include "LevelHierarchy.h"
+#include "MultiLevelSetup.h"
+#include "../../auxiliary/Log.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup numerics
+ * Process-wide cache of LAMG hierarchies, keyed by a fingerprint of the finest Laplacian. The setup is by far
+ * the most expensive part of a LAMG solver that is used for only a few solves, e.g. by SpanningEdgeCentrality,
+ * CommuteTimeDistance or MaxentStress. Solvers that are set up for the same Laplacian share one immutable
+ * hierarchy, as long as at least one of them is alive. By default, a hierarchy is released with the last solver
+ * that holds it, hence solvers that do not overlap in time, e.g. a SpanningEdgeCentrality that is run after a
+ * CommuteTimeDistance on the same graph, only share the setup if a number of hierarchies is retained by
+ * setRetain() or if a directory is set.
+ *
+ * If a directory is set, every hierarchy is also saved there as lamg-<fingerprint>.hierarchy and loaded again
+ * by later setups for the same Laplacian, even from other processes. Files of a different version are ignored
+ * and overwritten. The files are not removed by the cache.
+ *
+ * Since different Laplacians may share a fingerprint, the finest level of a cached or loaded hierarchy is
+ * compared with the Laplacian entry by entry, and the hierarchy is computed again if they differ. The key does
+ * not cover the MultiLevelSetup, i.e. its smoother: a hierarchy that has been set up with one smoother is
+ * returned for setups with any other smoother. Use clear() and a separate directory when changing the smoother.
+ */
+template<class Matrix>
+class LevelHierarchyCache {
+private:
+	static std::mutex mutex;
+	static std::map<uint64_t, std::weak_ptr<const LevelHierarchy<Matrix>>> entries;
+	static std::string directory;
+	static count retain;
+	static std::list<std::shared_ptr<const LevelHierarchy<Matrix>>> retained;
+
+	static std::string pathIn(const std::string& dir, uint64_t key);
+	static std::shared_ptr<const LevelHierarchy<Matrix>> loadFromFile(const std::string& path, uint64_t key, const Matrix& A);
+
+	/**
+	 * @return True if the finest level of @a hierarchy is the Laplacian @a A.
+	 */
+	static bool matches(const LevelHierarchy<Matrix>& hierarchy, const Matrix& A);
+
+	/**
+	 * Marks @a hierarchy as the most recently used one and releases the least recently used hierarchies beyond
+	 * the ones to retain. The mutex must be held.
+	 */
+	static void touch(const std::shared_ptr<const LevelHierarchy<Matrix>>& hierarchy);
+
+public:
+	/**
+	 * @return A 64-bit hash of the dimensions and the nonzeros of @a A, independent of the order of the
+	 * nonzeros within the rows.
+	 */
+	static uint64_t fingerprint(const Matrix& A);
+
+	/**
+	 * @return The hierarchy of the Laplacian @a A. If no solver holds a hierarchy of @a A and none has been
+	 * saved in the directory, it is computed by @a setup and saved in the directory.
+	 * @param A A Laplacian matrix.
+	 * @param setup Used only if the hierarchy is computed, it is not part of the key.
+	 */
+	static std::shared_ptr<const LevelHierarchy<Matrix>> get(const Matrix& A, const MultiLevelSetup<Matrix>& setup);
+
+	/**
+	 * Sets the @a directory in which hierarchies are persisted, an empty string (the default) disables persisting.
+	 */
+	static void setDirectory(const std::string& directory);
+
+	/**
+	 * @return The directory in which hierarchies are persisted, empty if they are not persisted.
+	 */
+	static std::string getDirectory();
+
+	/**
+	 * Keeps the @a number most recently used hierarchies in memory even if no solver holds them. The default is 0,
+	 * i.e. a hierarchy is released with the last solver that holds it.
+	 */
+	static void setRetain(count number);
+
+	/**
+	 * @return The number of most recently used hierarchies that are kept in memory.
+	 */
+	static count getRetain();
+
+	/**
+	 * @return The path of the file the hierarchy of a Laplacian with fingerprint @a key is saved to.
+	 */
+	static std::string pathOf(uint64_t key);
+
+	/**
+	 * Forgets all hierarchies held in memory, including the retained ones. Solvers that have been set up keep their hierarchies.
+	 */
+	static void clear();
+};
+
+template<class Matrix>
+std::mutex LevelHierarchyCache<Matrix>::mutex;
+
+template<class Matrix>
+std::map<uint64_t, std::weak_ptr<const LevelHierarchy<Matrix>>> LevelHierarchyCache<Matrix>::entries;
+
+template<class Matrix>
+std::string LevelHierarchyCache<Matrix>::directory;
+
+template<class Matrix>
+count LevelHierarchyCache<Matrix>::retain = 0;
+
+template<class Matrix>
+std::list<std::shared_ptr<const LevelHierarchy<Matrix>>> LevelHierarchyCache<Matrix>::retained;
+
+template<class Matrix>
+uint64_t LevelHierarchyCache<Matrix>::fingerprint(const Matrix& A) {
+	// splitmix64 finalizer
+	auto mix = [](uint64_t x) {
+		x ^= x >> 30;
+		x *= 0xbf58476d1ce4e5b9ULL;
+		x ^= x >> 27;
+		x *= 0x94d049bb133111ebULL;
+		x ^= x >> 31;
+		return x;
+	};
+
+	// the entries are hashed independently and summed up, so the sum does not depend on their order
+	uint64_t sum = 0;
+#pragma omp parallel for reduction(+:sum) schedule(guided)
+	for (index i = 0; i < A.numberOfRows(); ++i) {
+		A.forNonZeroElementsInRow(i, [&](index j, double value) {
+			uint64_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			sum += mix(mix(mix(i) ^ j) ^ bits);
+		});
+	}
+	return mix(mix(mix(A.numberOfRows()) ^ A.numberOfColumns()) ^ A.nnz()) ^ sum;
+}
+
+template<class Matrix>
+std::string LevelHierarchyCache<Matrix>::pathIn(const std::string& dir, uint64_t key) {
+	char name[64];
+	std::snprintf(name, sizeof(name), "lamg-%016" PRIx64 ".hierarchy", key);
+	return dir + "/" + name;
+}
+
+template<class Matrix>
+std::string LevelHierarchyCache<Matrix>::pathOf(uint64_t key) {
+	return pathIn(getDirectory(), key);
+}
+
+template<class Matrix>
+bool LevelHierarchyCache<Matrix>::matches(const LevelHierarchy<Matrix>& hierarchy, const Matrix& A) {
+	if (hierarchy.size() == 0) {
+		return false;
+	}
+	const Matrix& B = hierarchy.at(0).getLaplacian();
+	if (B.numberOfRows() != A.numberOfRows() || B.numberOfColumns() != A.numberOfColumns() || B.nnz() != A.nnz()) {
+		return false;
+	}
+
+	// the rows are compared as sorted lists of entries, since their order may differ
+	bool equal = true;
+#pragma omp parallel
+	{
+		std::vector<std::pair<index, double>> rowA, rowB;
+#pragma omp for schedule(guided)
+		for (index i = 0; i < A.numberOfRows(); ++i) {
+			if (!__atomic_load_n(&equal, __ATOMIC_RELAXED)) {
+				continue;
+			}
+			rowA.clear();
+			rowB.clear();
+			A.forNonZeroElementsInRow(i, [&](index j, double value) {
+				rowA.emplace_back(j, value);
+			});
+			B.forNonZeroElementsInRow(i, [&](index j, double value) {
+				rowB.emplace_back(j, value);
+			});
+			std::sort(rowA.begin(), rowA.end());
+			std::sort(rowB.begin(), rowB.end());
+			if (rowA != rowB) {
+				__atomic_store_n(&equal, false, __ATOMIC_RELAXED);
+			}
+		}
+	}
+	return equal;
+}
+
+template<class Matrix>
+std::shared_ptr<const LevelHierarchy<Matrix>> LevelHierarchyCache<Matrix>::loadFromFile(const std::string& path, uint64_t key, const Matrix& A) {
+	struct stat info;
+	if (stat(path.c_str(), &info) != 0) {
+		return nullptr;
+	}
+	try {
+		uint64_t fileKey;
+		std::shared_ptr<LevelHierarchy<Matrix>> hierarchy = std::make_shared<LevelHierarchy<Matrix>>(LevelHierarchy<Matrix>::load(path, fileKey));
+		if (fileKey != key) {
+			WARN("ignoring LAMG hierarchy ", path, " saved under a different key");
+		} else if (!matches(*hierarchy, A)) {
+			WARN("ignoring LAMG hierarchy ", path, " of a different Laplacian with the same fingerprint");
+		} else {
+			return hierarchy;
+		}
+	} catch (std::runtime_error& e) {
+		WARN("ignoring LAMG hierarchy: ", e.what());
+	}
+	return nullptr;
+}
+
+template<class Matrix>
+std::shared_ptr<const LevelHierarchy<Matrix>> LevelHierarchyCache<Matrix>::get(const Matrix& A, const MultiLevelSetup<Matrix>& setup) {
+	const uint64_t key = fingerprint(A);
+	std::string dir;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		auto it = entries.find(key);
+		if (it != entries.end()) {
+			std::shared_ptr<const LevelHierarchy<Matrix>> hierarchy = it->second.lock();
+			if (hierarchy && matches(*hierarchy, A)) {
+				touch(hierarchy);
+				return hierarchy;
+			}
+		}
+		dir = directory;
+	}
+
+	// load or compute without holding the lock, a concurrent call for the same key may do the same work
+	std::shared_ptr<const LevelHierarchy<Matrix>> hierarchy;
+	const std::string path = dir.empty() ? "" : pathIn(dir, key);
+	if (!dir.empty()) {
+		hierarchy = loadFromFile(path, key, A);
+	}
+	if (!hierarchy) {
+		std::shared_ptr<LevelHierarchy<Matrix>> computed = std::make_shared<LevelHierarchy<Matrix>>();
+		setup.setup(A, *computed);
+		if (!dir.empty()) {
+			try {
+				computed->save(path, key);
+			} catch (std::runtime_error& e) {
+				WARN("could not save LAMG hierarchy: ", e.what());
+			}
+		}
+		hierarchy = computed;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	for (auto it = entries.begin(); it != entries.end();) {
+		if (it->second.expired()) {
+			it = entries.erase(it);
+		} else {
+			++it;
+		}
+	}
+	// a colliding Laplacian replaces the entry, solvers that hold the previous hierarchy keep it
+	std::shared_ptr<const LevelHierarchy<Matrix>> other = entries[key].lock();
+	if (other && matches(*other, A)) {
+		touch(other);
+		return other;
+	}
+	entries[key] = hierarchy;
+	touch(hierarchy);
+	return hierarchy;
+}
+
+template<class Matrix>
+void LevelHierarchyCache<Matrix>::touch(const std::shared_ptr<const LevelHierarchy<Matrix>>& hierarchy) {
+	if (retain == 0) {
+		return;
+	}
+	auto it = std::find(retained.begin(), retained.end(), hierarchy);
+	if (it != retained.end()) {
+		retained.splice(retained.begin(), retained, it);
+	} else {
+		retained.push_front(hierarchy);
+	}
+	while (retained.size() > retain) {
+		retained.pop_back();
+	}
+}
+
+template<class Matrix>
+void LevelHierarchyCache<Matrix>::setDirectory(const std::string& directory) {
+	std::lock_guard<std::mutex> lock(mutex);
+	LevelHierarchyCache<Matrix>::directory = directory;
+}
+
+template<class Matrix>
+void LevelHierarchyCache<Matrix>::setRetain(count number) {
+	std::lock_guard<std::mutex> lock(mutex);
+	retain = number;
+	while (retained.size() > retain) {
+		retained.pop_back();
+	}
+}
+
+template<class Matrix>
+count LevelHierarchyCache<Matrix>::getRetain() {
+	std::lock_guard<std::mutex> lock(mutex);
+	return retain;
+}
+
+template<class Matrix>
+std::string LevelHierarchyCache<Matrix>::getDirectory() {
+	std::lock_guard<std::mutex> lock(mutex);
+	return directory;
+}
+
+template<class Matrix>
+void LevelHierarchyCache<Matrix>::clear() {
+	std::lock_guard<std::mutex> lock(mutex);
+	entries.clear();
+	retained.clear();
+}
+
+} /* namespace NetworKit */
+
+#endif /* LEVELHIERARCHYCACHE_H_ */
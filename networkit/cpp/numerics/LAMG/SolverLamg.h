@@ -8,8 +8,11 @@
 #ifndef SOLVERLAMG_H_
 #define SOLVERLAMG_H_
 
+#include <memory>
+
 #include "LevelHierarchy.h"
 #include "../Smoother.h"
+#include "../MulticolorGaussSeidel.h"
 #include "../../algebraic/DenseMatrix.h"
 
 namespace NetworKit {
@@ -26,9 +29,9 @@ struct LAMGSolverStatus {
 	count numPostSmoothIters = 2; // number of post smoothing iterations
 
 	// out
-	count numIters; // number of iterations needed during solve phase
-	double residual; // absolute final residual
-	bool converged; // flag of conversion status
+	count numIters = 0; // number of iterations needed during solve phase
+	double residual = 0.0; // absolute final residual
+	bool converged = false; // flag of conversion status
 	std::vector<double> residualHistory; // history of absolute residuals
 };
 
@@ -39,7 +42,7 @@ struct LAMGSolverStatus {
 template<class Matrix>
 class SolverLamg {
 private:
-	LevelHierarchy<Matrix> &hierarchy;
+	const LevelHierarchy<Matrix> &hierarchy;
 	const Smoother<Matrix> &smoother;
 
 	// data structures for iterate recombination
@@ -51,12 +54,27 @@ private:
 	// bStages for Elimination Levels
 	std::vector<std::vector<Vector>> bStages;
 
+	// block solves: multicolor smoothers of all levels, shared by copies of this solver
+	std::shared_ptr<const std::vector<MulticolorGaussSeidel<Matrix>>> colorSmoothers;
+	// iterates, residuals and bStages of block solves, indexed by level and then by vector
+	std::vector<std::vector<std::vector<Vector>>> blockHistory;
+	std::vector<std::vector<std::vector<Vector>>> blockRHistory;
+	std::vector<std::vector<std::vector<Vector>>> blockBStages;
+
 	void solveCycle(Vector& x, const Vector& b, int finest, LAMGSolverStatus& status);
 	void cycle(Vector& x, const Vector& b, int finest, int coarsest, std::vector<count>& numVisits, std::vector<Vector>& X, std::vector<Vector>& B, const LAMGSolverStatus& status);
 	void multigridCycle(index level, Vector& xf, const Vector& bf);
 	void saveIterate(index level, const Vector& x, const Vector& r);
 	void clearHistory(index level);
 	void minRes(index level, Vector& x, const Vector& r);
+	void minRes(const std::vector<Vector>& history, const std::vector<Vector>& rHistory, count numIterates, Vector& x, const Vector& r);
+
+	void solveCycle(std::vector<Vector>& x, const std::vector<Vector>& b, int finest, std::vector<LAMGSolverStatus>& status);
+	void cycle(std::vector<Vector>& x, const std::vector<Vector>& b, int finest, int coarsest, std::vector<count>& numVisits, std::vector<std::vector<Vector>>& X, std::vector<std::vector<Vector>>& B, const LAMGSolverStatus& status);
+	std::vector<Vector> residual(index level, const std::vector<Vector>& x, const std::vector<Vector>& b) const;
+	void relax(index level, const std::vector<Vector>& b, std::vector<Vector>& x, count iterations) const;
+	void saveIterate(index level, const std::vector<Vector>& x, const std::vector<Vector>& r);
+	void minRes(index level, std::vector<Vector>& x, const std::vector<Vector>& r);
 
 public:
 	/**
@@ -65,7 +83,7 @@ public:
 	 * @param hierarchy Reference to the LevelHierarchy constructed by MultiLevelSetup.
 	 * @param smoother Reference to a smoother.
 	 */
-	SolverLamg(LevelHierarchy<Matrix>& hierarchy, const Smoother<Matrix>& smoother) : hierarchy(hierarchy), smoother(smoother), bStages(hierarchy.size(), std::vector<Vector>()) {}
+	SolverLamg(const LevelHierarchy<Matrix>& hierarchy, const Smoother<Matrix>& smoother) : hierarchy(hierarchy), smoother(smoother), bStages(hierarchy.size(), std::vector<Vector>()) {}
 
 	SolverLamg (const SolverLamg<Matrix>& other) = default;
 
@@ -86,6 +104,23 @@ public:
 	 * @param status Reference to an LAMGSolverStatus.
 	 */
 	void solve(Vector& x, const Vector& b, LAMGSolverStatus& status);
+
+	/**
+	 * Solves the systems A*x[j] = b[j] for all vectors of the block together. The vectors are carried through the
+	 * multigrid cycles at once, so every level matrix is read once per operation for the whole block, and the
+	 * smoothing is a parallel Gauss-Seidel in multicolor ordering. A vector leaves the block as soon as its own
+	 * stopping criterion in @a status[j] is met.
+	 * @param x[out] The initial guesses, overwritten by the approximate solutions.
+	 * @param b The right-hand sides.
+	 * @param status One LAMGSolverStatus per vector.
+	 */
+	void solve(std::vector<Vector>& x, const std::vector<Vector>& b, std::vector<LAMGSolverStatus>& status);
+
+	/**
+	 * Colors the matrices of all levels for the block solve. This is done by the first block solve if it has not
+	 * been done before, copies of this solver made afterwards share the colorings.
+	 */
+	void colorLevels();
 };
 
 template<class Matrix>
@@ -290,8 +325,13 @@ void SolverLamg<Matrix>::clearHistory(index level) {
 
 template<class Matrix>
 void SolverLamg<Matrix>::minRes(index level, Vector& x, const Vector& r) {
-	if (numActiveIterates[level] > 0) {
-		count n = numActiveIterates[level];
+	minRes(history[level], rHistory[level], numActiveIterates[level], x, r);
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::minRes(const std::vector<Vector>& history, const std::vector<Vector>& rHistory, count numIterates, Vector& x, const Vector& r) {
+	if (numIterates > 0) {
+		count n = numIterates;
 
 		std::vector<index> ARowIdx(r.getDimension()+1);
 		std::vector<index> ERowIdx(r.getDimension()+1);
@@ -299,12 +339,12 @@ void SolverLamg<Matrix>::minRes(index level, Vector& x, const Vector& r) {
 #pragma omp parallel for
 		for (index i = 0; i < r.getDimension(); ++i) {
 			for (index k = 0; k < n; ++k) {
-				double AEvalue = r[i] - rHistory[level][k][i];
+				double AEvalue = r[i] - rHistory[k][i];
 				if (std::fabs(AEvalue) > 1e-25) {
 					++ARowIdx[i+1];
 				}
 
-				double Eval = history[level][k][i] - x[i];
+				double Eval = history[k][i] - x[i];
 				if (std::fabs(Eval) > 1e-25) {
 					++ERowIdx[i+1];
 				}
@@ -325,14 +365,14 @@ void SolverLamg<Matrix>::minRes(index level, Vector& x, const Vector& r) {
 #pragma omp parallel for
 		for (index i = 0; i < r.getDimension(); ++i) {
 			for (index k = 0, aIdx = ARowIdx[i], eIdx = ERowIdx[i]; k < n; ++k) {
-				double AEvalue = r[i] - rHistory[level][k][i];
+				double AEvalue = r[i] - rHistory[k][i];
 				if (std::fabs(AEvalue) > 1e-25) {
 					AColumnIdx[aIdx] = k;
 					ANonZeros[aIdx] = AEvalue;
 					++aIdx;
 				}
 
-				double Eval = history[level][k][i] - x[i];
+				double Eval = history[k][i] - x[i];
 				if (std::fabs(Eval) > 1e-25) {
 					EColumnIdx[eIdx] = k;
 					ENonZeros[eIdx] = Eval;
@@ -350,6 +390,288 @@ void SolverLamg<Matrix>::minRes(index level, Vector& x, const Vector& r) {
 
 }
 
+template<class Matrix>
+void SolverLamg<Matrix>::colorLevels() {
+	if (colorSmoothers && colorSmoothers->size() == hierarchy.size()) return;
+
+	std::shared_ptr<std::vector<MulticolorGaussSeidel<Matrix>>> smoothers = std::make_shared<std::vector<MulticolorGaussSeidel<Matrix>>>(hierarchy.size());
+#pragma omp parallel for schedule(dynamic, 1)
+	for (index i = 0; i < hierarchy.size(); ++i) {
+		(*smoothers)[i] = MulticolorGaussSeidel<Matrix>(hierarchy.at(i).getLaplacian());
+	}
+	colorSmoothers = smoothers;
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::solve(std::vector<Vector>& x, const std::vector<Vector>& b, std::vector<LAMGSolverStatus>& status) {
+	assert(x.size() == b.size() && b.size() == status.size());
+	colorLevels();
+	blockBStages = std::vector<std::vector<std::vector<Vector>>>(hierarchy.size());
+	if (hierarchy.size() >= 2) {
+		std::vector<Vector> bc = b;
+		std::vector<Vector> xc = x;
+		int finest = 0;
+
+		if (hierarchy.getType(1) == ELIMINATION) {
+			hierarchy.at(1).restrict(b, bc, blockBStages[1]);
+			if (hierarchy.at(1).getLaplacian().numberOfRows() == 1) {
+				for (Vector& xj : x) {
+					xj = 0.0;
+				}
+				return;
+			} else {
+				hierarchy.at(1).coarseType(x, xc);
+				finest = 1;
+			}
+		}
+		solveCycle(xc, bc, finest, status);
+
+		if (finest == 1) { // interpolate from finest == ELIMINATION level back to actual finest level
+			hierarchy.at(1).interpolate(xc, x, blockBStages[1]);
+		} else {
+			x = xc;
+		}
+	} else {
+		solveCycle(x, b, 0, status);
+	}
+
+	std::vector<Vector> r = residual(0, x, b);
+	for (index j = 0; j < x.size(); ++j) {
+		status[j].residual = r[j].length();
+	}
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::solveCycle(std::vector<Vector>& x, const std::vector<Vector>& b, int finest, std::vector<LAMGSolverStatus>& status) {
+	Aux::Timer timer;
+	timer.start();
+
+	const count numVectors = x.size();
+	blockHistory = std::vector<std::vector<std::vector<Vector>>>(hierarchy.size(), std::vector<std::vector<Vector>>(numVectors, std::vector<Vector>(MAX_COMBINED_ITERATES)));
+	blockRHistory = blockHistory;
+	latestIterate = std::vector<index>(hierarchy.size(), 0);
+	numActiveIterates = std::vector<count>(hierarchy.size(), 0);
+	int coarsest = hierarchy.size() - 1;
+	std::vector<count> numVisits(coarsest);
+	std::vector<std::vector<Vector>> X(hierarchy.size());
+	std::vector<std::vector<Vector>> B(hierarchy.size());
+
+	std::vector<Vector> r = residual(finest, x, b);
+	std::vector<double> residuals(numVectors);
+	std::vector<double> finalResiduals(numVectors);
+	std::vector<double> bestResiduals(numVectors, std::numeric_limits<double>::max());
+	std::vector<count> noResReduction(numVectors, 0);
+	std::vector<index> active; // the vectors that are still iterated, in the order of the current block
+	for (index j = 0; j < numVectors; ++j) {
+		residuals[j] = r[j].length();
+		finalResiduals[j] = residuals[j] * status[j].desiredResidualReduction;
+		status[j].residualHistory.emplace_back(residuals[j]);
+		status[j].numIters = 0;
+		if (residuals[j] > finalResiduals[j] && status[j].maxIters > 0) {
+			active.push_back(j);
+		}
+	}
+
+	std::vector<Vector> xActive;
+	std::vector<Vector> bActive;
+	while (!active.empty()) {
+		xActive.resize(active.size());
+		bActive.resize(active.size());
+		for (index a = 0; a < active.size(); ++a) {
+			xActive[a] = x[active[a]];
+			bActive[a] = b[active[a]];
+		}
+
+		cycle(xActive, bActive, finest, coarsest, numVisits, X, B, status[active[0]]);
+		std::vector<Vector> rActive = residual(finest, xActive, bActive);
+
+		// vectors that met their stopping criterion leave the block together with their iterate history
+		std::vector<index> stillActive;
+		std::vector<bool> keep(active.size());
+		for (index a = 0; a < active.size(); ++a) {
+			const index j = active[a];
+			x[j] = xActive[a];
+			r[j] = rActive[a];
+			residuals[j] = r[j].length();
+			status[j].residualHistory.emplace_back(residuals[j]);
+			if (residuals[j] < bestResiduals[j]) {
+				noResReduction[j] = 0;
+				bestResiduals[j] = residuals[j];
+			} else {
+				++noResReduction[j];
+			}
+			status[j].numIters++;
+
+			keep[a] = residuals[j] > finalResiduals[j] && noResReduction[j] < 5 && status[j].numIters < status[j].maxIters && timer.elapsedMilliseconds() <= status[j].maxConvergenceTime;
+			if (keep[a]) {
+				stillActive.push_back(j);
+			}
+		}
+
+		if (stillActive.size() < active.size()) {
+			for (index level = 0; level < hierarchy.size(); ++level) {
+				index next = 0;
+				for (index a = 0; a < active.size(); ++a) {
+					if (keep[a]) {
+						std::swap(blockHistory[level][next], blockHistory[level][a]);
+						std::swap(blockRHistory[level][next], blockRHistory[level][a]);
+						++next;
+					}
+				}
+				blockHistory[level].resize(next);
+				blockRHistory[level].resize(next);
+			}
+			active = std::move(stillActive);
+		}
+	}
+
+	timer.stop();
+
+	for (index j = 0; j < numVectors; ++j) {
+		status[j].residual = residuals[j];
+		status[j].converged = residuals[j] <= finalResiduals[j];
+	}
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::cycle(std::vector<Vector>& x, const std::vector<Vector>& b, int finest, int coarsest, std::vector<count>& numVisits, std::vector<std::vector<Vector>>& X, std::vector<std::vector<Vector>>& B, const LAMGSolverStatus& status) {
+	std::fill(numVisits.begin(), numVisits.end(), 0);
+	X[finest] = x;
+	B[finest] = b;
+
+	int currLvl = finest;
+	int nextLvl = finest;
+	double maxVisits = 0.0;
+
+	saveIterate(currLvl, X[currLvl], residual(currLvl, X[currLvl], B[currLvl]));
+	while (true) {
+		if (currLvl == coarsest) {
+			nextLvl = currLvl - 1;
+			if (currLvl == finest) { // finest level
+				relax(currLvl, B[currLvl], X[currLvl], status.numPreSmoothIters);
+			} else {
+				for (index j = 0; j < X[currLvl].size(); ++j) {
+					Vector bCoarse(B[currLvl][j].getDimension()+1, 0.0);
+					for (index i = 0; i < B[currLvl][j].getDimension(); ++i) {
+						bCoarse[i] = B[currLvl][j][i];
+					}
+
+					Vector xCoarse = DenseMatrix::LUSolve(hierarchy.getCoarseMatrix(), bCoarse);
+					for (index i = 0; i < X[currLvl][j].getDimension(); ++i) {
+						X[currLvl][j][i] = xCoarse[i];
+					}
+				}
+			}
+		} else {
+			if (currLvl == finest) {
+				maxVisits = 1.0;
+			} else {
+				maxVisits = hierarchy.cycleIndex(currLvl) * numVisits[currLvl-1];
+			}
+
+			if (numVisits[currLvl] < maxVisits) {
+				nextLvl = currLvl + 1;
+			} else {
+				nextLvl = currLvl - 1;
+			}
+		}
+
+		if (nextLvl < finest) break;
+
+		if (nextLvl > currLvl) {  // preProcess
+			numVisits[currLvl]++;
+
+			if (hierarchy.getType(nextLvl) != ELIMINATION) {
+				relax(currLvl, B[currLvl], X[currLvl], status.numPreSmoothIters);
+			}
+
+			if (hierarchy.getType(nextLvl) == ELIMINATION) {
+				hierarchy.at(nextLvl).restrict(B[currLvl], B[nextLvl], blockBStages[nextLvl]);
+			} else {
+				hierarchy.at(nextLvl).restrict(residual(currLvl, X[currLvl], B[currLvl]), B[nextLvl]);
+			}
+
+			hierarchy.at(nextLvl).coarseType(X[currLvl], X[nextLvl]);
+
+			clearHistory(nextLvl);
+		} else { // postProcess
+			if (currLvl == coarsest || hierarchy.getType(currLvl+1) != ELIMINATION) {
+				minRes(currLvl, X[currLvl], residual(currLvl, X[currLvl], B[currLvl]));
+			}
+
+			if (nextLvl > finest) {
+				saveIterate(nextLvl, X[nextLvl], residual(nextLvl, X[nextLvl], B[nextLvl]));
+			}
+
+			if (hierarchy.getType(currLvl) == ELIMINATION) {
+				hierarchy.at(currLvl).interpolate(X[currLvl], X[nextLvl], blockBStages[currLvl]);
+			} else {
+				std::vector<Vector> xf = X[nextLvl];
+				hierarchy.at(currLvl).interpolate(X[currLvl], xf);
+				for (index j = 0; j < xf.size(); ++j) {
+					X[nextLvl][j] += xf[j];
+				}
+			}
+
+			if (hierarchy.getType(currLvl) != ELIMINATION) {
+				relax(nextLvl, B[nextLvl], X[nextLvl], status.numPostSmoothIters);
+			}
+		}
+
+		currLvl = nextLvl;
+	} // while
+
+	// post-cycle finest
+	if ((int64_t) hierarchy.size() > finest + 1 && hierarchy.getType(finest+1) != ELIMINATION) { // do an iterate recombination on calculated solutions
+		minRes(finest, X[finest], residual(finest, X[finest], B[finest]));
+	}
+
+	for (Vector& xj : X[finest]) {
+		xj -= xj.mean();
+	}
+	x = X[finest];
+}
+
+template<class Matrix>
+std::vector<Vector> SolverLamg<Matrix>::residual(index level, const std::vector<Vector>& x, const std::vector<Vector>& b) const {
+	std::vector<Vector> r;
+	blockMultiply(hierarchy.at(level).getLaplacian(), x, r);
+	for (index j = 0; j < r.size(); ++j) {
+		r[j] = b[j] - r[j];
+	}
+	return r;
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::relax(index level, const std::vector<Vector>& b, std::vector<Vector>& x, count iterations) const {
+	(*colorSmoothers)[level].relax(hierarchy.at(level).getLaplacian(), b, x, iterations);
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::saveIterate(index level, const std::vector<Vector>& x, const std::vector<Vector>& r) {
+	// update latest pointer
+	index i = latestIterate[level];
+	latestIterate[level] = (i+1) % MAX_COMBINED_ITERATES;
+
+	// update numIterates
+	if (numActiveIterates[level] < MAX_COMBINED_ITERATES) {
+		numActiveIterates[level]++;
+	}
+
+	// update history arrays
+	for (index j = 0; j < x.size(); ++j) {
+		blockHistory[level][j][i] = x[j];
+		blockRHistory[level][j][i] = r[j];
+	}
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::minRes(index level, std::vector<Vector>& x, const std::vector<Vector>& r) {
+	for (index j = 0; j < x.size(); ++j) {
+		minRes(blockHistory[level][j], blockRHistory[level][j], numActiveIterates[level], x[j], r[j]);
+	}
+}
+
 } /* namespace NetworKit */
 
 #endif /* SOLVERLAMG_H_ */
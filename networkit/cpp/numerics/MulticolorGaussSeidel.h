@@ -0,0 +1,153 @@
+/*
+ * MulticolorGaussSeidel.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef MULTICOLORGAUSSSEIDEL_H_
+#define MULTICOLORGAUSSSEIDEL_H_
+
+#include <vector>
+#include "../algebraic/Vector.h"
+#include "omp.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup numerics
+ * Gauss-Seidel smoother that sweeps over the rows in a multicolor ordering. The rows of the matrix are colored
+ * greedily such that no two rows of the same color are coupled by a nonzero, hence all rows of a color can be
+ * relaxed in parallel and a sweep only synchronizes once per color. The sweeps work on blocks of vectors, every
+ * row of the matrix is read once for all vectors of the block.
+ *
+ * The coloring is computed once for a matrix with a symmetric nonzero pattern, e.g. a Laplacian, and is valid for
+ * all matrices with the same pattern.
+ */
+template<class Matrix>
+class MulticolorGaussSeidel {
+private:
+	std::vector<index> colorBegin; // rows of color c are rows[colorBegin[c]] to rows[colorBegin[c+1]-1]
+	std::vector<index> rows;
+
+public:
+	/** Default constructor */
+	MulticolorGaussSeidel() = default;
+
+	/**
+	 * Colors the rows of @a A.
+	 * @param A A matrix with a symmetric nonzero pattern.
+	 */
+	MulticolorGaussSeidel(const Matrix& A);
+
+	/**
+	 * @return The number of colors.
+	 */
+	count numberOfColors() const {
+		return colorBegin.size() - 1;
+	}
+
+	/**
+	 * @return The color of every row.
+	 */
+	std::vector<index> getColors() const;
+
+	/**
+	 * Performs @a iterations Gauss-Seidel sweeps on A * X[j] = B[j] for all vectors of the block, starting from the
+	 * current values of @a X.
+	 * @param A The matrix that has been colored.
+	 * @param B The right-hand sides.
+	 * @param X The initial guesses, overwritten by the smoothed vectors.
+	 * @param iterations Number of sweeps.
+	 */
+	void relax(const Matrix& A, const std::vector<Vector>& B, std::vector<Vector>& X, count iterations) const;
+};
+
+template<class Matrix>
+MulticolorGaussSeidel<Matrix>::MulticolorGaussSeidel(const Matrix& A) {
+	const count n = A.numberOfRows();
+	std::vector<index> color(n, none);
+	std::vector<index> usedBy; // usedBy[c] == i if a neighbor of row i has color c
+	count numColors = 0;
+	for (index i = 0; i < n; ++i) {
+		A.forNonZeroElementsInRow(i, [&](index j, double) {
+			if (j != i && color[j] != none) {
+				usedBy[color[j]] = i;
+			}
+		});
+
+		index c = 0;
+		while (c < numColors && usedBy[c] == i) {
+			++c;
+		}
+		if (c == numColors) {
+			++numColors;
+			usedBy.push_back(none);
+		}
+		color[i] = c;
+	}
+
+	colorBegin.assign(numColors + 1, 0);
+	for (index i = 0; i < n; ++i) {
+		++colorBegin[color[i] + 1];
+	}
+	for (index c = 0; c < numColors; ++c) {
+		colorBegin[c + 1] += colorBegin[c];
+	}
+	rows.resize(n);
+	std::vector<index> position(colorBegin.begin(), colorBegin.end() - 1);
+	for (index i = 0; i < n; ++i) {
+		rows[position[color[i]]++] = i;
+	}
+}
+
+template<class Matrix>
+std::vector<index> MulticolorGaussSeidel<Matrix>::getColors() const {
+	std::vector<index> color(rows.size());
+	for (index c = 0; c < numberOfColors(); ++c) {
+		for (index k = colorBegin[c]; k < colorBegin[c + 1]; ++k) {
+			color[rows[k]] = c;
+		}
+	}
+	return color;
+}
+
+template<class Matrix>
+void MulticolorGaussSeidel<Matrix>::relax(const Matrix& A, const std::vector<Vector>& B, std::vector<Vector>& X, count iterations) const {
+	assert(A.numberOfRows() == rows.size());
+	assert(B.size() == X.size());
+	const count numVectors = X.size();
+
+	for (index iteration = 0; iteration < iterations; ++iteration) {
+		for (index c = 0; c < numberOfColors(); ++c) {
+			// small colors are not worth a parallel region
+#pragma omp parallel if (colorBegin[c + 1] - colorBegin[c] >= 1024)
+			{
+				std::vector<double> sigma(numVectors);
+#pragma omp for schedule(guided)
+				for (index k = colorBegin[c]; k < colorBegin[c + 1]; ++k) {
+					const index i = rows[k];
+					double diagonal = 0.0;
+					std::fill(sigma.begin(), sigma.end(), 0.0);
+					A.forNonZeroElementsInRow(i, [&](index column, double value) {
+						if (column == i) {
+							diagonal = value;
+						} else {
+							for (index j = 0; j < numVectors; ++j) {
+								sigma[j] += value * X[j][column];
+							}
+						}
+					});
+
+					for (index j = 0; j < numVectors; ++j) {
+						X[j][i] = (B[j][i] - sigma[j]) / diagonal;
+					}
+				}
+			}
+		}
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* MULTICOLORGAUSSSEIDEL_H_ */
@@ -8,12 +8,18 @@
 #include "LAMGGTest.h"
 #include "../LAMG/MultiLevelSetup.h"
 #include "../LAMG/SolverLamg.h"
+#include "../LAMG/Lamg.h"
+#include "../LAMG/LevelHierarchyCache.h"
+#include "../MulticolorGaussSeidel.h"
 #include "../../io/LineFileReader.h"
 #include "../../auxiliary/Timer.h"
 #include "../../algebraic/CSRMatrix.h"
 
 #include "../GaussSeidelRelaxation.h"
 
+#include <cstdio>
+#include <fstream>
+
 namespace NetworKit {
 
 TEST_F(LAMGGTest, testSmallGraphs) {
@@ -69,6 +75,213 @@ TEST_F(LAMGGTest, testSmallGraphs) {
 }
 
 
+TEST_F(LAMGGTest, testBlockSolve) {
+	METISGraphReader reader;
+	std::vector<Graph> graphs = {BarabasiAlbertGenerator(2, 3000).generate(), reader.read("input/power.graph")};
+	for (const Graph& G : graphs) {
+		CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+
+		// no two coupled rows share a color
+		MulticolorGaussSeidel<CSRMatrix> multicolor(L);
+		std::vector<index> color = multicolor.getColors();
+		EXPECT_GT(multicolor.numberOfColors(), 1u);
+		L.forNonZeroElementsInRowOrder([&](index i, index j, double) {
+			if (i != j) {
+				EXPECT_NE(color[i], color[j]);
+			}
+		});
+
+		const count k = 20;
+		std::vector<Vector> rhs(k);
+		std::vector<Vector> results(k, Vector(G.numberOfNodes(), 0.0));
+		for (index j = 0; j < k; ++j) {
+			rhs[j] = randZeroSum(G, 4242 + j);
+		}
+
+		// the stopping criteria of the vectors of a block are independent of each other
+		GaussSeidelRelaxation<CSRMatrix> smoother;
+		MultiLevelSetup<CSRMatrix> setup(smoother);
+		LevelHierarchy<CSRMatrix> hierarchy;
+		setup.setup(G, hierarchy);
+		SolverLamg<CSRMatrix> solver(hierarchy, smoother);
+		std::vector<Vector> x(results.begin(), results.begin() + 3);
+		std::vector<Vector> b(rhs.begin(), rhs.begin() + 3);
+		std::vector<LAMGSolverStatus> status(3);
+		status[0].desiredResidualReduction = 1e-8;
+		status[1].desiredResidualReduction = 1e-2;
+		status[2].maxIters = 2;
+		solver.solve(x, b, status);
+		EXPECT_TRUE(status[0].converged);
+		EXPECT_TRUE(status[1].converged);
+		EXPECT_EQ(2u, status[2].numIters);
+		EXPECT_LT(status[1].numIters, status[0].numIters);
+		for (index j = 0; j < 3; ++j) {
+			EXPECT_NEAR((L * x[j] - b[j]).length(), status[j].residual, 1e-9);
+		}
+
+		Lamg<CSRMatrix> lamg(1e-6);
+		lamg.setupConnected(L);
+		lamg.parallelSolve(rhs, results);
+		for (index j = 0; j < k; ++j) {
+			EXPECT_LE((L * results[j] - rhs[j]).length() / rhs[j].length(), 1e-6);
+		}
+	}
+}
+
+TEST_F(LAMGGTest, testHierarchyPersistence) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/power.graph");
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	GaussSeidelRelaxation<CSRMatrix> smoother;
+	MultiLevelSetup<CSRMatrix> setup(smoother);
+	LevelHierarchy<CSRMatrix> hierarchy;
+	setup.setup(L, hierarchy);
+
+	const uint64_t key = LevelHierarchyCache<CSRMatrix>::fingerprint(L);
+	EXPECT_EQ(key, LevelHierarchyCache<CSRMatrix>::fingerprint(CSRMatrix::laplacianMatrix(G)));
+	Graph H = G;
+	H.removeEdge(0, *G.neighbors(0).begin());
+	EXPECT_NE(key, LevelHierarchyCache<CSRMatrix>::fingerprint(CSRMatrix::laplacianMatrix(H)));
+
+	// the loaded hierarchy equals the saved one
+	const std::string path = "output/power.hierarchy";
+	hierarchy.save(path, key);
+	uint64_t loadedKey;
+	LevelHierarchy<CSRMatrix> loaded = LevelHierarchy<CSRMatrix>::load(path, loadedKey);
+	EXPECT_EQ(key, loadedKey);
+	ASSERT_EQ(hierarchy.size(), loaded.size());
+	bool hasElimination = false, hasAggregation = false;
+	for (index i = 0; i < hierarchy.size(); ++i) {
+		EXPECT_EQ(hierarchy.getType(i), loaded.getType(i));
+		hasElimination |= hierarchy.getType(i) == ELIMINATION;
+		hasAggregation |= hierarchy.getType(i) == AGGREGATION;
+		const CSRMatrix& A = hierarchy.at(i).getLaplacian();
+		const CSRMatrix& B = loaded.at(i).getLaplacian();
+		ASSERT_EQ(A.nnz(), B.nnz());
+		A.forNonZeroElementsInRowOrder([&](index r, index c, double value) {
+			EXPECT_EQ(value, B(r, c));
+		});
+	}
+	EXPECT_TRUE(hasElimination);
+	EXPECT_TRUE(hasAggregation);
+	const DenseMatrix& C = hierarchy.getCoarseMatrix();
+	ASSERT_EQ(C.numberOfRows(), loaded.getCoarseMatrix().numberOfRows());
+	for (index i = 0; i < C.numberOfRows(); ++i) {
+		for (index j = 0; j < C.numberOfColumns(); ++j) {
+			EXPECT_EQ(C(i, j), loaded.getCoarseMatrix()(i, j));
+		}
+	}
+
+	// and solves exactly like it
+	Vector b = randZeroSum(G, 12345);
+	Vector x(G.numberOfNodes(), 0.0);
+	Vector y(G.numberOfNodes(), 0.0);
+	LAMGSolverStatus status, loadedStatus;
+	status.desiredResidualReduction = loadedStatus.desiredResidualReduction = 1e-6;
+	SolverLamg<CSRMatrix>(hierarchy, smoother).solve(x, b, status);
+	SolverLamg<CSRMatrix>(loaded, smoother).solve(y, b, loadedStatus);
+	EXPECT_TRUE(status.converged);
+	EXPECT_EQ(status.numIters, loadedStatus.numIters);
+	EXPECT_EQ(status.residual, loadedStatus.residual);
+
+	// truncated files are rejected
+	{
+		std::ifstream in(path, std::ios::binary);
+		std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		out.write(content.data(), content.size() - 8);
+	}
+	EXPECT_THROW(LevelHierarchy<CSRMatrix>::load(path, loadedKey), std::runtime_error);
+	std::remove(path.c_str());
+}
+
+TEST_F(LAMGGTest, testHierarchyCache) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/power.graph");
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	GaussSeidelRelaxation<CSRMatrix> smoother;
+	MultiLevelSetup<CSRMatrix> setup(smoother);
+	LevelHierarchyCache<CSRMatrix>::clear();
+
+	// solvers for the same Laplacian share the hierarchy while one of them holds it
+	auto first = LevelHierarchyCache<CSRMatrix>::get(L, setup);
+	auto second = LevelHierarchyCache<CSRMatrix>::get(CSRMatrix::laplacianMatrix(G), setup);
+	EXPECT_EQ(first.get(), second.get());
+	first.reset();
+	second.reset();
+
+	// by default, a hierarchy is released with its last solver, retained ones are kept until they are evicted
+	std::weak_ptr<const LevelHierarchy<CSRMatrix>> released = LevelHierarchyCache<CSRMatrix>::get(L, setup);
+	EXPECT_TRUE(released.expired());
+	LevelHierarchyCache<CSRMatrix>::setRetain(1);
+	std::weak_ptr<const LevelHierarchy<CSRMatrix>> retained = LevelHierarchyCache<CSRMatrix>::get(L, setup);
+	EXPECT_FALSE(retained.expired());
+	LevelHierarchyCache<CSRMatrix>::get(CSRMatrix::laplacianMatrix(BarabasiAlbertGenerator(2, 200).generate()), setup);
+	EXPECT_TRUE(retained.expired());
+	LevelHierarchyCache<CSRMatrix>::setRetain(0);
+	LevelHierarchyCache<CSRMatrix>::clear();
+
+	// a persisted hierarchy is loaded instead of running the setup
+	LevelHierarchyCache<CSRMatrix>::setDirectory("output");
+	const uint64_t key = LevelHierarchyCache<CSRMatrix>::fingerprint(L);
+	const std::string path = LevelHierarchyCache<CSRMatrix>::pathOf(key);
+	LevelHierarchyCache<CSRMatrix>::get(L, setup);
+	std::ifstream saved(path);
+	EXPECT_TRUE(saved.good());
+	LevelHierarchyCache<CSRMatrix>::clear();
+	auto loaded = LevelHierarchyCache<CSRMatrix>::get(L, setup);
+	EXPECT_EQ(G.numberOfNodes(), loaded->at(0).getNumberOfNodes());
+	loaded.reset();
+
+	// the hierarchy of a different graph saved under the same key is rejected and recomputed
+	Graph other = BarabasiAlbertGenerator(2, 500).generate();
+	LevelHierarchy<CSRMatrix> otherHierarchy;
+	setup.setup(other, otherHierarchy);
+	otherHierarchy.save(path, key);
+	LevelHierarchyCache<CSRMatrix>::clear();
+	auto recomputed = LevelHierarchyCache<CSRMatrix>::get(L, setup);
+	EXPECT_EQ(G.numberOfNodes(), recomputed->at(0).getNumberOfNodes());
+	EXPECT_EQ(L.nnz(), recomputed->at(0).getLaplacian().nnz());
+	recomputed.reset();
+
+	// the recomputed hierarchy replaced the file
+	LevelHierarchyCache<CSRMatrix>::clear();
+	uint64_t fileKey;
+	EXPECT_EQ(G.numberOfNodes(), LevelHierarchy<CSRMatrix>::load(path, fileKey).at(0).getNumberOfNodes());
+	EXPECT_EQ(key, fileKey);
+
+	// a hierarchy with the same sparsity pattern but different entries is rejected as well
+	Graph H(G, true, false);
+	const node v = *G.neighbors(0).begin();
+	H.setWeight(0, v, 2.0);
+	CSRMatrix modifiedL = CSRMatrix::laplacianMatrix(H);
+	ASSERT_EQ(L.nnz(), modifiedL.nnz());
+	LevelHierarchy<CSRMatrix> modifiedHierarchy;
+	setup.setup(modifiedL, modifiedHierarchy);
+	modifiedHierarchy.save(path, key);
+	LevelHierarchyCache<CSRMatrix>::clear();
+	auto checked = LevelHierarchyCache<CSRMatrix>::get(L, setup);
+	EXPECT_EQ(L(0, 0), checked->at(0).getLaplacian()(0, 0));
+	EXPECT_EQ(L(0, v), checked->at(0).getLaplacian()(0, v));
+	checked.reset();
+
+	// files saved under another key are ignored
+	otherHierarchy.save(path, key + 1);
+	LevelHierarchyCache<CSRMatrix>::clear();
+	EXPECT_EQ(G.numberOfNodes(), LevelHierarchyCache<CSRMatrix>::get(L, setup)->at(0).getNumberOfNodes());
+
+	// Lamg obtains its hierarchy from the cache
+	Lamg<CSRMatrix> lamg(1e-6);
+	lamg.setupConnected(L);
+	Vector b = randZeroSum(G, 54321);
+	Vector x(G.numberOfNodes(), 0.0);
+	EXPECT_TRUE(lamg.solve(b, x).converged);
+	EXPECT_LE((L * x - b).length() / b.length(), 1e-6);
+
+	LevelHierarchyCache<CSRMatrix>::setDirectory("");
+	LevelHierarchyCache<CSRMatrix>::clear();
+	std::remove(path.c_str());
+}
 
 Vector LAMGGTest::randVector(count dimension, double lower, double upper) const {
 	Vector randVector(dimension);
@@ -0,0 +1,41 @@
+/*
+ * ConcurrentUnionFind.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#include "ConcurrentUnionFind.h"
+
+namespace NetworKit {
+
+ConcurrentUnionFind::ConcurrentUnionFind(index max_element) : parent(max_element) {
+	allToSingletons();
+}
+
+void ConcurrentUnionFind::allToSingletons() {
+	#pragma omp parallel for
+	for (index i = 0; i < parent.size(); ++i) {
+		parent[i] = i;
+	}
+}
+
+void ConcurrentUnionFind::compress() {
+	#pragma omp parallel for schedule(dynamic, 4096)
+	for (index i = 0; i < parent.size(); ++i) {
+		__atomic_store_n(&parent[i], find(i), __ATOMIC_RELAXED);
+	}
+}
+
+Partition ConcurrentUnionFind::toPartition() {
+	compress();
+	Partition p(parent.size());
+	p.setUpperBound(parent.size());
+	#pragma omp parallel for
+	for (index e = 0; e < parent.size(); ++e) {
+		p[e] = parent[e];
+	}
+	return p;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,118 @@
+/*
+ * ConcurrentUnionFind.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: NetworKit contributors
+ */
+
+#ifndef CONCURRENTUNIONFIND_H_
+#define CONCURRENTUNIONFIND_H_
+
+#include <utility>
+#include <vector>
+#include "../Globals.h"
+#include "../structures/Partition.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup structures
+ * Lock-free union find data structure that allows concurrent calls of find() and merge().
+ *
+ * Roots are linked by index in the style of Shiloach-Vishkin: the root with the larger id is
+ * hooked below the root with the smaller id by a compare-and-swap, which only succeeds if the
+ * larger one is still a root. Hence the representative of a set is always its smallest element.
+ * find() compresses paths by path halving, a concurrent halving step only ever shortcuts a node
+ * to one of its ancestors, so it never breaks the forest. Unlike UnionFind, there is no union by
+ * rank, the trees are kept flat by path halving and by calling compress() between phases.
+ */
+class ConcurrentUnionFind {
+private:
+	std::vector<index> parent;
+
+public:
+	/**
+	 * Create a new set representation with elements 0 to @a max_element - 1.
+	 * Initially every element is in its own set.
+	 * @param max_element number of elements
+	 */
+	ConcurrentUnionFind(index max_element);
+
+	/**
+	 * Assigns every element to a singleton set.
+	 * Set id is equal to element id. Must not run concurrently with other calls.
+	 */
+	void allToSingletons();
+
+	/**
+	 * Find the representative of element @a u, which is the smallest element of its set.
+	 * Safe to call concurrently with find() and merge().
+	 * @param u element
+	 * @return representative of set containing @a u
+	 */
+	index find(index u);
+
+	/**
+	 * Merge the two sets containing @a u and @a v. Safe to call concurrently with find() and merge().
+	 * @param u element u
+	 * @param v element v
+	 * @return @c true if the sets were different and have been merged by this call
+	 */
+	bool merge(index u, index v);
+
+	/**
+	 * Sets the parent of every element to its representative, in parallel.
+	 * Must not run concurrently with merge().
+	 */
+	void compress();
+
+	/**
+	 * @return The current parent of @a u, which is its representative right after compress().
+	 */
+	index parentOf(index u) const {
+		return __atomic_load_n(&parent[u], __ATOMIC_RELAXED);
+	}
+
+	/**
+	 * Convert the union find data structure to a Partition
+	 * @return Partition equivalent to the union find data structure
+	 */
+	Partition toPartition();
+};
+
+inline index ConcurrentUnionFind::find(index u) {
+	while (true) {
+		index p = __atomic_load_n(&parent[u], __ATOMIC_RELAXED);
+		if (p == u) {
+			return u;
+		}
+		index gp = __atomic_load_n(&parent[p], __ATOMIC_RELAXED);
+		if (gp == p) {
+			return p;
+		}
+		// path halving, gp is an ancestor of u no matter what other threads do
+		__atomic_store_n(&parent[u], gp, __ATOMIC_RELAXED);
+		u = gp;
+	}
+}
+
+inline bool ConcurrentUnionFind::merge(index u, index v) {
+	while (true) {
+		u = find(u);
+		v = find(v);
+		if (u == v) {
+			return false;
+		}
+		if (u < v) {
+			std::swap(u, v);
+		}
+		// hook the larger root u below v, fails if u has been hooked in the meantime
+		index expected = u;
+		if (__atomic_compare_exchange_n(&parent[u], &expected, v, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+			return true;
+		}
+	}
+}
+
+} /* namespace NetworKit */
+#endif /* CONCURRENTUNIONFIND_H_ */
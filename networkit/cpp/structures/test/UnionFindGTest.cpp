@@ -10,6 +10,8 @@
 #include "UnionFindGTest.h"
 
 #include "../UnionFind.h"
+#include "../ConcurrentUnionFind.h"
+#include "../../auxiliary/Random.h"
 
 #ifndef NOGTEST
 
@@ -72,6 +74,41 @@ TEST_F(UnionFindGTest, testMergeCircular) {
 	}
 }
 
+TEST_F(UnionFindGTest, testConcurrentMerge) {
+	Aux::Random::setSeed(42, false);
+	const index n = 100000;
+	std::vector<std::pair<index, index>> pairs(n / 2 + n / 4);
+	for (auto& pair : pairs) {
+		pair = {Aux::Random::index(n), Aux::Random::index(n)};
+	}
+
+	UnionFind sequential(n);
+	for (auto pair : pairs) {
+		sequential.merge(pair.first, pair.second);
+	}
+	ConcurrentUnionFind concurrent(n);
+	#pragma omp parallel for
+	for (index i = 0; i < pairs.size(); ++i) {
+		concurrent.merge(pairs[i].first, pairs[i].second);
+	}
+
+	std::vector<index> smallest(n, none);
+	for (index i = 0; i < n; ++i) {
+		index& s = smallest[sequential.find(i)];
+		if (s == none) {
+			s = i;
+		}
+		// the representative is the smallest element of the set
+		EXPECT_EQ(s, concurrent.find(i));
+	}
+
+	Partition p = concurrent.toPartition();
+	for (index i = 0; i < n; ++i) {
+		EXPECT_EQ(smallest[sequential.find(i)], p[i]);
+	}
+	EXPECT_FALSE(concurrent.merge(pairs[0].first, pairs[0].second));
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */